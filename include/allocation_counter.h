@@ -0,0 +1,35 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+/**
+ * @class AllocationCounter
+ * @brief Counts calls to the global operator new of the program.
+ *
+ * Only active in builds with PATHFINDER_COUNT_ALLOCATIONS defined: the translation
+ * unit then replaces the global (non-aligned) operator new and delete with versions
+ * that count allocations and forward to malloc/free. Benchmarks read the counter
+ * before and after a call to measure how often it allocates. Without the option the
+ * program keeps the standard allocator (no counting overhead, and embedders remain
+ * free to replace it) and count() always returns 0.
+ */
+class AllocationCounter
+{
+public:
+    /**
+     * @brief Returns the number of allocations made so far by all threads.
+     *
+     * @return Total calls to the global operator new since program start (0 if not enabled)
+     */
+    static std::size_t count();
+
+    /**
+     * @brief Checks whether allocations are counted in this build.
+     *
+     * @return true if the program was built with PATHFINDER_COUNT_ALLOCATIONS
+     */
+    static bool isEnabled();
+};
+
+#endif // ALLOCATION_COUNTER_H
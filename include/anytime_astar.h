@@ -0,0 +1,134 @@
+#ifndef ANYTIME_ASTAR_H
+#define ANYTIME_ASTAR_H
+
+#include "graph.h"
+#include "state.h"
+#include "search_workspace.h"
+#include "indexed_heap.h"
+#include "search_limits.h"
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+/**
+ * @struct AnytimeSolution
+ * @brief One solution published by an anytime search.
+ *
+ * The path is at most 'bound' times as expensive as an optimal path. The bound is
+ * proven by the search: cost divided by the lowest g + h of all cells that could
+ * still lead to a cheaper path.
+ */
+struct AnytimeSolution
+{
+    std::vector<State> path;    // Path from start to goal
+    double cost = 0.0;          // Cost of the path
+    double weight = 1.0;        // Heuristic weight of the search that found it
+    double bound = 1.0;         // Proven suboptimality bound (1 = optimal)
+    double time = 0.0;          // Time since the start of the query (milliseconds)
+    int nodesExpanded = 0;      // Expansions of the query so far
+};
+
+/**
+ * @struct AnytimeSettings
+ * @brief Heuristic weights of an anytime search and the callback that receives its solutions.
+ *
+ * The first search uses initialWeight; every following one lowers the weight by
+ * weightStep until finalWeight. Weights below 1 are raised to 1.
+ */
+struct AnytimeSettings
+{
+    double initialWeight = 2.5;   // Weight of the first search
+    double weightStep = 0.5;      // Decrease per search (<= 0: go straight to finalWeight)
+    double finalWeight = 1.0;     // Last weight; 1 ends with an optimal path
+    std::function<void(const AnytimeSolution&)> onSolution;  // Called for every published solution (may be empty)
+};
+
+/**
+ * @struct AnytimeResults
+ * @brief All solutions of an anytime search, from the first to the best.
+ *
+ * - solutions: Published solutions in order; each one is cheaper or has a tighter
+ *   bound than the one before. The last one is the result of the query.
+ * - success: At least one solution was found
+ * - truncated / stopReason: A SearchLimits stopped the search before it finished its
+ *   last weight; the solutions found until then remain valid
+ */
+struct AnytimeResults
+{
+    std::vector<AnytimeSolution> solutions;          // Published solutions, improving
+    bool success = false;                            // A path was found
+    bool truncated = false;                          // Stopped by a SearchLimits
+    SearchStop stopReason = SearchStop::Completed;   // Limit that stopped the search
+    int iterations = 0;                              // Searches run (one per weight)
+    int nodesExpanded = 0;                           // Expansions of all searches
+    double executionTime = 0.0;                      // Time taken (milliseconds)
+};
+
+/**
+ * @class AnytimeAStar
+ * @brief Anytime Repairing A* (ARA*): a quick weighted A* path, then better ones.
+ *
+ * Every iteration is a weighted A* search with f = g + w * h (Chebyshev distance)
+ * and a lower weight w than the one before. An iteration expands cells while the
+ * goal's g is above the smallest f in the open list; it expands every cell at most
+ * once. A cell whose g drops after it was expanded in the current iteration is put
+ * on an "inconsistent" list instead of being reopened.
+ *
+ * The next iteration reuses everything: the g-values and parents are kept, the open
+ * list and the inconsistent cells are merged and re-keyed with the new weight, and
+ * only the closed markers are reset. After each iteration the bound
+ * min(w, cost / min over open and inconsistent cells of (g + h)) is proven, and the
+ * solution is published if its cost or bound improved. The search ends when the
+ * bound reaches 1, the final weight is done, or a limit stops it.
+ *
+ * Moves and costs match Graph. One object keeps its arrays across queries and must
+ * only be used by one query at a time.
+ */
+class AnytimeAStar
+{
+private:
+    SearchWorkspace workspace;               // g-values and parents, kept across iterations of a query
+    IndexedHeap open;                        // Open list keyed by g + w * h
+    std::vector<std::uint32_t> closedIn;     // Iteration that expanded each cell
+    std::vector<std::uint32_t> inconsIn;     // Iteration whose inconsistent list holds each cell
+    std::vector<CellId> inconsistent;        // Cells improved after being expanded in this iteration
+    std::vector<CellId> pending;             // Open cells while the open list is re-keyed
+    std::uint32_t iteration = 0;             // Current iteration (stamps of closedIn / inconsIn)
+
+    /**
+     * @brief Sizes the arrays for a world and starts a new iteration.
+     *
+     * @param cellCount Number of cells in the world buffer
+     */
+    void nextIteration(int cellCount);
+
+    /**
+     * @brief Runs one weighted A* iteration until no open cell can improve the goal.
+     *
+     * @param graph The graph to search
+     * @param goal Goal state
+     * @param weight Heuristic weight
+     * @param budget Limits of the query
+     * @param results Output: expansions are added, stopReason is set if a limit is hit
+     *
+     * @return true if the iteration finished, false if a limit stopped it
+     */
+    bool improvePath(const Graph& graph, const State& goal, double weight, SearchBudget& budget, AnytimeResults& results);
+
+public:
+    /**
+     * @brief Runs ARA* from start to goal.
+     *
+     * @param graph The graph to search
+     * @param start Starting state (free cell)
+     * @param goal Goal state (free cell)
+     * @param settings Weights and solution callback
+     * @param limits Budget of the whole query (all iterations)
+     *
+     * @return All published solutions and the statistics of the query
+     */
+    AnytimeResults search(const Graph& graph, const State& start, const State& goal, const AnytimeSettings& settings,
+        const SearchLimits& limits);
+};
+
+#endif // ANYTIME_ASTAR_H
@@ -0,0 +1,225 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "planner.h"
+
+/**
+ * @class Benchmark
+ * @brief Wall-clock benchmarks of planner features on larger random worlds.
+ *
+ * Every benchmark builds its own world from a fixed seed, so runs are repeatable,
+ * times a set of random queries and prints the results through StatsManager.
+ */
+class Benchmark
+{
+public:
+    /**
+     * @brief Runs all benchmarks in sequence.
+     */
+    static void runAll();
+
+    /**
+     * @brief Compares sequential and two-thread bidirectional searches.
+     *
+     * Runs the same queries with BidirectionalMode::Sequential and BidirectionalMode::Parallel
+     * for bidirectional Dijkstra and A*, and reports the wall-clock speedup of the parallel
+     * mode and whether both modes returned the same costs.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of random (start, goal) queries
+     */
+    static void runBidirectionalBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Compares answering a batch of queries serially with Planner::planBatch.
+     *
+     * Runs the same A* queries one by one through Planner::plan and as one batch on
+     * the worker pool, then reports the speedup, the batch throughput and latency
+     * percentiles, and whether both runs returned the same costs.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of random (start, goal) queries
+     */
+    static void runBatchBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Compares the shared-queue and work-stealing batch schedulers on a skewed batch.
+     *
+     * Most queries are short, but a few target a walled-off region and exhaust the
+     * search. Reports the wall time of both schedulers, the per-worker load of the
+     * work-stealing run, and the time of a JumpPointTable build run as scheduler jobs.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of queries
+     */
+    static void runSchedulerBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Counts heap allocations per query with a reused PlannerContext.
+     *
+     * Runs the queries through one context per search and reports the allocations of the
+     * first (cold) query and the means of two warm passes, counted by AllocationCounter:
+     * one returning PlanResults::path and one writing the path into a reused caller
+     * buffer. A warm context only allocates the returned path; its QueryArena also
+     * serves the hash containers of the Hashed engine. Only measured in builds with
+     * PATHFINDER_COUNT_ALLOCATIONS defined.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of random (start, goal) queries
+     */
+    static void runAllocationBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Compares full single-source shortest paths: sequential Dijkstra vs delta-stepping.
+     *
+     * Computes the shortest path tree of one source over the whole world with
+     * DeltaStepping::runSequential and with DeltaStepping::run on 1, 2, 4 and all
+     * hardware threads, then with several deltas on all threads, and reports the
+     * speedups and whether every run matched the sequential distances.
+     *
+     * @param size Width and height of the world
+     */
+    static void runDeltaSteppingBenchmark(int size);
+
+    /**
+     * @brief Compares the queue BFS with the bit-parallel BFS on open and cluttered worlds.
+     *
+     * Answers the same random queries with BFSMode::Queue and BFSMode::BitParallel on
+     * worlds with 10% and 30% blocked cells, and reports the total times and whether
+     * both modes found paths of the same length.
+     *
+     * @param size Width and height of the worlds
+     * @param queryCount Number of random (start, goal) queries per world
+     */
+    static void runBitParallelBFSBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Compares top-down and direction-optimizing parallel BFS over a whole world.
+     *
+     * Computes the BFS layers of every cell from the center of a sparsely blocked world:
+     * top-down only on one thread (baseline) and on all threads, then direction-optimizing
+     * on 1, 2, 4 and all threads. Prints the direction chosen per run of layers and
+     * whether all runs matched the baseline.
+     *
+     * @param size Width and height of the world
+     */
+    static void runDirectionOptimizingBFSBenchmark(int size);
+
+    /**
+     * @brief Compares one A* query per agent with a shared FlowField toward the same depot.
+     *
+     * Times Planner::plan (A*) for every agent against one FlowField::compute followed by
+     * FlowField::extractPath per agent, and reports the field's size and whether all
+     * path costs agree.
+     *
+     * @param size Width and height of the world
+     * @param agentCount Number of agents (random free start cells)
+     */
+    static void runFlowFieldBenchmark(int size, int agentCount);
+
+    /**
+     * @brief Compares pairwise A* queries with a DistanceMatrix for robots and pickup locations.
+     *
+     * Times Planner::plan (A*) for every (robot, pickup) pair against DistanceMatrix::compute
+     * on one thread and on all threads, and reports the cells settled per source and
+     * whether all costs agree.
+     *
+     * @param size Width and height of the world
+     * @param sourceCount Number of robots (matrix rows)
+     * @param targetCount Number of pickup locations (matrix columns)
+     */
+    static void runDistanceMatrixBenchmark(int size, int sourceCount, int targetCount);
+
+    /**
+     * @brief Compares one A* query per charger with Planner::planToNearest.
+     *
+     * For a few and for many chargers, times the minimum over per-charger A* queries
+     * against one nearest-goal A* that scans the goals, and one that uses the goal
+     * distance field, and reports whether all costs agree.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of random start cells
+     */
+    static void runNearestGoalBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Measures time-budgeted A* on unreachable goals and the cost of the budget checks.
+     *
+     * Times A* toward walled-in goals without limits and with a time budget (reporting the
+     * slowest budgeted query), then reachable queries without limits and with limits that
+     * are never hit.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of queries per run
+     * @param budget Time budget per query (milliseconds)
+     */
+    static void runTimeBudgetBenchmark(int size, int queryCount, double budget);
+
+    /**
+     * @brief Compares optimal A* with the first and last solutions of Planner::planAnytime.
+     *
+     * Times A* against the time to the first ARA* solution and the whole ARA* query,
+     * reports the average cost of the first solution relative to the optimum, and prints
+     * the solution curve of the longest query.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Number of random queries
+     */
+    static void runAnytimeBenchmark(int size, int queryCount);
+
+    /**
+     * @brief Compares replanning from scratch with D* Lite repairs for an agent meeting new obstacles.
+     *
+     * An agent walks toward a far goal; every few steps a cell of its path a little ahead
+     * becomes blocked. Times a fresh A* from the agent's position against DStarLite
+     * updateCells() + replan() after every change, and reports the expansions per
+     * replan and whether all costs agree.
+     *
+     * @param size Width and height of the world
+     * @param stepCount Maximum number of agent steps
+     */
+    static void runDStarLiteBenchmark(int size, int stepCount);
+
+    /**
+     * @brief Compares fresh A* queries with LPA* repairs for a fixed route under changing congestion.
+     *
+     * Every tick raises the weight of one cell of the current path and a few other cells,
+     * and restores the oldest ones, through World::setWeight; an LPAStar bound to the route repairs its
+     * path with a fresh A* for comparison (LPAStar::setCompareWithFresh). Reports the
+     * total times, the expansions per tick and whether all costs agree.
+     *
+     * @param size Width and height of the world
+     * @param tickCount Number of congestion updates
+     */
+    static void runLPAStarBenchmark(int size, int tickCount);
+
+    /**
+     * @brief Measures the cost of the World change journal and of asking it what changed.
+     *
+     * Replays one sequence of scattered World::setWeight calls with and without a journal,
+     * on a warm grid cleared before every run, alternating the order over several runs
+     * (mean time per run). Then compares finding the changed cells by scanning the grid
+     * against a saved copy with World::getChangesSince.
+     *
+     * @param size Width and height of the world
+     * @param changeCount Changed cells per batch
+     */
+    static void runChangeJournalBenchmark(int size, int changeCount);
+
+    /**
+     * @brief Compares planner threads sharing a locked World with threads reading VersionedWorld snapshots.
+     *
+     * A writer thread keeps changing clusters of weights while reader threads run A*
+     * queries: once on one World guarded by a mutex (queries and updates exclude each
+     * other), once on a VersionedWorld with one SnapshotReader per thread (refresh()
+     * before every query, the writer publishes every batch). Reports the total reader
+     * time, the worst query latency, the writer batches applied, the worst writer batch
+     * time and the tiles copied per publish.
+     *
+     * @param size Width and height of the world
+     * @param queryCount Queries per reader thread
+     */
+    static void runSnapshotBenchmark(int size, int queryCount);
+};
+
+#endif // BENCHMARK_H
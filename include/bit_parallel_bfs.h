@@ -0,0 +1,165 @@
+#ifndef BIT_PARALLEL_BFS_H
+#define BIT_PARALLEL_BFS_H
+
+#include "world.h"
+#include "state.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class BitParallelBFS
+ * @brief Breadth-first search that expands the wavefront 64 cells at a time.
+ *
+ * The free cells, the visited cells and the frontier are kept as bitmaps with one
+ * bit per cell, stored row by row in 64-bit words. A BFS layer is computed with word
+ * operations: the frontier is dilated to all 8 neighbors with shifts and ORs (bits
+ * carried across word boundaries), then masked with the free and not yet visited
+ * cells. Moves match Graph: 8 directions, diagonal moves between two blocked cells
+ * allowed.
+ *
+ * Per row, a summary bitmap marks the frontier words that are non-zero, so a layer
+ * only visits the words next to the frontier instead of the whole bounding box.
+ * Rows are initialized from World::isFree when the wavefront first reaches them, so
+ * a query only pays for the rows it touches and always sees the current obstacles.
+ *
+ * Instead of a distance per cell, the search stores each visited cell's layer modulo
+ * 3 in two more bitmaps. That is enough to reconstruct a path: the predecessor of a
+ * cell in layer d is any visited neighbor in layer d - 1, and visited neighbors can
+ * only be in layers d - 1, d or d + 1.
+ *
+ * The mask initialization is a dense loop that compilers vectorize (e.g. with AVX2
+ * enabled); the wavefront works on individual words.
+ *
+ * One object keeps its bitmaps across queries and must only be used by one query at a time.
+ */
+class BitParallelBFS
+{
+private:
+    using Word = std::uint64_t;
+
+    int width = 0;                   // Width of the world the bitmaps are sized for
+    int height = 0;                  // Height of the world the bitmaps are sized for
+    int words = 0;                   // Words per row
+    int rowStride = 0;               // Words per stored row: one zero word on each side
+    int summaryWords = 0;            // Summary words per row
+    int summaryStride = 0;           // Summary words per stored row: one zero word on each side
+    std::uint32_t generation = 0;    // Current query; rows stamped with it are initialized
+    int frontierFirstRow = 0;        // First row holding frontier bits
+    int frontierLastRow = -1;        // Last row holding frontier bits (< first: empty frontier)
+
+    std::vector<std::uint32_t> rowStamps;   // Query generation that initialized each row
+    std::vector<Word> freeMask;             // Free cells
+    std::vector<Word> visited;              // Cells reached so far
+    std::vector<Word> frontier;             // Cells of the current layer
+    std::vector<Word> next;                 // Cells of the layer being built
+    std::vector<Word> layerLow;             // Bit 0 of (layer % 3) of visited cells
+    std::vector<Word> layerHigh;            // Bit 1 of (layer % 3) of visited cells
+    std::vector<Word> frontierSummary;      // Non-zero frontier words, one bit per word
+    std::vector<Word> nextSummary;          // Non-zero words of the layer being built
+
+    /**
+     * @brief Sizes the bitmaps for a world and starts a new query.
+     *
+     * @param world The world to search
+     */
+    void prepare(const World& world);
+
+    /**
+     * @brief Initializes a row for the current query (free mask from the world, empty visited bits).
+     *
+     * @param world The world to search
+     * @param row Row index
+     */
+    void ensureRow(const World& world, int row);
+
+    /**
+     * @brief Returns the index of word 'word' of row 'row' in the padded bitmaps.
+     */
+    size_t wordIndex(int row, int word) const
+    {
+        return static_cast<size_t>(row + 1) * rowStride + word + 1;
+    }
+
+    /**
+     * @brief Returns the index of summary word 'word' of row 'row' in the padded summaries.
+     */
+    size_t summaryIndex(int row, int word) const
+    {
+        return static_cast<size_t>(row + 1) * summaryStride + word + 1;
+    }
+
+    /**
+     * @brief Checks whether a cell was visited in the current query.
+     *
+     * @param x Column
+     * @param y Row
+     *
+     * @return true if the cell was reached
+     */
+    bool isVisited(int x, int y) const;
+
+    /**
+     * @brief Returns the layer modulo 3 of a visited cell.
+     *
+     * @param x Column
+     * @param y Row
+     *
+     * @return 0, 1 or 2
+     */
+    int layerMod3(int x, int y) const;
+
+    /**
+     * @brief Starts the wavefront at a source cell (layer 0).
+     *
+     * @param world The world to search
+     * @param source Source state (a free cell)
+     */
+    void start(const World& world, const State& source);
+
+    /**
+     * @brief Computes the next layer from the frontier and makes it the new frontier.
+     *
+     * @param world The world to search
+     * @param layer Index of the layer being computed (>= 1)
+     * @param visit Callable `visit(int row, int word, Word bits)` called for every
+     *              word with newly reached cells
+     *
+     * @return Number of cells in the new layer (0 when the search is exhausted)
+     */
+    template <typename Visitor>
+    size_t expandLayer(const World& world, int layer, Visitor&& visit);
+
+    /**
+     * @brief Clears the frontier so the next query starts from empty bitmaps.
+     */
+    void clearFrontier();
+
+public:
+    /**
+     * @brief Finds a shortest (fewest moves) path from start to goal.
+     *
+     * Start and goal must be free cells of the world.
+     *
+     * @param world The world to search
+     * @param start Starting state
+     * @param goal Goal state
+     * @param path Output: the path (empty if the goal is unreachable)
+     * @param reachedCells Output: number of cells reached before the goal (or all reachable cells)
+     *
+     * @return Number of moves of the path, or -1 if the goal is unreachable
+     */
+    int search(const World& world, const State& start, const State& goal, std::vector<State>& path, int& reachedCells);
+
+    /**
+     * @brief Computes the BFS layer (number of moves) of every cell reachable from a source.
+     *
+     * @param world The world to search
+     * @param source Source state
+     * @param distance Output: layer per CellId (World::getCellCount() entries), -1 if unreachable
+     *
+     * @return Largest layer reached, or -1 if the source is not a free cell
+     */
+    int computeLayers(const World& world, const State& source, std::vector<int>& distance);
+};
+
+#endif // BIT_PARALLEL_BFS_H
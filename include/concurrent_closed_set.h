@@ -0,0 +1,75 @@
+#ifndef CONCURRENT_CLOSED_SET_H
+#define CONCURRENT_CLOSED_SET_H
+
+#include "world.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class ConcurrentClosedSet
+ * @brief Closed set of one search direction that another thread may read concurrently.
+ *
+ * Used by the parallel bidirectional search: each direction publishes the cells it
+ * closes together with their final g-value, and the opposite direction checks these
+ * cells for meetings while both searches are running.
+ *
+ * Only the owning thread calls close(); any thread may call tryGetCost(). The g-value
+ * is written before the closed stamp is stored, so a reader that sees the stamp also
+ * sees the final cost. Stores and loads of the stamps are sequentially consistent,
+ * which guarantees that of two searches closing the two ends of an edge, at least
+ * one sees the other's cell as closed.
+ *
+ * Like SearchWorkspace, the set is reset in O(1) by advancing a generation counter.
+ * prepare() must not run concurrently with any other call.
+ */
+class ConcurrentClosedSet
+{
+private:
+    std::unique_ptr<std::atomic<std::uint32_t>[]> stamps;  // Generation in which each cell was closed
+    std::vector<double> costs;                              // Final g-value of each closed cell
+    size_t capacity = 0;                                    // Number of allocated cells
+    std::uint32_t generation = 0;                           // Current query generation (0 = never used)
+
+public:
+    /**
+     * @brief Starts a new query on a world with the given number of cells.
+     *
+     * @param cellCount Number of cells in the world buffer (World::getCellCount())
+     */
+    void prepare(int cellCount);
+
+    /**
+     * @brief Publishes a closed cell and its final g-value (owning thread only).
+     *
+     * @param id The cell id
+     * @param g The final cost of the cell
+     */
+    void close(CellId id, double g)
+    {
+        costs[id] = g;
+        stamps[id].store(generation, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Returns the final g-value of a cell if it has been closed.
+     *
+     * @param id The cell id
+     * @param g Output: the cell's final cost, only written if the cell is closed
+     *
+     * @return true if the cell is closed in the current query
+     */
+    bool tryGetCost(CellId id, double& g) const
+    {
+        if (stamps[id].load(std::memory_order_seq_cst) != generation)
+        {
+            return false;
+        }
+
+        g = costs[id];
+        return true;
+    }
+};
+
+#endif // CONCURRENT_CLOSED_SET_H
@@ -0,0 +1,140 @@
+#ifndef D_STAR_LITE_H
+#define D_STAR_LITE_H
+
+#include "graph.h"
+#include "state.h"
+#include "planner.h"
+#include "incremental_queue.h"
+#include <vector>
+
+/**
+ * @class DStarLite
+ * @brief Incremental replanning toward a fixed goal for an agent that moves and sees the world change.
+ *
+ * D* Lite searches backward from the goal. Every cell has a g-value (cost to the goal
+ * at its last expansion) and an rhs-value (one-step lookahead: the cheapest edge cost
+ * plus g of a neighbor). Cells with g != rhs are inconsistent and wait in a priority
+ * queue keyed by [min(g, rhs) + h(start, cell) + km, min(g, rhs)], where h is the
+ * Chebyshev distance and km accumulates the distance the start moved between repairs,
+ * so the keys already in the queue stay valid lower bounds.
+ *
+ * The search state is kept between calls. After cells change (World::setWeight),
+ * updateCells() recomputes the rhs of the changed cells and their neighbors, and
+ * replan() expands only the inconsistent cells that can affect the agent's path.
+ * The work of a repair therefore grows with the size of the change near the path,
+ * not with the size of the map. Moves and costs match Graph.
+ *
+ * The goal is fixed; a new goal needs initialize(). One object must only be used by
+ * one thread at a time, and the world must not change during replan().
+ */
+class DStarLite
+{
+private:
+    const Graph& graph;                         // The graph to search
+    State start{ 0, 0 };                        // Current position of the agent
+    State goal{ 0, 0 };                         // Goal of the search
+    CellId startCell = World::INVALID_CELL;     // Cell of start
+    CellId goalCell = World::INVALID_CELL;      // Cell of goal (INVALID_CELL until initialize() succeeds)
+    CellId lastCell = World::INVALID_CELL;      // Start cell at the previous repair (for km)
+    double km = 0.0;                            // Key modifier: distance moved by the start
+    std::vector<double> g;                      // Cost to the goal at the last expansion, per CellId
+    std::vector<double> rhs;                    // One-step lookahead cost to the goal, per CellId
+    IncrementalQueue open;                      // Inconsistent cells
+    int expanded = 0;                           // Expansions since the last replan()
+    int updated = 0;                            // rhs updates since the last replan()
+    int lastUpdateCount = 0;                    // rhs updates of the last repair
+
+    /**
+     * @brief Returns the queue key of a cell for the current start and km.
+     *
+     * @param cell The cell
+     * @return [min(g, rhs) + h + km, min(g, rhs)]
+     */
+    QueueKey calculateKey(CellId cell) const;
+
+    /**
+     * @brief Recomputes the rhs of a cell and adds it to, or removes it from, the queue.
+     *
+     * @param cell The cell (may be blocked or a sentinel cell)
+     */
+    void updateVertex(CellId cell);
+
+    /**
+     * @brief Expands inconsistent cells until the start is consistent and no queued key is below it.
+     */
+    void computeShortestPath();
+
+public:
+    /**
+     * @brief Constructs an engine for a graph.
+     *
+     * @param graph Reference to the graph (must remain valid for the object's lifetime)
+     */
+    explicit DStarLite(const Graph& graph);
+
+    DStarLite(const DStarLite&) = delete;
+    DStarLite& operator=(const DStarLite&) = delete;
+
+    /**
+     * @brief Discards the search state and prepares a search from start to goal.
+     *
+     * Sizes the per-cell arrays (O(cells)); the search itself runs in the next replan().
+     *
+     * @param start Starting state (free cell)
+     * @param goal Goal state (free cell)
+     * @return true if both states are free cells; otherwise the engine is left uninitialized
+     */
+    bool initialize(const State& start, const State& goal);
+
+    /**
+     * @brief Moves the agent to a new start state.
+     *
+     * @param newStart The new position (free cell, usually the next state of the path)
+     * @return true if the engine is initialized and the state is a free cell
+     */
+    bool moveStart(const State& newStart);
+
+    /**
+     * @brief Tells the engine which cells changed weight (or became blocked or free) since the last call.
+     *
+     * Only the rhs-values of the changed cells and their neighbors are recomputed; the
+     * repair happens in the next replan(). Cells outside the world are ignored.
+     *
+     * @param changed States of the changed cells
+     */
+    void updateCells(const std::vector<State>& changed);
+
+    /**
+     * @brief Repairs the search and returns the path from the current start to the goal.
+     *
+     * nodesExpanded counts the expansions of this repair only (the first call after
+     * initialize() runs the full initial search).
+     *
+     * @return Path, cost and statistics; success is false if the goal is unreachable or
+     *         the engine is not initialized
+     */
+    PlanResults replan();
+
+    /**
+     * @brief Returns the current start.
+     *
+     * @return Position of the agent
+     */
+    const State& getStart() const;
+
+    /**
+     * @brief Returns the goal.
+     *
+     * @return Goal state
+     */
+    const State& getGoal() const;
+
+    /**
+     * @brief Returns the number of rhs updates of the last repair (updateCells() and replan()).
+     *
+     * @return Cells whose rhs was recomputed
+     */
+    int getLastUpdateCount() const;
+};
+
+#endif // D_STAR_LITE_H
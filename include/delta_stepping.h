@@ -0,0 +1,184 @@
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include "graph.h"
+#include "state.h"
+#include "work_stealing_scheduler.h"
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @struct ShortestPathTree
+ * @brief Distances and parents of all cells from one source (single-source shortest paths).
+ *
+ * Both fields are indexed by CellId and have World::getCellCount() entries.
+ * - distance: Cost of the cheapest path from the source (SearchWorkspace::INF if unreachable)
+ * - parent: Predecessor on such a path; the source is its own parent and unreachable
+ *   cells have SearchWorkspace::NO_PARENT
+ */
+struct ShortestPathTree
+{
+    std::vector<double> distance;   // Cost from the source per CellId
+    std::vector<CellId> parent;     // Predecessor per CellId
+    int reachedCells = 0;           // Number of cells with a finite distance
+    size_t relaxations = 0;         // Edge relaxations performed
+    int buckets = 0;                // Non-empty buckets processed (delta-stepping only)
+    double executionTime = 0.0;     // Time taken (milliseconds)
+};
+
+/**
+ * @class DeltaStepping
+ * @brief Parallel single-source shortest paths over the whole grid (delta-stepping).
+ *
+ * Computes the same distances as Dijkstra run to completion (no goal), but processes
+ * cells in buckets of width delta instead of one at a time: all cells of the lowest
+ * non-empty bucket are relaxed in parallel, over and over until the bucket stays
+ * empty, before the next bucket is started. Edges costing at most delta ("light")
+ * may put cells back into the current bucket; heavier edges are relaxed once per
+ * bucket, after its cells are final.
+ *
+ * Distances are lowered with an atomic compare-and-swap minimum, so the result does
+ * not depend on the order in which threads relax edges. Parents are chosen afterwards,
+ * also in parallel: every reached cell picks the predecessor through which its distance
+ * is obtained (first in Graph's move order on ties), which makes the parent field
+ * deterministic as well.
+ *
+ * Small deltas approach Dijkstra (little parallel work per bucket, no wasted
+ * relaxations); large deltas approach Bellman-Ford (much parallel work, cells relaxed
+ * several times). By default delta is the most expensive edge of the world, which
+ * makes every edge light.
+ *
+ * Runs on its own WorkStealingScheduler. The graph and the world must not be modified
+ * while run() executes.
+ */
+class DeltaStepping
+{
+private:
+    /**
+     * @struct WorkerBuffer
+     * @brief Output of one worker during a parallel step, merged after the step.
+     */
+    struct WorkerBuffer
+    {
+        std::vector<std::pair<size_t, CellId>> inserts;  // (bucket, cell) of lowered distances
+        std::vector<CellId> settled;                     // Cells first processed in the current bucket
+        size_t relaxations = 0;                          // Edge relaxations of this worker
+        int reachedCells = 0;                            // Reached cells counted by the parent pass
+        double maxWeight = 0.0;                          // Largest cell weight seen by the init pass
+    };
+
+    const Graph& graph;                                    // The graph to search
+    double delta;                                          // Bucket width (0 = automatic)
+    WorkStealingScheduler scheduler;                       // Workers of the parallel steps
+    std::unique_ptr<std::atomic<double>[]> distances;      // Tentative distance per CellId
+    std::unique_ptr<std::atomic<std::uint32_t>[]> roundStamps;   // Last round that processed each cell
+    std::unique_ptr<std::atomic<std::uint32_t>[]> bucketStamps;  // Last bucket that settled each cell
+    size_t capacity;                                       // Cells allocated in the arrays above
+    std::vector<std::vector<CellId>> buckets;              // Cells per bucket index (may hold stale entries)
+    std::vector<CellId> current;                           // Cells of the round being processed
+    std::vector<CellId> settled;                           // Cells settled by the current bucket
+    std::vector<WorkerBuffer> buffers;                     // One per worker
+
+    /**
+     * @brief Sizes and resets the per-cell arrays and returns the automatic delta.
+     *
+     * @param cellCount Number of cells in the world buffer
+     *
+     * @return Cost of the most expensive edge of the world
+     */
+    double prepare(int cellCount);
+
+    /**
+     * @brief Relaxes the light or the heavy edges of a cell.
+     *
+     * @param cell The cell whose outgoing edges are relaxed
+     * @param bucketWidth Current delta
+     * @param light true for edges costing at most delta, false for the others
+     * @param buffer Output of the calling worker
+     */
+    void relax(CellId cell, double bucketWidth, bool light, WorkerBuffer& buffer);
+
+    /**
+     * @brief Moves the workers' inserts into the buckets and clears them.
+     */
+    void mergeInserts();
+
+    /**
+     * @brief Fills the tree from the final distances and picks every cell's parent.
+     *
+     * @param source Source cell
+     * @param tree Output tree
+     */
+    void buildTree(CellId source, ShortestPathTree& tree);
+
+public:
+    /**
+     * @brief Constructs a delta-stepping engine for a graph.
+     *
+     * @param graph Reference to the graph (must remain valid for the object's lifetime)
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit DeltaStepping(const Graph& graph, unsigned int threadCount = 0);
+
+    DeltaStepping(const DeltaStepping&) = delete;
+    DeltaStepping& operator=(const DeltaStepping&) = delete;
+
+    /**
+     * @brief Sets the bucket width.
+     *
+     * @param bucketWidth Delta in cost units (0 = most expensive edge of the world)
+     */
+    void setDelta(double bucketWidth);
+
+    /**
+     * @brief Returns the configured bucket width.
+     *
+     * @return Delta (0 = automatic)
+     */
+    double getDelta() const;
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return Worker count
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief Computes distances and parents of all cells from a source, in parallel.
+     *
+     * @param source Source state
+     *
+     * @return The shortest path tree; nothing is reached if the source is not a free cell
+     */
+    ShortestPathTree run(const State& source);
+
+    /**
+     * @brief Computes the same tree with sequential Dijkstra run to completion.
+     *
+     * Reference for run(): expands every reachable cell with an IndexedHeap, without
+     * a goal. Parents are the cells that last lowered each distance.
+     *
+     * @param source Source state
+     *
+     * @return The shortest path tree; nothing is reached if the source is not a free cell
+     */
+    ShortestPathTree runSequential(const State& source) const;
+
+    /**
+     * @brief Follows the parents of a tree from a target back to its source.
+     *
+     * @param world The world the tree was computed on
+     * @param tree Shortest path tree
+     * @param target Target state
+     *
+     * @return Path from the source to the target; empty if the target was not reached
+     */
+    static std::vector<State> extractPath(const World& world, const ShortestPathTree& tree, const State& target);
+};
+
+#endif // DELTA_STEPPING_H
@@ -0,0 +1,194 @@
+#ifndef DIRECTION_OPTIMIZING_BFS_H
+#define DIRECTION_OPTIMIZING_BFS_H
+
+#include "graph.h"
+#include "state.h"
+#include "work_stealing_scheduler.h"
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @struct BFSLayerStats
+ * @brief One step of a direction-optimizing BFS: from the cells of layer d to layer d + 1.
+ */
+struct BFSLayerStats
+{
+    int frontierSize = 0;       // Cells of layer d
+    int boxCells = 0;           // Cells in the bounding box of layer d, grown by one cell
+    bool bottomUp = false;      // true: bottom-up sweep, false: top-down expansion
+    size_t edgesChecked = 0;    // Neighbors looked at
+    double time = 0.0;          // Time taken (milliseconds)
+};
+
+/**
+ * @class DirectionOptimizingBFS
+ * @brief Parallel breadth-first search that picks the cheaper direction for every layer.
+ *
+ * Every layer is computed by one of two parallel steps:
+ * - Top-down: the frontier cells are split over the workers, which claim their
+ *   unvisited neighbors with an atomic compare-and-swap
+ * - Bottom-up: the unvisited free cells of the frontier's bounding box (grown by one
+ *   cell) are split over the workers by rows; each cell looks for a neighbor in the
+ *   frontier and stops at the first one. No compare-and-swap is needed: every cell is
+ *   written by the worker that owns its row.
+ *
+ * Top-down work grows with the frontier, bottom-up work with its bounding box. The
+ * search switches to bottom-up when the frontier fills more than 1/alpha of the box
+ * and back to top-down when it fills less than 1/beta (alpha < beta gives hysteresis).
+ * On grids this favors bottom-up for dense wavefronts: corridors, open maps whose
+ * frontier is clipped by the border, and late layers that fill the remaining area.
+ * The choice of every layer is reported in BFSLayerStats.
+ *
+ * Moves match Graph (8 directions). Only the layer of each cell is stored; a path is
+ * rebuilt from the goal by stepping to the first neighbor in Graph's move order that
+ * lies one layer lower, so the result does not depend on the thread interleaving.
+ *
+ * Runs on its own WorkStealingScheduler; small layers run on the calling thread. The
+ * graph and the world must not be modified while a search executes, and one object
+ * must only run one search at a time.
+ */
+class DirectionOptimizingBFS
+{
+private:
+    /**
+     * @struct WorkerBuffer
+     * @brief Output of one worker during a step, merged after the step.
+     */
+    struct WorkerBuffer
+    {
+        std::vector<CellId> next;   // Cells of the new layer found by this worker
+        size_t edgesChecked = 0;    // Neighbors looked at by this worker
+        int minX = 0;               // Bounding box of 'next'
+        int maxX = -1;
+        int minY = 0;
+        int maxY = -1;
+    };
+
+    const Graph& graph;                              // The graph to search
+    WorkStealingScheduler scheduler;                 // Workers of the parallel steps
+    double alpha;                                    // Switch to bottom-up above frontier/box = 1/alpha
+    double beta;                                     // Switch back to top-down below frontier/box = 1/beta
+    int sequentialLimit;                             // Steps with less work run on the calling thread
+    std::unique_ptr<std::atomic<int>[]> layerOf;     // Layer per CellId, -1 if not reached
+    size_t capacity;                                 // Cells allocated in layerOf
+    std::vector<CellId> frontier;                    // Cells of the current layer
+    std::vector<WorkerBuffer> buffers;               // One per worker
+    int minX = 0;                                    // Bounding box of the frontier, grown by one
+    int maxX = -1;                                   // cell and clipped to the grid
+    int minY = 0;
+    int maxY = -1;
+
+    /**
+     * @brief Sizes and resets the per-cell layers.
+     *
+     * @param cellCount Number of cells in the world buffer
+     */
+    void prepare(int cellCount);
+
+    /**
+     * @brief Runs the BFS from a source until the target is reached or every reachable cell is.
+     *
+     * @param source Source cell (free)
+     * @param target Cell that ends the search, or World::INVALID_CELL to reach everything
+     * @param layers Output: one entry per computed layer
+     * @param reachedCells Output: number of cells reached
+     *
+     * @return Last layer computed
+     */
+    int expand(CellId source, CellId target, std::vector<BFSLayerStats>& layers, int& reachedCells);
+
+    /**
+     * @brief Expands the frontier: workers claim the unvisited neighbors of frontier cells.
+     *
+     * @param layer Layer of the new cells
+     * @param stats Output: step statistics
+     */
+    void stepTopDown(int layer, BFSLayerStats& stats);
+
+    /**
+     * @brief Sweeps the unvisited cells of the frontier's box: each looks for a frontier neighbor.
+     *
+     * @param layer Layer of the new cells
+     * @param stats Output: step statistics
+     */
+    void stepBottomUp(int layer, BFSLayerStats& stats);
+
+    /**
+     * @brief Runs job(begin, end, worker) over [0, count), inline when the work is small.
+     *
+     * @param count Size of the range
+     * @param work Estimated number of cells touched
+     * @param job Callable `void(int begin, int end, unsigned int worker)`
+     */
+    void runStep(int count, int work, const std::function<void(int, int, unsigned int)>& job);
+
+    /**
+     * @brief Makes the workers' new cells the frontier and updates its bounding box.
+     *
+     * @param stats Output: edge checks of the step
+     */
+    void mergeNext(BFSLayerStats& stats);
+
+public:
+    /**
+     * @brief Constructs a direction-optimizing BFS for a graph.
+     *
+     * @param graph Reference to the graph (must remain valid for the object's lifetime)
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit DirectionOptimizingBFS(const Graph& graph, unsigned int threadCount = 0);
+
+    DirectionOptimizingBFS(const DirectionOptimizingBFS&) = delete;
+    DirectionOptimizingBFS& operator=(const DirectionOptimizingBFS&) = delete;
+
+    /**
+     * @brief Sets the frontier densities at which the search switches direction.
+     *
+     * Bottom-up is chosen when frontier * alpha > box cells, top-down again when
+     * frontier * beta < box cells. alpha = 0 keeps the search top-down; a huge alpha
+     * with beta = alpha keeps it bottom-up.
+     *
+     * @param toBottomUp alpha (default 14)
+     * @param toTopDown beta (default 24), at least alpha
+     */
+    void setSwitchThresholds(double toBottomUp, double toTopDown);
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return Worker count
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief Finds a shortest (fewest moves) path from start to goal.
+     *
+     * Start and goal must be free cells of the graph's world.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param path Output: the path (empty if the goal is unreachable)
+     * @param reachedCells Output: number of cells reached before the search stopped
+     * @param layers Output: one entry per computed layer
+     *
+     * @return Number of moves of the path, or -1 if the goal is unreachable
+     */
+    int search(const State& start, const State& goal, std::vector<State>& path, int& reachedCells,
+        std::vector<BFSLayerStats>& layers);
+
+    /**
+     * @brief Computes the BFS layer (number of moves) of every cell reachable from a source.
+     *
+     * @param source Source state
+     * @param distance Output: layer per CellId (World::getCellCount() entries), -1 if unreachable
+     * @param layers Output: one entry per computed layer
+     *
+     * @return Largest layer reached, or -1 if the source is not a free cell
+     */
+    int computeLayers(const State& source, std::vector<int>& distance, std::vector<BFSLayerStats>& layers);
+};
+
+#endif // DIRECTION_OPTIMIZING_BFS_H
@@ -0,0 +1,162 @@
+#ifndef DISTANCE_MATRIX_H
+#define DISTANCE_MATRIX_H
+
+#include "graph.h"
+#include "state.h"
+#include "search_workspace.h"
+#include "indexed_heap.h"
+#include "work_stealing_scheduler.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class DistanceMatrix
+ * @brief Costs of the cheapest paths between every source and every target (many-to-many).
+ *
+ * compute() runs one forward Dijkstra per source instead of one query per pair. Each
+ * search settles cells in cost order and stops as soon as every distinct target cell
+ * is settled (or nothing reachable is left), so a search costs about as much as one
+ * pairwise query to the farthest target. The searches are independent and run in
+ * parallel, one source per task, each worker with its own workspace and open list.
+ *
+ * The result is a dense row-major matrix: row i holds the costs from source i to all
+ * targets, in the order they were given. Pairs whose source or target is outside the
+ * world, blocked, or not connected have cost SearchWorkspace::INF. Duplicate targets
+ * are searched for once.
+ *
+ * Only costs are stored. getPath() finds the path of one pair on demand by repeating
+ * that source's search up to the target, which yields the same cost as the matrix.
+ *
+ * Runs on its own WorkStealingScheduler. The graph and the world must not be modified
+ * while compute() or getPath() executes, and one object must only run one of them at
+ * a time.
+ */
+class DistanceMatrix
+{
+private:
+    /**
+     * @struct Worker
+     * @brief Search state of one worker, reused for every source it processes.
+     */
+    struct Worker
+    {
+        SearchWorkspace workspace;      // g-values, parents and closed flags
+        IndexedHeap open;               // Open list
+        std::vector<double> found;      // Cost per distinct target of the current source
+        size_t settledCells = 0;        // Cells settled by this worker during compute()
+    };
+
+    const Graph& graph;                 // The graph to search
+    WorkStealingScheduler scheduler;    // Workers of the per-source searches
+    std::vector<Worker> workers;        // One per worker
+    std::vector<State> sources;         // Sources of the last compute()
+    std::vector<State> targets;         // Targets of the last compute()
+    std::vector<CellId> targetCells;    // Distinct valid target cells
+    std::vector<int> columnSlot;        // Index into targetCells per target, -1 if invalid
+    std::vector<int> targetSlot;        // Index into targetCells per CellId, -1 for other cells
+    std::vector<double> costs;          // sources.size() x targets.size(), row-major
+    size_t settledCells = 0;            // Cells settled by all searches of the last compute()
+    double executionTime = 0.0;         // Duration of the last compute() (milliseconds)
+
+    /**
+     * @brief Runs Dijkstra from a source until a stop cell or all targets are settled.
+     *
+     * Records the cost of every target settled on the way in worker.found.
+     *
+     * @param worker Search state of the calling worker
+     * @param source Source cell (free)
+     * @param stopCell Cell that ends the search, or World::INVALID_CELL to stop after all targets
+     *
+     * @return Number of cells settled
+     */
+    size_t search(Worker& worker, CellId source, CellId stopCell) const;
+
+public:
+    /**
+     * @brief Constructs a many-to-many engine for a graph.
+     *
+     * @param graph Reference to the graph (must remain valid for the object's lifetime)
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit DistanceMatrix(const Graph& graph, unsigned int threadCount = 0);
+
+    DistanceMatrix(const DistanceMatrix&) = delete;
+    DistanceMatrix& operator=(const DistanceMatrix&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return Worker count
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief Computes the costs from every source to every target, in parallel.
+     *
+     * @param sourceSet Source states (matrix rows)
+     * @param targetSet Target states (matrix columns)
+     *
+     * @return true if at least one source and one target are free cells
+     */
+    bool compute(const std::vector<State>& sourceSet, const std::vector<State>& targetSet);
+
+    /**
+     * @brief Returns the cost of one pair of the last compute().
+     *
+     * @param source Row index (position in the source set)
+     * @param target Column index (position in the target set)
+     *
+     * @return The cost, or SearchWorkspace::INF if the pair is not connected or out of range
+     */
+    double getCost(size_t source, size_t target) const;
+
+    /**
+     * @brief Returns the whole matrix of the last compute().
+     *
+     * @return getSourceCount() x getTargetCount() costs, row-major
+     */
+    const std::vector<double>& getCosts() const;
+
+    /**
+     * @brief Finds the path of one pair of the last compute().
+     *
+     * Searches again from the source on the calling thread, so the world must still be
+     * the one the matrix was computed on.
+     *
+     * @param source Row index (position in the source set)
+     * @param target Column index (position in the target set)
+     *
+     * @return Path from the source to the target; empty if they are not connected or out of range
+     */
+    std::vector<State> getPath(size_t source, size_t target);
+
+    /**
+     * @brief Returns the number of rows of the last compute().
+     *
+     * @return Source count
+     */
+    size_t getSourceCount() const;
+
+    /**
+     * @brief Returns the number of columns of the last compute().
+     *
+     * @return Target count
+     */
+    size_t getTargetCount() const;
+
+    /**
+     * @brief Returns the number of cells settled by all searches of the last compute().
+     *
+     * @return Settled cells, summed over the sources
+     */
+    size_t getSettledCells() const;
+
+    /**
+     * @brief Returns the duration of the last compute().
+     *
+     * @return Time in milliseconds
+     */
+    double getExecutionTime() const;
+};
+
+#endif // DISTANCE_MATRIX_H
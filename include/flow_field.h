@@ -0,0 +1,174 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "graph.h"
+#include "state.h"
+#include "indexed_heap.h"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class FlowField
+ * @brief Distance to the nearest of a set of goals and the best next move, for every cell.
+ *
+ * compute() runs one backward Dijkstra from all goals to completion: a cell's distance
+ * is the cost of the cheapest path from the cell to any goal, with the same edge costs
+ * as a forward search (moving into a cell costs the move multiplier times its weight).
+ * Any number of agents heading to the same goals can then follow the field with O(1)
+ * lookups instead of planning their own paths.
+ *
+ * The field is stored compactly per grid cell (no sentinel border):
+ * - the distance as a float (UNREACHABLE if no goal can be reached)
+ * - the next move as a 3-bit index into Graph's move table, 21 moves per 64-bit word
+ *
+ * Goals have distance 0 and no next move (cell weights are positive, so no other cell
+ * has distance 0). Lookups are const and may run concurrently from many threads. The
+ * field reflects the world at the last compute() or refresh(); after the world
+ * changes (World::getEpoch), refresh() recomputes it for the same goals.
+ */
+class FlowField
+{
+public:
+    static constexpr int NO_MOVE = -1;   // Move of goals, unreachable and invalid cells
+    static constexpr float UNREACHABLE = std::numeric_limits<float>::infinity();  // Distance of cells that reach no goal
+
+private:
+    static constexpr int MOVES_PER_WORD = 21;  // 3-bit moves packed per 64-bit word
+
+    const Graph& graph;                 // The graph the field is computed on
+    std::vector<State> goals;           // Valid goals of the last compute()
+    int width = 0;                      // Width of the world at the last compute()
+    int height = 0;                     // Height of the world at the last compute()
+    int reachedCells = 0;               // Cells with a finite distance
+    double buildTime = 0.0;             // Duration of the last compute() (milliseconds)
+    std::uint64_t builtEpoch = 0;       // World epoch at the last compute()
+    std::vector<float> distances;       // Distance per grid cell (y * width + x)
+    std::vector<std::uint64_t> moves;   // Next move per grid cell, 3 bits each
+    std::vector<double> cost;           // Dijkstra scratch: cost per CellId
+    std::vector<std::uint8_t> nextMove; // Dijkstra scratch: move per CellId
+    IndexedHeap open;                   // Dijkstra open list
+
+    /**
+     * @brief Returns the grid index of a state, or -1 if it lies outside the world.
+     *
+     * @param s The state
+     * @return y * width + x, or -1
+     */
+    int indexOf(const State& s) const;
+
+    /**
+     * @brief Returns the stored move of a grid index (only meaningful for reached non-goal cells).
+     *
+     * @param index Grid index
+     * @return Move index in [0, Graph::MOVE_COUNT)
+     */
+    int storedMove(int index) const
+    {
+        return static_cast<int>((moves[index / MOVES_PER_WORD] >> (3 * (index % MOVES_PER_WORD))) & 7);
+    }
+
+public:
+    /**
+     * @brief Constructs an empty field for a graph.
+     *
+     * @param graph Reference to the graph (must remain valid for the object's lifetime)
+     */
+    explicit FlowField(const Graph& graph);
+
+    /**
+     * @brief Computes the field toward a single goal.
+     *
+     * @param goal Goal state
+     * @return true if the goal is a free cell
+     */
+    bool compute(const State& goal);
+
+    /**
+     * @brief Computes the field toward the nearest of several goals.
+     *
+     * Goals outside the world or on blocked cells are ignored.
+     *
+     * @param goalSet Goal states
+     * @return true if at least one goal is a free cell
+     */
+    bool compute(const std::vector<State>& goalSet);
+
+    /**
+     * @brief Recomputes the field for the current goals if the world changed since it was computed.
+     *
+     * Goals that became blocked are dropped. Without changes it returns at once.
+     *
+     * @return true if at least one goal is still a free cell
+     */
+    bool refresh();
+
+    /**
+     * @brief Checks in O(1) whether the world changed since the field was computed.
+     *
+     * @return true if no weight changed since the last compute() or refresh()
+     */
+    bool isUpToDate() const;
+
+    /**
+     * @brief Returns the best next move of a cell.
+     *
+     * @param s The state
+     * @return Move index for Graph::getMove, or NO_MOVE for goals, unreachable and invalid cells
+     */
+    int getMove(const State& s) const;
+
+    /**
+     * @brief Returns the cell reached by following the next move.
+     *
+     * @param s The state
+     * @return The next state, or s itself if it has no move
+     */
+    State getNextState(const State& s) const;
+
+    /**
+     * @brief Returns the cost from a cell to its nearest goal.
+     *
+     * @param s The state
+     * @return The cost, or UNREACHABLE for unreachable and invalid cells
+     */
+    float getDistance(const State& s) const;
+
+    /**
+     * @brief Follows the field from a start to a goal.
+     *
+     * @param start Starting state
+     * @return Path from start to the nearest goal, or empty if no goal is reachable
+     */
+    std::vector<State> extractPath(const State& start) const;
+
+    /**
+     * @brief Returns the goals of the field.
+     *
+     * @return Valid goals of the last compute() or refresh()
+     */
+    const std::vector<State>& getGoals() const;
+
+    /**
+     * @brief Returns the number of cells that reach a goal.
+     *
+     * @return Reached cells, including the goals
+     */
+    int getReachedCells() const;
+
+    /**
+     * @brief Returns the duration of the last compute() or refresh().
+     *
+     * @return Time in milliseconds
+     */
+    double getBuildTime() const;
+
+    /**
+     * @brief Returns the memory held by the distances and moves (excluding scratch space).
+     *
+     * @return Size in bytes
+     */
+    size_t getFieldBytes() const;
+};
+
+#endif // FLOW_FIELD_H
@@ -4,6 +4,10 @@
 #include "state.h"
 #include "world.h"
 #include <vector>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
 
 /**
  * @class Graph
@@ -18,10 +22,15 @@ class Graph
 private:
     const World* world;  // Pointer to the world; Graph does not own it.
     static const std::vector<State> moves; // Possible moves including diagonals.
+    static const std::array<double, 8> moveCosts; // Cost multiplier of each entry in 'moves'
+    std::array<CellId, 8> offsets;         // CellId offset of each entry in 'moves'
+    static constexpr std::array<int, 8> oppositeMoves = { 1, 0, 3, 2, 7, 6, 5, 4 }; // Index of (-dx, -dy) for each entry in 'moves'
 
 public:
     static constexpr double DIAGONAL_COST = 1.4142; // Represents the cost multiplier for diagonal movement
     static constexpr int NOT_NEIGHBOR = -2;         // Indicates that 'to' is not a valid neighbor
+    static constexpr int MOVE_COUNT = 8;            // Number of moves (4 cardinal + 4 diagonal)
+    static constexpr double FIXED_POINT_SCALE = 1000.0; // Fixed-point units per unit of cost
 
     /**
      * @brief Constructs a graph using the given world.
@@ -30,17 +39,143 @@ public:
      */
     Graph(const World* world);
 
+    /**
+     * @brief Returns the world the graph is built on.
+     *
+     * @return Pointer to the world (not owned by the graph)
+     */
+    const World* getWorld() const;
+
+    /**
+     * @brief Returns an entry of the move table, in the order used by forEachNeighbor.
+     *
+     * @param index Move index in [0, MOVE_COUNT)
+     *
+     * @return The (dx, dy) of the move
+     */
+    static const State& getMove(int index);
+
+    /**
+     * @brief Returns the index of the move in the opposite direction.
+     *
+     * @param index Move index in [0, MOVE_COUNT)
+     *
+     * @return Index of the move (-dx, -dy)
+     */
+    static int getOppositeMove(int index)
+    {
+        return oppositeMoves[index];
+    }
+
+    /**
+     * @brief Returns the cost multiplier of a move (1 for cardinal, DIAGONAL_COST for diagonal moves).
+     *
+     * @param index Move index in [0, MOVE_COUNT)
+     *
+     * @return Multiplier applied to the weight of the cell entered
+     */
+    static double getMoveCost(int index)
+    {
+        return moveCosts[index];
+    }
+
+    /**
+     * @brief Chebyshev distance between two states, the heuristic of the searches on this graph.
+     *
+     * Admissible and consistent because every move changes x and y by at most 1 and
+     * costs at least 1 (weights are >= 1).
+     *
+     * @param a First state
+     * @param b Second state
+     *
+     * @return max(|dx|, |dy|)
+     */
+    static double chebyshevDistance(const State& a, const State& b)
+    {
+        return std::max(std::abs(a.x - b.x), std::abs(a.y - b.y));
+    }
+
+    /**
+     * @brief Returns the CellId offset of a move (cell + offset = cell after the move).
+     *
+     * @param index Move index in [0, MOVE_COUNT)
+     *
+     * @return CellId offset
+     */
+    CellId getOffset(int index) const
+    {
+        return offsets[index];
+    }
+
     /**
      * @brief Returns all valid neighboring states of a given state.
      *
      * This function generates all neighboring states (8 directions), and checks if each one is valid
      * (i.e., not blocked and within grid boundaries).
+     * Neighbors are looked up through cell id offsets, relying on the world's
+     * sentinel border instead of per-neighbor bounds checks.
+     * A state outside the grid has no neighbors.
      *
      * @param state The current state
      * @return A vector of reachable neighboring states
      */
     std::vector<State> getNeighbors(const State& state) const;
 
+    /**
+     * @brief Calls a visitor for every valid neighbor of a cell, together with the edge cost.
+     *
+     * Allocation-free alternative to getNeighbors + getCost for the search hot path:
+     * each neighbor's weight is read once and the edge cost is derived from the move
+     * direction, so no revalidation or dx/dy computation is needed.
+     * The visitor is called as `visit(CellId neighbor, double cost)`.
+     *
+     * @param cell The current cell; must be inside the grid
+     * @param visit Callable invoked for each walkable neighbor
+     */
+    template <typename Visitor>
+    void forEachNeighbor(CellId cell, Visitor&& visit) const
+    {
+        int i = 0;
+
+        for (i = 0; i < MOVE_COUNT; ++i)
+        {
+            CellId next = cell + offsets[i];
+            double weight = world->getWeight(next);
+
+            if (weight != World::BLOCK)
+            {
+                visit(next, moveCosts[i] * weight);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls a visitor for every valid predecessor of a cell, with the cost of the edge into the cell.
+     *
+     * Reverse counterpart of forEachNeighbor, used by backward searches: moving from a
+     * predecessor into 'cell' costs the move multiplier times the weight of 'cell'.
+     * The visitor is called as `visit(CellId predecessor, double cost)`.
+     *
+     * @param cell The current cell; must be a free cell inside the grid
+     * @param visit Callable invoked for each walkable predecessor
+     */
+    template <typename Visitor>
+    void forEachPredecessor(CellId cell, Visitor&& visit) const
+    {
+        double weight = world->getWeight(cell);
+        int i = 0;
+
+        for (i = 0; i < MOVE_COUNT; ++i)
+        {
+            CellId previous = cell + offsets[i];
+
+            if (world->isFree(previous))
+            {
+                visit(previous, moveCosts[i] * weight);
+            }
+        }
+    }
+
     /**
      * @brief Returns the movement cost between two adjacent states.
      *
@@ -56,6 +191,22 @@ public:
      */
     double getCost(const State& from, const State& to) const;
 
+    /**
+     * @brief Quantizes a cost to fixed-point units (fixed-point cost mode).
+     *
+     * The cost is scaled by FIXED_POINT_SCALE and rounded to the nearest integer,
+     * so the quantization error of a single edge is at most 0.5 / FIXED_POINT_SCALE.
+     * Cell weights are small bounded values and DIAGONAL_COST is fixed, so integer
+     * costs keep the search monotone and allow integer priority queues (RadixHeap).
+     *
+     * @param cost Non-negative cost
+     * @return Cost in fixed-point units
+     */
+    static double toFixedCost(double cost)
+    {
+        return std::round(cost * FIXED_POINT_SCALE);
+    }
+
     /**
      * @brief Checks if a state is valid (inside world and not blocked).
      * 
@@ -0,0 +1,61 @@
+#ifndef HELPER_THREAD_H
+#define HELPER_THREAD_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * @class HelperThread
+ * @brief One long-lived thread that runs a single job at a time for its owner.
+ *
+ * Used by the parallel bidirectional search to run the backward direction while the
+ * calling thread runs the forward one. The thread is started by the first run() and
+ * then kept until the helper is destroyed, so a query only pays for waking it up
+ * instead of creating and joining a thread.
+ *
+ * The helper is not copyable. run() and wait() must be called by one owner thread,
+ * and every run() must be followed by wait() before the next run().
+ */
+class HelperThread
+{
+private:
+    std::thread thread;                   // The helper thread (started on the first run())
+    std::mutex mutex;                     // Protects job, busy and stopping
+    std::condition_variable jobReady;     // Signalled when a job is handed over or the helper stops
+    std::condition_variable jobDone;      // Signalled when the current job has finished
+    std::function<void()> job;            // Job handed over by run()
+    bool busy = false;                    // A job was handed over and has not finished
+    bool stopping = false;                // Set by the destructor
+
+    /**
+     * @brief Main loop of the helper: runs handed-over jobs until the helper stops.
+     */
+    void loop();
+
+public:
+    HelperThread() = default;
+
+    /**
+     * @brief Stops and joins the thread (if it was started).
+     */
+    ~HelperThread();
+
+    HelperThread(const HelperThread&) = delete;
+    HelperThread& operator=(const HelperThread&) = delete;
+
+    /**
+     * @brief Starts a job on the helper thread and returns immediately.
+     *
+     * @param task The job; it must stay valid until wait() returns
+     */
+    void run(std::function<void()> task);
+
+    /**
+     * @brief Blocks until the job started by run() has finished.
+     */
+    void wait();
+};
+
+#endif // HELPER_THREAD_H
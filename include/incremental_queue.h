@@ -0,0 +1,147 @@
+#ifndef INCREMENTAL_QUEUE_H
+#define INCREMENTAL_QUEUE_H
+
+#include "world.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @struct QueueKey
+ * @brief Two-part priority of incremental searches (D* Lite, LPA*), compared lexicographically.
+ *
+ * - primary: min(g, rhs) + h (+ km in D* Lite)
+ * - secondary: min(g, rhs), breaks ties in favour of cells closer to the search root
+ */
+struct QueueKey
+{
+    double primary;     // First key component
+    double secondary;   // Tie-breaker
+
+    bool operator<(const QueueKey& other) const
+    {
+        return primary < other.primary || (primary == other.primary && secondary < other.secondary);
+    }
+};
+
+/**
+ * @class IncrementalQueue
+ * @brief Indexed 4-ary min-heap of cells with two-part keys, update and removal.
+ *
+ * Incremental searches keep their open list between repairs, and a cell's key may
+ * rise as well as fall when costs change: push() therefore moves an existing cell in
+ * either direction, and remove() takes out a cell that became consistent. Like
+ * IndexedHeap, a position array indexed by CellId locates each cell; it is sized once
+ * per world by reserve().
+ */
+class IncrementalQueue
+{
+private:
+    static constexpr int ARITY = 4;          // Number of children per node
+    static constexpr int NOT_IN_HEAP = -1;   // Position of cells that are not in the heap
+
+    /**
+     * @struct Entry
+     * @brief Heap slot holding a cell and its key.
+     */
+    struct Entry
+    {
+        QueueKey key;
+        CellId id;
+    };
+
+    std::vector<Entry> heap;        // Heap slots in 4-ary array layout
+    std::vector<int> position;      // Heap slot of each cell, or NOT_IN_HEAP
+
+    /**
+     * @brief Moves the entry at the given slot towards the root until the heap property holds.
+     *
+     * @param index Heap slot to sift up
+     */
+    void siftUp(size_t index);
+
+    /**
+     * @brief Moves the entry at the given slot towards the leaves until the heap property holds.
+     *
+     * @param index Heap slot to sift down
+     */
+    void siftDown(size_t index);
+
+public:
+    /**
+     * @brief Makes room for cell ids in [0, cellCount) and empties the heap.
+     *
+     * @param cellCount Number of cells in the world buffer (World::getCellCount())
+     */
+    void reserve(int cellCount);
+
+    /**
+     * @brief Removes all entries from the heap.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether the heap is empty.
+     *
+     * @return true if no cells are in the heap
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of cells in the heap.
+     *
+     * @return Number of entries
+     */
+    size_t size() const;
+
+    /**
+     * @brief Checks whether a cell is currently in the heap.
+     *
+     * @param id The cell id
+     * @return true if the cell is in the heap
+     */
+    bool contains(CellId id) const;
+
+    /**
+     * @brief Inserts a cell, or sets the key of a cell already in the heap (higher or lower).
+     *
+     * @param id The cell id
+     * @param key The key of the cell (smaller comes first)
+     */
+    void push(CellId id, const QueueKey& key);
+
+    /**
+     * @brief Removes a cell if it is in the heap.
+     *
+     * @param id The cell id
+     */
+    void remove(CellId id);
+
+    /**
+     * @brief Returns the cell at the top of the heap without removing it.
+     *
+     * The heap must not be empty.
+     *
+     * @return CellId with the smallest key
+     */
+    CellId top() const;
+
+    /**
+     * @brief Returns the key of the cell at the top of the heap.
+     *
+     * The heap must not be empty.
+     *
+     * @return Smallest key in the heap
+     */
+    const QueueKey& topKey() const;
+
+    /**
+     * @brief Removes and returns the cell with the smallest key.
+     *
+     * The heap must not be empty.
+     *
+     * @return CellId of the removed cell
+     */
+    CellId pop();
+};
+
+#endif // INCREMENTAL_QUEUE_H
@@ -0,0 +1,124 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include "world.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class IndexedHeap
+ * @brief Indexed 4-ary min-heap of cells keyed by CellId, with decrease-key.
+ *
+ * Every cell is stored at most once. Pushing a cell that is already in the heap
+ * lowers its priority in place (decrease-key) instead of inserting a duplicate,
+ * so the heap never holds more entries than there are live open nodes.
+ *
+ * A position array indexed by CellId records where each cell sits in the heap.
+ * It is sized once per world (see reserve()) and reset lazily: popped cells and
+ * cells left in the heap by clear() are marked as absent, so reuse across
+ * queries costs O(size of the heap) instead of O(number of cells).
+ *
+ * A 4-ary layout halves the tree height compared with a binary heap, which
+ * favours the frequent decrease-key (sift-up) operations of Dijkstra and A*.
+ * The children of a node are adjacent (64 bytes of entries), but the heap
+ * array is not aligned to them, so they may span two cache lines.
+ */
+class IndexedHeap
+{
+private:
+    static constexpr int ARITY = 4;          // Number of children per node
+    static constexpr int NOT_IN_HEAP = -1;   // Position of cells that are not in the heap
+
+    /**
+     * @struct Entry
+     * @brief Heap slot holding a cell and its priority.
+     */
+    struct Entry
+    {
+        double priority;
+        CellId id;
+    };
+
+    std::vector<Entry> heap;        // Heap slots in 4-ary array layout
+    std::vector<int> position;      // Heap slot of each cell, or NOT_IN_HEAP
+
+    /**
+     * @brief Moves the entry at the given slot towards the root until the heap property holds.
+     *
+     * @param index Heap slot to sift up
+     */
+    void siftUp(size_t index);
+
+    /**
+     * @brief Moves the entry at the given slot towards the leaves until the heap property holds.
+     *
+     * @param index Heap slot to sift down
+     */
+    void siftDown(size_t index);
+
+public:
+    /**
+     * @brief Makes room for cell ids in [0, cellCount) and empties the heap.
+     *
+     * @param cellCount Number of cells in the world buffer (World::getCellCount())
+     */
+    void reserve(int cellCount);
+
+    /**
+     * @brief Removes all entries from the heap.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether the heap is empty.
+     *
+     * @return true if no cells are in the heap
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of cells in the heap.
+     *
+     * @return Number of entries
+     */
+    size_t size() const;
+
+    /**
+     * @brief Checks whether a cell is currently in the heap.
+     *
+     * @param id The cell id
+     * @return true if the cell is in the heap
+     */
+    bool contains(CellId id) const;
+
+    /**
+     * @brief Inserts a cell, or lowers its priority if it is already in the heap.
+     *
+     * If the cell is present with a priority lower than or equal to the given one,
+     * the heap is left unchanged.
+     *
+     * @param id The cell id
+     * @param priority The priority of the cell (smaller comes first)
+     */
+    void push(CellId id, double priority);
+
+    /**
+     * @brief Returns the priority of the cell at the top of the heap.
+     *
+     * The heap must not be empty.
+     *
+     * @return Smallest priority in the heap
+     */
+    double topPriority() const;
+
+    /**
+     * @brief Removes and returns the cell with the smallest priority.
+     *
+     * The heap must not be empty.
+     *
+     * @return CellId of the removed cell
+     */
+    CellId pop();
+};
+
+#endif // INDEXED_HEAP_H
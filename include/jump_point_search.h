@@ -0,0 +1,179 @@
+#ifndef JUMP_POINT_SEARCH_H
+#define JUMP_POINT_SEARCH_H
+
+#include "world.h"
+#include "planner.h"
+#include "search_workspace.h"
+#include "indexed_heap.h"
+#include "jump_point_table.h"
+#include <vector>
+
+/**
+ * @class JumpPointSearch
+ * @brief Jump Point Search (JPS) on uniform-cost 8-connected grids.
+ *
+ * JPS is an A* variant that prunes symmetric paths: instead of pushing every
+ * neighbor, it "jumps" in straight and diagonal lines and only stops at jump
+ * points, i.e. cells with a forced neighbor (created by an adjacent obstacle)
+ * or the goal. On open maps this expands a small fraction of the cells that
+ * BFS, Dijkstra or A* touch, while returning an optimal path.
+ *
+ * Movement rules match Graph: 8 directions, diagonal moves cost DIAGONAL_COST,
+ * and diagonal moves between two blocked cells are allowed. All free cells are
+ * treated as having weight `World::FREE`, so the returned cost is the octile
+ * length of the path. The octile distance is used as heuristic.
+ *
+ * JPS+ (searchPlus) runs the same search, but replaces the line scans with
+ * lookups in a precomputed JumpPointTable.
+ *
+ * The search keeps its per-node state in a SearchWorkspace, its open list in an
+ * IndexedHeap and writes the path into a vector, all provided by the caller and
+ * reused across queries.
+ */
+class JumpPointSearch
+{
+private:
+    const World& world;  // The world to search; JumpPointSearch does not own it
+    int stride;          // Row length of the world's cell buffer
+
+    /**
+     * @brief Jumps from a cell in a fixed direction until a jump point is found.
+     *
+     * @param from Cell to jump from
+     * @param dx X component of the direction (-1, 0, 1)
+     * @param dy Y component of the direction (-1, 0, 1)
+     * @param goal Goal cell (always a jump point)
+     * @param steps Output: number of moves from 'from' to the returned cell
+     *
+     * @return The jump point, or `World::INVALID_CELL` if the jump hits an obstacle
+     */
+    CellId jump(CellId from, int dx, int dy, CellId goal, int& steps) const;
+
+    /**
+     * @brief Finds the next jump point of a cell using a precomputed table (JPS+).
+     *
+     * Besides the table's jump points, it stops at the goal when the goal lies on the
+     * line, and for diagonal moves at the cell aligned with the goal's row or column,
+     * provided those are reached before the next jump point or wall.
+     *
+     * @param from Cell to jump from
+     * @param dx X component of the direction (-1, 0, 1)
+     * @param dy Y component of the direction (-1, 0, 1)
+     * @param goal Goal state
+     * @param table Jump distances of the world
+     * @param steps Output: number of moves from 'from' to the returned cell
+     *
+     * @return The next jump point, or `World::INVALID_CELL` if there is none
+     */
+    CellId tableJump(CellId from, int dx, int dy, const State& goal, const JumpPointTable& table, int& steps) const;
+
+    /**
+     * @brief Appends the pruned successor directions of a cell reached from its parent.
+     *
+     * Natural neighbors continue the direction of arrival; forced neighbors are added
+     * where an adjacent obstacle makes the pruned move the only optimal one.
+     *
+     * @param cell The expanded cell
+     * @param parent The jump point the cell was reached from
+     * @param dirs Output array of (dx, dy) directions
+     * @param dirCount Output: number of directions in 'dirs'
+     */
+    void addPrunedDirections(CellId cell, CellId parent, int dirs[][2], int& dirCount) const;
+
+    /**
+     * @brief Expands the parent chain of jump points from goal to start into a cell-by-cell path.
+     *
+     * The path is sized once and filled back to front, without a list of jump points.
+     *
+     * @param startCell Start cell of the search
+     * @param goalCell Goal cell (closed by the search)
+     * @param workspace Search state holding the parent of every jump point
+     * @param path Output: full path with every intermediate cell
+     */
+    void expandPath(CellId startCell, CellId goalCell, const SearchWorkspace& workspace, std::vector<State>& path) const;
+
+    /**
+     * @brief A* over jump points, shared by JPS and JPS+.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param workspace Per-node search state, reset by this call
+     * @param open Open list, reset by this call
+     * @param path Output: the full cell-by-cell path (empty if there is none)
+     * @param jumpFrom Callable `CellId(CellId from, int dx, int dy, int& steps)` returning the
+     *                 next jump point in a direction, or `World::INVALID_CELL`
+     *
+     * @return PlanResults without the path
+     */
+    template <typename JumpFunction>
+    PlanResults runSearch(const State& start, const State& goal, SearchWorkspace& workspace,
+        IndexedHeap& open, std::vector<State>& path, JumpFunction jumpFrom) const;
+
+public:
+    /**
+     * @brief Constructs a jump point search on the given world.
+     *
+     * @param world Reference to the world (must remain valid for the object's lifetime)
+     */
+    explicit JumpPointSearch(const World& world);
+
+    /**
+     * @brief Octile distance between two states (exact cost on an obstacle-free uniform grid).
+     *
+     * @param a First state
+     * @param b Second state
+     *
+     * @return max(dx, dy) - min(dx, dy) + DIAGONAL_COST * min(dx, dy)
+     */
+    static double octile(const State& a, const State& b);
+
+    /**
+     * @brief Checks whether a cell reached in direction (dx, dy) has a forced neighbor.
+     *
+     * The pruning rule shared by JPS and the JPS+ table (JumpPointTable::build), so
+     * both always agree on where jump points are.
+     *
+     * @param world The world
+     * @param cell The reached cell
+     * @param dx X component of the direction of arrival
+     * @param dy Y component of the direction of arrival
+     *
+     * @return true if an adjacent obstacle forces a neighbor that pruning would skip
+     */
+    static bool hasForcedNeighbor(const World& world, CellId cell, int dx, int dy);
+
+    /**
+     * @brief Finds a shortest path from start to goal.
+     *
+     * Start and goal must be free cells.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param workspace Per-node search state, reset by this call
+     * @param open Open list, reset by this call
+     * @param path Output: the full cell-by-cell path (empty if there is none)
+     *
+     * @return PlanResults without the path; nodesExpanded counts expanded jump points
+     */
+    PlanResults search(const State& start, const State& goal, SearchWorkspace& workspace, IndexedHeap& open,
+        std::vector<State>& path) const;
+
+    /**
+     * @brief Finds a shortest path from start to goal with JPS+ (table lookups only).
+     *
+     * The table must have been built (or loaded) for this world's current obstacles.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param table Precomputed jump distances of the world
+     * @param workspace Per-node search state, reset by this call
+     * @param open Open list, reset by this call
+     * @param path Output: the full cell-by-cell path (empty if there is none)
+     *
+     * @return PlanResults without the path; nodesExpanded counts expanded jump points
+     */
+    PlanResults searchPlus(const State& start, const State& goal, const JumpPointTable& table,
+        SearchWorkspace& workspace, IndexedHeap& open, std::vector<State>& path) const;
+};
+
+#endif // JUMP_POINT_SEARCH_H
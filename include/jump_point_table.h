@@ -0,0 +1,157 @@
+#ifndef JUMP_POINT_TABLE_H
+#define JUMP_POINT_TABLE_H
+
+#include "world.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <functional>
+
+class WorkStealingScheduler;
+
+/**
+ * @class JumpPointTable
+ * @brief Precomputed per-cell jump distances for JPS+ queries on a static world.
+ *
+ * For every free cell and each of the 8 move directions (same order as Graph's
+ * moves) the table stores how far a Jump Point Search would travel from the cell:
+ * - d > 0: the next jump point is d moves away
+ * - d <= 0: there is no jump point; the cell can move -d times before hitting a wall
+ *
+ * With the table, a JPS+ query replaces all line scanning with table lookups
+ * (see JumpPointSearch::searchPlus). The table only depends on which cells are
+ * blocked, so it stays valid while weights change but must be rebuilt when
+ * obstacles change.
+ *
+ * Construction runs in three phases: horizontal distances in parallel over rows,
+ * vertical distances in parallel over columns, and the four diagonal directions
+ * concurrently (each diagonal sweep depends on the previous row). The phases run on
+ * their own threads or as jobs of a WorkStealingScheduler.
+ *
+ * Distances are stored as 16-bit values, so worlds are limited to 32767 cells per side.
+ * Tables can be saved to disk and loaded again; loading checks that the file was
+ * built for a world with the same size and obstacles. matches() repeats that check
+ * before every JPS+ query, so obstacle edits after build() or load() are never
+ * answered from stale distances.
+ */
+class JumpPointTable
+{
+public:
+    static constexpr int DIRECTION_COUNT = 8;     // Same directions as Graph::moves
+    static constexpr int MAX_SIDE = 32767;         // Largest supported width/height
+
+    static const int DX[DIRECTION_COUNT];          // X component of each direction
+    static const int DY[DIRECTION_COUNT];          // Y component of each direction
+
+private:
+    int width = 0;                     // Width of the world the table was built for
+    int height = 0;                    // Height of the world the table was built for
+    std::uint64_t fingerprint = 0;     // Hash of the world's size and blocked cells
+    std::vector<std::int16_t> table;   // DIRECTION_COUNT distances per CellId
+    std::uint64_t sourceWorldId = 0;           // Instance id of the world the table was last built or loaded for
+    std::uint64_t sourceObstacleVersion = 0;   // Obstacle version of that world at the time
+
+    /**
+     * @brief Computes a hash of the world's size and blocked cells.
+     *
+     * @param world The world
+     * @return 64-bit fingerprint
+     */
+    static std::uint64_t computeFingerprint(const World& world);
+
+    /**
+     * @brief Callable running job(begin, end) over [0, count) in parallel and returning when done.
+     */
+    using ParallelFor = std::function<void(int count, const std::function<void(int, int)>& job)>;
+
+    /**
+     * @brief Precomputes the jump distances, running each phase through the given parallelFor.
+     *
+     * @param world The world to preprocess
+     * @param parallelFor Executes the rows, columns or diagonals of a phase
+     *
+     * @return true on success, false if the world is too large for the table
+     */
+    bool buildWith(const World& world, const ParallelFor& parallelFor);
+
+public:
+    /**
+     * @brief Returns the index of a direction in the table.
+     *
+     * @param dx X component (-1, 0, 1)
+     * @param dy Y component (-1, 0, 1), not both zero
+     *
+     * @return Direction index in [0, DIRECTION_COUNT)
+     */
+    static int directionIndex(int dx, int dy);
+
+    /**
+     * @brief Precomputes the jump distances of a world.
+     *
+     * @param world The world to preprocess
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     *
+     * @return true on success, false if the world is too large for the table
+     */
+    bool build(const World& world, unsigned int threadCount = 0);
+
+    /**
+     * @brief Precomputes the jump distances as jobs of a work-stealing scheduler.
+     *
+     * @param world The world to preprocess
+     * @param scheduler Scheduler whose workers run the build phases
+     *
+     * @return true on success, false if the world is too large for the table
+     */
+    bool build(const World& world, WorkStealingScheduler& scheduler);
+
+    /**
+     * @brief Writes the table to a binary file (native byte order).
+     *
+     * @param path File to write
+     * @return true if the file was written
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Reads a table from a binary file written by save().
+     *
+     * The table is only accepted if it was built for a world with the same size
+     * and blocked cells as the given one; otherwise the current table is kept.
+     *
+     * @param path File to read
+     * @param world The world the table will be used with
+     *
+     * @return true if a matching table was loaded
+     */
+    bool load(const std::string& path, const World& world);
+
+    /**
+     * @brief Checks whether the table is valid for the current obstacles of a world.
+     *
+     * O(1) for the world the table was built or loaded for (recognized by its
+     * instance id, not its address), as long as none of its cells was blocked or
+     * freed since (World::getObstacleVersion); weight edits keep the table valid.
+     * Otherwise the obstacle fingerprint is recomputed (O(cells)); rebuilding
+     * restores the O(1) check.
+     *
+     * @param world The world
+     * @return true if the table is built and the world has the same size and blocked cells
+     */
+    bool matches(const World& world) const;
+
+    /**
+     * @brief Returns the jump distance of a cell in a direction.
+     *
+     * @param cell The cell id (a free cell of the world the table was built for)
+     * @param direction Direction index (see directionIndex)
+     *
+     * @return Distance to the next jump point (> 0) or minus the distance to the wall (<= 0)
+     */
+    int getDistance(CellId cell, int direction) const
+    {
+        return table[static_cast<size_t>(cell) * DIRECTION_COUNT + direction];
+    }
+};
+
+#endif // JUMP_POINT_TABLE_H
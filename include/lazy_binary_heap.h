@@ -0,0 +1,75 @@
+#ifndef LAZY_BINARY_HEAP_H
+#define LAZY_BINARY_HEAP_H
+
+#include "world.h"
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+/**
+ * @class LazyBinaryHeap
+ * @brief Binary min-heap open list with lazy deletion (OpenListType::BinaryHeap).
+ *
+ * Every push inserts a new entry, also for cells already queued; outdated
+ * entries are recognised as closed nodes when they are popped.
+ *
+ * The heap works like std::priority_queue (same sift order, so ties are popped
+ * in the same order), but clear() keeps the allocated storage, so a heap reused
+ * across queries stops allocating once it has grown to the largest open list.
+ */
+class LazyBinaryHeap
+{
+private:
+    using Entry = std::pair<double, CellId>;  // (priority, cell)
+
+    /**
+     * @struct Compare
+     * @brief Heap order: entries with smaller priority come first.
+     */
+    struct Compare
+    {
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            return a.first > b.first;
+        }
+    };
+
+    std::vector<Entry> entries;  // Heap-ordered entries
+
+public:
+    /**
+     * @brief Removes all entries, keeping the allocated storage.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether the heap has no entries.
+     *
+     * @return true if empty
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of entries, including outdated ones.
+     *
+     * @return Entry count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Inserts an entry for a cell.
+     *
+     * @param id The cell id
+     * @param priority The entry's priority
+     */
+    void push(CellId id, double priority);
+
+    /**
+     * @brief Removes and returns the cell of the entry with the smallest priority.
+     *
+     * @return The cell id (the heap must not be empty)
+     */
+    CellId pop();
+};
+
+#endif // LAZY_BINARY_HEAP_H
@@ -0,0 +1,143 @@
+#ifndef LPA_STAR_H
+#define LPA_STAR_H
+
+#include "world.h"
+#include "graph.h"
+#include "state.h"
+#include "planner.h"
+#include "d_star_lite.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @struct RepairStats
+ * @brief Work done by one LPA* repair, optionally next to a fresh search for the same pair.
+ *
+ * - changedCells: Cells reported by the world since the previous repair
+ * - nodesExpanded / nodesUpdated: Expansions and rhs updates of the repair
+ * - freshExpanded / freshTime / freshCost: Expansions, time and path cost of a fresh A*
+ *   query (Planner::plan) on the same world; -1, 0 and 0 unless LPAStar::setCompareWithFresh(true)
+ */
+struct RepairStats
+{
+    int changedCells = 0;         // Cells changed since the previous repair
+    int nodesExpanded = 0;        // Expansions of the repair
+    int nodesUpdated = 0;         // rhs updates of the repair
+    double executionTime = 0.0;   // Time of the repair (milliseconds)
+    int freshExpanded = -1;       // Expansions of a fresh A* (-1 = not compared)
+    double freshTime = 0.0;       // Time of the fresh A* (milliseconds)
+    double freshCost = 0.0;       // Path cost of the fresh A* (0 if no path)
+};
+
+/**
+ * @class LPAStar
+ * @brief Lifelong Planning A*: the shortest path of a fixed (start, goal) pair under changing cell costs.
+ *
+ * The planner registers itself as a weight listener of the world and collects the
+ * cells changed through World::setWeight and World::clearGrid. replan() feeds them to
+ * the incremental search and re-expands only the cells whose cost to the goal can
+ * change, returning the same path cost as a fresh search.
+ *
+ * LPA* is D* Lite with a start that never moves, so the search itself is a DStarLite
+ * (searching backward from the goal); this class binds it to the pair and the world's
+ * notifications and keeps per-repair statistics. With setCompareWithFresh(true) every
+ * repair also runs a fresh A* through Planner::plan and records its expansions.
+ *
+ * The world must outlive the planner, and neither may be used from several threads.
+ */
+class LPAStar
+{
+private:
+    World& world;                         // World that notifies the planner
+    DStarLite search;                     // Incremental search, with a fixed start
+    Planner planner;                      // Fresh searches for comparison
+    State start{ 0, 0 };                  // Bound start
+    State goal{ 0, 0 };                   // Bound goal
+    bool bound = false;                   // A valid pair is bound
+    bool compareWithFresh = false;        // Run a fresh A* with every repair
+    int listenerId = -1;                  // Id of the world listener
+    std::vector<State> changed;           // Cells changed since the previous repair
+    std::vector<std::uint8_t> isChanged;  // Per CellId: already in 'changed'
+    RepairStats lastRepair;               // Statistics of the last repair
+    int repairCount = 0;                  // Repairs since bind()
+
+    /**
+     * @brief Records a changed cell (world listener).
+     *
+     * @param cell The changed cell
+     */
+    void onWeightChanged(const State& cell);
+
+public:
+    /**
+     * @brief Constructs a planner for a world and registers it as a weight listener.
+     *
+     * @param world The world (must outlive the planner)
+     * @param graph The graph on that world
+     */
+    LPAStar(World& world, const Graph& graph);
+
+    /**
+     * @brief Unregisters the planner from the world.
+     */
+    ~LPAStar();
+
+    LPAStar(const LPAStar&) = delete;
+    LPAStar& operator=(const LPAStar&) = delete;
+
+    /**
+     * @brief Binds the planner to a (start, goal) pair and discards earlier search state.
+     *
+     * The initial search runs in the first replan().
+     *
+     * @param newStart Starting state (free cell)
+     * @param newGoal Goal state (free cell)
+     * @return true if both states are free cells
+     */
+    bool bind(const State& newStart, const State& newGoal);
+
+    /**
+     * @brief Applies the changes collected since the last call and returns the shortest path.
+     *
+     * @return Path, cost and statistics of the repair; success is false if no pair is
+     *         bound or the goal is unreachable
+     */
+    PlanResults replan();
+
+    /**
+     * @brief Returns the number of changed cells waiting for the next replan().
+     *
+     * @return Pending changed cells (0 if the last path is still up to date)
+     */
+    size_t getPendingChanges() const;
+
+    /**
+     * @brief Enables a fresh A* next to every repair, to compare the work done.
+     *
+     * @param enabled true to compare (doubles the time of a repair)
+     */
+    void setCompareWithFresh(bool enabled);
+
+    /**
+     * @brief Checks whether repairs are compared with fresh searches.
+     *
+     * @return true if enabled
+     */
+    bool getCompareWithFresh() const;
+
+    /**
+     * @brief Returns the statistics of the last replan().
+     *
+     * @return RepairStats of the last repair
+     */
+    const RepairStats& getLastRepair() const;
+
+    /**
+     * @brief Returns the number of replan() calls since bind().
+     *
+     * @return Repair count (the first one is the initial search)
+     */
+    int getRepairCount() const;
+};
+
+#endif // LPA_STAR_H
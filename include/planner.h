@@ -3,8 +3,17 @@
 
 #include "graph.h"
 #include "state.h"
+#include "planner_context.h"
+#include "jump_point_table.h"
+#include "thread_pool.h"
+#include "work_stealing_scheduler.h"
+#include "direction_optimizing_bfs.h"
+#include "search_limits.h"
+#include "anytime_astar.h"
 #include <vector>
-#include <unordered_map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 
 /**
  * @enum SearchType
@@ -13,12 +22,104 @@
  * - BFS: Unweighted breadth-first search (ignores edge weights)
  * - Dijkstra: Weighted shortest path search based on accumulated cost
  * - AStar: Weighted search using accumulated cost + heuristic (f = g + h)
+ * - JPS: Jump Point Search; A* on uniform-cost grids (cell weights ignored) with symmetry pruning
+ * - JPSPlus: JPS with jump distances looked up in a precomputed JumpPointTable
+ * - BidirectionalDijkstra: Dijkstra from start and backward from goal, meeting in the middle
+ * - BidirectionalAStar: bidirectional search guided by averaged (consistent) potentials
  */
 enum class SearchType
 {
     BFS,
     Dijkstra,
-    AStar
+    AStar,
+    JPS,
+    JPSPlus,
+    BidirectionalDijkstra,
+    BidirectionalAStar
+};
+
+/**
+ * @enum SearchEngine
+ * @brief Specifies how the Planner stores per-node search state.
+ *
+ * - Hashed: g-values, parents and closed/visited sets in std::unordered_map / std::unordered_set
+ * - Dense: flat arrays indexed by CellId with generation stamps (see SearchWorkspace)
+ *
+ * Both engines return identical results; Dense avoids hashing and per-node allocations.
+ */
+enum class SearchEngine
+{
+    Hashed,
+    Dense
+};
+
+/**
+ * @enum OpenListType
+ * @brief Specifies the priority queue used as open list by Dijkstra and A*.
+ *
+ * - BinaryHeap: binary heap with lazy deletion (LazyBinaryHeap); an improved g-value pushes a
+ *   duplicate entry and outdated entries are skipped when popped (stale pops)
+ * - IndexedHeap: indexed 4-ary heap with decrease-key; each cell is queued at most once
+ * - RadixHeap: monotone radix heap over fixed-point integer costs (see Graph::toFixedCost);
+ *   edge costs are quantized, so the returned path is optimal up to the quantization
+ *   tolerance (see Planner::withinQuantizationTolerance)
+ */
+enum class OpenListType
+{
+    BinaryHeap,
+    IndexedHeap,
+    RadixHeap
+};
+
+/**
+ * @enum BidirectionalMode
+ * @brief Specifies how the bidirectional searches run their two directions.
+ *
+ * - Sequential: one thread alternates between the forward and the backward search
+ * - Parallel: the forward search runs on the calling thread and the backward search
+ *   on a second thread; both share a lock-free best meeting cost
+ *
+ * Both modes return optimal paths of the same cost.
+ */
+enum class BidirectionalMode
+{
+    Sequential,
+    Parallel
+};
+
+/**
+ * @enum BatchScheduler
+ * @brief Specifies how Planner::planBatch distributes queries over its workers.
+ *
+ * - SharedQueue: chunks of queries in one FIFO queue of a ThreadPool
+ * - WorkStealing: contiguous blocks of chunks per worker deque; idle workers steal
+ *   chunks from busy ones (see WorkStealingScheduler), which keeps all workers busy
+ *   when a few queries are much more expensive than the rest
+ */
+enum class BatchScheduler
+{
+    SharedQueue,
+    WorkStealing
+};
+
+/**
+ * @enum BFSMode
+ * @brief Specifies how SearchType::BFS expands its layers.
+ *
+ * - Queue: FIFO queue of cells, one neighbor at a time, with the storage of the SearchEngine
+ * - BitParallel: wavefront over 64-bit bitmaps of the free and visited cells, 64 cells per
+ *   word operation (see BitParallelBFS); fastest on large open maps
+ * - DirectionOptimizing: parallel layers, each computed top-down from the frontier or
+ *   bottom-up from the unvisited cells (see DirectionOptimizingBFS); the choice of every
+ *   layer is reported in PlanResults::bfsLayers
+ *
+ * All modes return paths with the same number of moves.
+ */
+enum class BFSMode
+{
+    Queue,
+    BitParallel,
+    DirectionOptimizing
 };
 
 /**
@@ -47,14 +148,37 @@ enum class SearchType
  * - Optimal goal extraction confirms the returned path is the shortest valid path.
  *
  * The `nodesExpanded` value remains useful for comparing efficiency across algorithms.
+ *
+ * Open list statistics (Dijkstra/A*):
+ * - stalePops: Entries popped from the open list that referred to an already closed node
+ * - peakOpenSize: Largest number of entries held by the open list during the search
+ *
+ * Direction-optimizing BFS (BFSMode::DirectionOptimizing):
+ * - bfsLayers: Frontier size, direction, edge checks and time of every layer
+ *
+ * Limited queries (SearchLimits, Dijkstra and A* only):
+ * - truncated: The search stopped before it reached the goal or exhausted the reachable
+ *   cells. path then leads from the start to the expanded node with the lowest heuristic
+ *   value (closest to the goal) and totalCost is the cost of that partial path.
+ * - stopReason: Which limit stopped the search (SearchStop::Completed if none)
+ *
+ * Nearest-goal queries (Planner::planToNearest):
+ * - reachedGoal: Position of the reached goal in the goal set; single-goal Dijkstra/A*
+ *   queries set it to 0 on success. -1 if no goal was reached.
  */
 struct PlanResults
 {
     std::vector<State> path;           // Computed path from start to goal
-    bool success;                       // True if a valid path exists
-    double totalCost;                   // Total cost of the path
-    double executionTime;               // Time taken (milliseconds)
-    int nodesExpanded;                  // Number of nodes expanded during the search
+    bool success = false;               // True if a valid path exists
+    double totalCost = 0.0;             // Total cost of the path
+    double executionTime = 0.0;         // Time taken (milliseconds)
+    int nodesExpanded = 0;              // Number of nodes expanded during the search
+    int stalePops = 0;                  // Open list entries skipped because the node was already closed
+    int peakOpenSize = 0;               // Maximum number of entries in the open list
+    std::vector<BFSLayerStats> bfsLayers = {}; // Per-layer statistics of the direction-optimizing BFS
+    int reachedGoal = -1;               // Index of the goal reached (nearest-goal queries)
+    bool truncated = false;             // Stopped early by a SearchLimits; path is partial
+    SearchStop stopReason = SearchStop::Completed; // Limit that stopped the search
 
     // correctness verification 
     bool monotonicityVerified = true;   // Dijkstra: nodes extracted in non-decreasing cost
@@ -62,6 +186,40 @@ struct PlanResults
     bool optimalGoalExtraction = true;  // Goal was reached optimally
 };
 
+/**
+ * @struct PlanQuery
+ * @brief A single (start, goal) query of a batch (see Planner::planBatch).
+ */
+struct PlanQuery
+{
+    State start;                           // Starting state
+    State goal;                            // Goal state
+    SearchType type = SearchType::AStar;   // Search algorithm to use
+};
+
+/**
+ * @struct BatchResults
+ * @brief Results and timing statistics of a batch of queries.
+ *
+ * - results: One PlanResults per query, in the order of the input batch
+ * - wallTime: Time from submitting the first query until the last one finished (milliseconds)
+ * - throughput: Answered queries per second of wall time
+ * - latencyP50 / latencyP90 / latencyP99 / latencyMax: Percentiles of the per-query
+ *   execution times (PlanResults::executionTime, milliseconds)
+ * - workerStats: Tasks, steals and busy time of every worker (BatchScheduler::WorkStealing only)
+ */
+struct BatchResults
+{
+    std::vector<PlanResults> results;  // Results in input order
+    double wallTime = 0.0;             // Total wall-clock time (milliseconds)
+    double throughput = 0.0;           // Queries per second
+    double latencyP50 = 0.0;           // Median query time (milliseconds)
+    double latencyP90 = 0.0;           // 90th percentile query time (milliseconds)
+    double latencyP99 = 0.0;           // 99th percentile query time (milliseconds)
+    double latencyMax = 0.0;           // Slowest query time (milliseconds)
+    std::vector<WorkStealingScheduler::WorkerStats> workerStats;  // Per-worker load (work stealing)
+};
+
 /**
  * @class Planner
  * @brief Computes a path between two states using graph search algorithms.
@@ -76,25 +234,30 @@ struct PlanResults
  * - Reconstruct the final path
  *
  * The Planner does not modify the Graph and does not handle simulation or agent logic.
+ * All mutable search state lives in a PlannerContext. plan() without a context uses
+ * the Planner's own context, so those calls must not run concurrently. Queries that
+ * pass their own context (e.g. PlannerContext::forThisThread()) may run concurrently
+ * on the same Planner, as long as its settings are not changed meanwhile. planBatch()
+ * runs queries on a pool of workers, each with its thread's context.
  */
 class Planner
 {
 private:
-    const Graph& graph; // The graph representing the world
-
-    /**
-     * @struct PQCompare
-     * @brief Comparison operator function for priority queue (used in Dijkstra/A*).
-     *
-     * States with smaller priority (cost) come first.
-     */
-    struct PQCompare 
-    {
-        bool operator()(const std::pair<double, State>& a, const std::pair<double, State>& b) const
-        {
-            return a.first > b.first;
-        }
-    };
+    const Graph& graph;                  // The graph representing the world
+    SearchEngine engine;                 // Storage used for per-node search state
+    OpenListType openList;               // Priority queue used by Dijkstra/A*
+    mutable PlannerContext context;      // Search state of plan() calls without an explicit context
+    BidirectionalMode bidirectionalMode; // Sequential or two-thread bidirectional search
+    BFSMode bfsMode;                     // Queue, bit-parallel or direction-optimizing BFS
+    unsigned int bfsThreads;             // Worker count of the direction-optimizing BFS (0 = hardware concurrency)
+    mutable std::unique_ptr<DirectionOptimizingBFS> parallelBfs; // Direction-optimizing BFS, created on first use
+    mutable std::mutex parallelBfsMutex; // Serializes queries on parallelBfs
+    const JumpPointTable* jumpTable;     // Precomputed jump distances for JPS+ (not owned, may be null)
+    unsigned int batchThreads;           // Worker count of planBatch (0 = hardware concurrency)
+    size_t goalFieldThreshold;           // Nearest-goal A* over more goals uses a goal distance field
+    BatchScheduler batchScheduler;       // How planBatch distributes queries
+    std::unique_ptr<ThreadPool> batchPool;              // Workers of planBatch, created on first use
+    std::unique_ptr<WorkStealingScheduler> batchStealer; // Work-stealing workers of planBatch
 
     /**
      * @brief Estimates cost from one state to another using Chebyshev distance.
@@ -113,13 +276,35 @@ private:
      * @brief Executes Breadth-First Search (BFS) from start to goal.
      *
      * Expands states in increasing order of depth (unweighted search).
+     * Dispatches to searchBFS with the storage of the selected SearchEngine, to the
+     * context's BitParallelBFS with BFSMode::BitParallel, or to the planner's shared
+     * DirectionOptimizingBFS with BFSMode::DirectionOptimizing (one query at a time).
      *
      * @param start Starting state
      * @param goal Goal state
+     * @param context Reusable search state of this query
      * 
-     * @return PlanResults containing path, success, total cost, execution time and nodesExpanded
+     * @return PlanResults containing success, total cost and nodesExpanded; the path is left in context.path
+     */
+    PlanResults runBFS(const State& start, const State& goal, PlannerContext& context) const;
+
+    /**
+     * @brief BFS implementation, generic over the per-node storage.
+     *
+     * The store must provide the SearchWorkspace interface
+     * (isSeen, getCost, getParent, update, isClosed, close), keyed by CellId.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param store Per-node search state, empty for this query
+     * @param frontier Reusable FIFO storage, cleared by this call
+     * @param path Output: the path (left empty if there is none)
+     *
+     * @return PlanResults containing success, total cost and nodesExpanded
      */
-    PlanResults runBFS(const State& start, const State& goal) const;
+    template <typename Store>
+    PlanResults searchBFS(const State& start, const State& goal, Store& store, std::vector<CellId>& frontier,
+        std::vector<State>& path) const;
 
     /**
      * @brief Executes a weighted search algorithm (Dijkstra or A*).
@@ -128,14 +313,78 @@ private:
      * - A*: Expands nodes based on g + heuristic (f-value)
      *
      * Tracks parents for path reconstruction and priority queue for state ordering.
+     * Dispatches to searchWeighted with the storage of the selected SearchEngine.
      *
      * @param start Starting state
      * @param goal Goal state
      * @param type SearchType::Dijkstra or SearchType::AStar
+     * @param context Reusable search state of this query
      * 
-     * @return PlanResults containing path, success, total cost, execution time and nodesExpanded
+     * @return PlanResults containing success, total cost and nodesExpanded; the path is left in context.path
+     */
+    PlanResults runWeightedSearch(const State& start, const State& goal, SearchType type, PlannerContext& context) const;
+
+    /**
+     * @brief Executes a weighted search (Dijkstra or A*) toward the nearest of several goals.
+     *
+     * Marks the free goals in the context and runs searchWeighted with a goal set: the
+     * search stops at the first goal it settles, which is the nearest one. A* estimates
+     * the Chebyshev distance to the closest goal, by scanning the goals or, for more
+     * than goalFieldThreshold goals, by a lookup in a distance field computed once per
+     * query.
+     *
+     * @param start Starting state
+     * @param goals Goal states; invalid and blocked ones are ignored
+     * @param type SearchType::Dijkstra or SearchType::AStar
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults with reachedGoal set; the path is left in context.path
      */
-    PlanResults runWeightedSearch(const State& start, const State& goal, SearchType type) const;
+    PlanResults runNearestSearch(const State& start, const std::vector<State>& goals, SearchType type,
+        PlannerContext& context) const;
+
+    /**
+     * @brief Runs the weighted search with the open list selected by OpenListType.
+     *
+     * @param start Starting state
+     * @param goal Goal test and heuristic (single goal or goal set)
+     * @param type SearchType::Dijkstra or SearchType::AStar
+     * @param store Per-node search state, empty for this query
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults of searchWeighted
+     */
+    template <typename Goal, typename Store>
+    PlanResults runWithOpenList(const State& start, const Goal& goal, SearchType type, Store& store,
+        PlannerContext& context) const;
+
+    /**
+     * @brief Dijkstra / A* implementation, generic over the goal, the per-node storage, the
+     * open list and the cost model.
+     *
+     * The goal must provide `find(CellId)` (index of the goal at a cell, -1 for other cells)
+     * and `estimate(CellId)` (admissible, consistent heuristic); the search ends at the
+     * first goal cell it settles.
+     * Before every expansion the search checks the limits; when one is hit it returns the
+     * path to the expanded node with the lowest estimate, marked as truncated.
+     * The open list must provide `push(CellId, double)`, `pop()`, `empty()` and `size()`.
+     * The cost model maps edge costs and heuristic values into the units used by the
+     * search (exact doubles, or fixed-point integers for the RadixHeap).
+     *
+     * @param start Starting state
+     * @param goal Goal test and heuristic (single goal or goal set)
+     * @param type SearchType::Dijkstra or SearchType::AStar
+     * @param store Per-node search state, empty for this query
+     * @param open Empty priority queue of cells
+     * @param limits Budget of the query
+     * @param path Output: the path (left empty if there is none)
+     *
+     * @return PlanResults containing success, total cost, nodesExpanded, reachedGoal, open list statistics,
+     * truncation and correctness flags
+     */
+    template <typename CostModel, typename Goal, typename Store, typename OpenList>
+    PlanResults searchWeighted(const State& start, const Goal& goal, SearchType type, Store& store, OpenList& open,
+        const SearchLimits& limits, std::vector<State>& path) const;
 
     /**
      * @brief Executes Dijkstra's shortest path search.
@@ -144,10 +393,11 @@ private:
      *
      * @param start Starting state
      * @param goal Goal state
+     * @param context Reusable search state of this query
      * 
-     * @return PlanResults containing path, success, total cost, execution time and nodesExpanded
+     * @return PlanResults containing success, total cost and nodesExpanded; the path is left in context.path
      */
-    PlanResults runDijkstra(const State& start, const State& goal) const;
+    PlanResults runDijkstra(const State& start, const State& goal, PlannerContext& context) const;
 
     /**
      * @brief Executes A* search algorithm.
@@ -156,32 +406,266 @@ private:
      *
      * @param start Starting state
      * @param goal Goal state
+     * @param context Reusable search state of this query
      * 
-     * @return PlanResults containing path, success, total cost, execution time and nodesExpanded 
+     * @return PlanResults containing success, total cost and nodesExpanded; the path is left in context.path 
+     */
+    PlanResults runAStar(const State& start, const State& goal, PlannerContext& context) const;
+
+    /**
+     * @brief Executes a bidirectional Dijkstra or A* search.
+     *
+     * A forward search from start and a backward search from goal (over reversed edges)
+     * alternate, always expanding the side with the smaller top key. Whenever an edge
+     * reaches a cell seen by the opposite side, the best meeting cost mu is updated.
+     * The search stops once topForward + topBackward >= mu (+ h(start, goal) for A*),
+     * which guarantees that mu is optimal.
+     *
+     * Bidirectional A* uses the averaged potentials
+     * pF(v) = (h(v, goal) - h(v, start) + h(start, goal)) / 2 and pB(v) = h(start, goal) - pF(v),
+     * which keep both directions consistent with each other.
+     *
+     * Always uses the dense workspaces and indexed open lists. With
+     * BidirectionalMode::Parallel this dispatches to runParallelBidirectional, except
+     * on planBatch workers (PlannerContext::batchWorker).
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type SearchType::BidirectionalDijkstra or SearchType::BidirectionalAStar
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults with nodesExpanded of both directions; the stitched path is left in context.path
+     */
+    PlanResults runBidirectional(const State& start, const State& goal, SearchType type, PlannerContext& context) const;
+
+    /**
+     * @brief Executes a bidirectional search with both directions on separate threads.
+     *
+     * The forward search runs on the calling thread, the backward search on the
+     * context's helper thread, which is started by the first parallel query and then
+     * reused. Each direction publishes its closed cells (ConcurrentClosedSet) and the
+     * key at the top of its open list. When a direction relaxes an edge into a cell
+     * closed by the opposite side, it offers the path cost through that edge to the
+     * shared best meeting cost mu (an atomic minimum, no locks).
+     *
+     * A direction stops once its top key plus the last published top key of the other
+     * direction reaches mu (+ h(start, goal) for A*). Published keys only grow, so a
+     * stale value can only delay the stop, never end the search early.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type SearchType::BidirectionalDijkstra or SearchType::BidirectionalAStar
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults with nodesExpanded of both directions; the stitched path is left in context.path
      */
-    PlanResults runAStar(const State& start, const State& goal) const;
+    PlanResults runParallelBidirectional(const State& start, const State& goal, SearchType type, PlannerContext& context) const;
+
+    /**
+     * @brief Executes Jump Point Search (see JumpPointSearch).
+     *
+     * Always uses the dense workspace and the indexed open list, regardless of
+     * the selected SearchEngine and OpenListType.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults with nodesExpanded counting jump points; the full path is left in context.path
+     */
+    PlanResults runJPS(const State& start, const State& goal, PlannerContext& context) const;
+
+    /**
+     * @brief Executes JPS+ with the table set by setJumpPointTable.
+     *
+     * Falls back to online JPS when no table is set or the table was built for
+     * a world of different size.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults with nodesExpanded counting jump points; the full path is left in context.path
+     */
+    PlanResults runJPSPlus(const State& start, const State& goal, PlannerContext& context) const;
 
     /**
      * @brief Reconstructs the path from goal to start using parent mapping.
      *
-     * Traverses the parent map generated during search and builds the final path.
+     * Traverses the parent links stored during search and builds the final path.
      *
      * @param start Starting state
      * @param goal Goal state
-     * @param parents Map of child -> parent states
-     * 
-     * @return Vector of states representing the reconstructed path; empty if no path
+     * @param store Per-node search state holding child -> parent links
+     * @param path Output: states from start to goal; empty if no path
      */
-    std::vector<State> reconstructPath(const State& start, const State& goal,
-        const std::unordered_map<State, State>& parents) const;
+    template <typename Store>
+    void reconstructPath(const State& start, const State& goal, const Store& store, std::vector<State>& path) const;
+
+    /**
+     * @brief Reconstructs the path of a bidirectional search by stitching both halves.
+     *
+     * The two searches meet on the edge (meetForward, meetBackward), which may be a single
+     * cell (meetForward == meetBackward). The forward half follows forward parents from
+     * meetForward back to start; the backward half follows backward parents (successors
+     * towards the goal) from meetBackward to goal.
+     *
+     * @param start Starting state
+     * @param meetForward Last cell of the forward half
+     * @param meetBackward First cell of the backward half
+     * @param goal Goal state
+     * @param forward Forward search state
+     * @param backward Backward search state
+     * @param path Output: states from start to goal
+     */
+    void reconstructPath(const State& start, CellId meetForward, CellId meetBackward, const State& goal,
+        const SearchWorkspace& forward, const SearchWorkspace& backward, std::vector<State>& path) const;
+
+    /**
+     * @brief Runs one query and measures its execution time.
+     *
+     * Resets the context's arena and path, stores the limits in the context, then
+     * dispatches to the selected algorithm. The path is left in context.path; the
+     * returned PlanResults has an empty path.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type Search algorithm to use
+     * @param limits Budget of the query
+     * @param context Reusable search state of this query
+     *
+     * @return PlanResults without the path
+     */
+    PlanResults runQuery(const State& start, const State& goal, SearchType type, const SearchLimits& limits,
+        PlannerContext& context) const;
 
 public:
     /**
      * @brief Constructs a Planner using a given graph.
      *
      * @param graph Reference to the Graph (must remain valid for Planner's lifetime)
+     * @param engine Storage used for per-node search state (default: Dense)
+     */
+    Planner(const Graph& graph, SearchEngine engine = SearchEngine::Dense);
+
+    /**
+     * @brief Selects the storage used for per-node search state.
+     *
+     * @param engine SearchEngine::Hashed or SearchEngine::Dense
+     */
+    void setEngine(SearchEngine engine);
+
+    /**
+     * @brief Returns the storage used for per-node search state.
+     *
+     * @return The selected SearchEngine
+     */
+    SearchEngine getEngine() const;
+
+    /**
+     * @brief Selects the priority queue used by Dijkstra and A*.
+     *
+     * @param openList OpenListType::BinaryHeap, OpenListType::IndexedHeap or OpenListType::RadixHeap
+     */
+    void setOpenList(OpenListType openList);
+
+    /**
+     * @brief Returns the priority queue used by Dijkstra and A*.
+     *
+     * @return The selected OpenListType
+     */
+    OpenListType getOpenList() const;
+
+    /**
+     * @brief Selects whether bidirectional searches run their directions on one or two threads.
+     *
+     * @param mode BidirectionalMode::Sequential or BidirectionalMode::Parallel
+     */
+    void setBidirectionalMode(BidirectionalMode mode);
+
+    /**
+     * @brief Returns how bidirectional searches run their directions.
+     *
+     * @return The selected BidirectionalMode
+     */
+    BidirectionalMode getBidirectionalMode() const;
+
+    /**
+     * @brief Selects how SearchType::BFS expands its layers.
+     *
+     * @param mode BFSMode::Queue or BFSMode::BitParallel
+     */
+    void setBFSMode(BFSMode mode);
+
+    /**
+     * @brief Returns how SearchType::BFS expands its layers.
+     *
+     * @return The selected BFSMode
+     */
+    BFSMode getBFSMode() const;
+
+    /**
+     * @brief Sets the number of worker threads of the direction-optimizing BFS.
+     *
+     * Takes effect on the next query; existing workers of another count are replaced.
+     *
+     * @param threadCount Number of workers (0 = hardware concurrency)
+     */
+    void setBFSThreads(unsigned int threadCount);
+
+    /**
+     * @brief Sets from how many goals on nearest-goal A* uses a goal distance field.
+     *
+     * Up to this many goals the heuristic scans all goals (O(goals) per estimate);
+     * beyond it, a Chebyshev distance field to the goal set is computed once per query
+     * (O(cells)) and every estimate is a lookup. Both give the same heuristic values.
+     *
+     * @param goalCount Largest goal count that is scanned (default: 64)
+     */
+    void setGoalFieldThreshold(size_t goalCount);
+
+    /**
+     * @brief Sets the precomputed jump distances used by SearchType::JPSPlus.
+     *
+     * The table must be built for the graph's world and stay valid while it is set.
+     *
+     * @param table Pointer to the table (not owned), or nullptr to clear it
+     */
+    void setJumpPointTable(const JumpPointTable* table);
+
+    /**
+     * @brief Sets the number of worker threads used by planBatch.
+     *
+     * Takes effect on the next planBatch call; an existing pool of another size is replaced.
+     *
+     * @param threadCount Number of workers (0 = hardware concurrency)
+     */
+    void setBatchThreads(unsigned int threadCount);
+
+    /**
+     * @brief Selects how planBatch distributes queries over its workers.
+     *
+     * @param scheduler BatchScheduler::SharedQueue or BatchScheduler::WorkStealing
      */
-    Planner(const Graph& graph);
+    void setBatchScheduler(BatchScheduler scheduler);
+
+    /**
+     * @brief Returns how planBatch distributes queries over its workers.
+     *
+     * @return The selected BatchScheduler
+     */
+    BatchScheduler getBatchScheduler() const;
+
+    /**
+     * @brief Sets the resource that the Planner's own context takes transient memory from.
+     *
+     * The context's QueryArena requests its buffer from this resource (e.g. a
+     * std::pmr::unsynchronized_pool_resource per thread). Contexts passed to plan()
+     * keep their own setting (see QueryArena::setUpstream).
+     *
+     * @param resource Upstream resource (must outlive the Planner)
+     */
+    void setMemoryResource(std::pmr::memory_resource* resource);
 
     /**
      * @brief Computes a path from start to goal using the specified algorithm.
@@ -200,6 +684,172 @@ public:
      * - nodesExpanded 
      */
     PlanResults plan(const State& start, const State& goal, SearchType type = SearchType::BFS) const;
+
+    /**
+     * @brief Computes a path from start to goal using the given search state.
+     *
+     * Same as plan(start, goal, type), but all search state comes from the caller's
+     * context instead of the Planner's own. Reusing a context keeps its workspaces and
+     * open lists allocated between queries; calls with different contexts may run
+     * concurrently.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type Search algorithm to use
+     * @param context Search state for this query (e.g. PlannerContext::forThisThread())
+     *
+     * @return PlanResults as returned by plan(start, goal, type)
+     */
+    PlanResults plan(const State& start, const State& goal, SearchType type, PlannerContext& context) const;
+
+    /**
+     * @brief Computes a path from start to goal into caller-provided storage.
+     *
+     * Same as plan(start, goal, type, context), but the path is written into 'path'
+     * (its previous contents are replaced) and PlanResults::path stays empty. With a
+     * warm context and a path buffer of sufficient capacity, or one backed by the
+     * caller's own memory resource, the query does not use the global allocator.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type Search algorithm to use
+     * @param context Search state for this query
+     * @param path Output: the path (empty if there is none)
+     *
+     * @return PlanResults with everything but the path
+     */
+    PlanResults plan(const State& start, const State& goal, SearchType type, PlannerContext& context,
+        std::pmr::vector<State>& path) const;
+
+    /**
+     * @brief Computes a path from start to goal within a time, expansion and cancellation budget.
+     *
+     * Dijkstra and A* (every engine and open list) check the limits before each
+     * expansion: the expansion count every time, the clock and the token every
+     * SearchLimits::CHECK_INTERVAL expansions. When a limit is hit, the result is marked
+     * truncated, names the limit in stopReason, and holds the partial path to the
+     * expanded node closest to the goal along with the statistics gathered so far.
+     * Other search types run to completion.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type Search algorithm to use
+     * @param limits Budget of the query
+     *
+     * @return PlanResults as returned by plan(start, goal, type), possibly truncated
+     */
+    PlanResults plan(const State& start, const State& goal, SearchType type, const SearchLimits& limits) const;
+
+    /**
+     * @brief Computes a path from start to goal within a budget, using the given search state.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param type Search algorithm to use
+     * @param limits Budget of the query
+     * @param context Search state for this query (e.g. PlannerContext::forThisThread())
+     *
+     * @return PlanResults as returned by plan(start, goal, type, limits)
+     */
+    PlanResults plan(const State& start, const State& goal, SearchType type, const SearchLimits& limits,
+        PlannerContext& context) const;
+
+    /**
+     * @brief Computes a quick suboptimal path and keeps improving it (ARA*, see AnytimeAStar).
+     *
+     * The first weighted A* search uses settings.initialWeight; every following one
+     * lowers the weight and reuses the previous g-values, parents and open cells. Each
+     * improved solution is passed to settings.onSolution as soon as it is found, with
+     * its proven suboptimality bound. With limits, the search stops when the budget of
+     * the whole query runs out and returns the solutions found until then.
+     * Always uses dense per-cell storage and an indexed open list.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param settings Heuristic weights and solution callback
+     * @param limits Budget of the query (default: none)
+     *
+     * @return All published solutions, the last one being the best
+     */
+    AnytimeResults planAnytime(const State& start, const State& goal, const AnytimeSettings& settings = AnytimeSettings(),
+        const SearchLimits& limits = SearchLimits()) const;
+
+    /**
+     * @brief Runs ARA* from start to goal using the given search state.
+     *
+     * @param start Starting state
+     * @param goal Goal state
+     * @param settings Heuristic weights and solution callback
+     * @param limits Budget of the query
+     * @param context Search state for this query (e.g. PlannerContext::forThisThread())
+     *
+     * @return AnytimeResults as returned by planAnytime(start, goal, settings, limits)
+     */
+    AnytimeResults planAnytime(const State& start, const State& goal, const AnytimeSettings& settings,
+        const SearchLimits& limits, PlannerContext& context) const;
+
+    /**
+     * @brief Computes a path from start to the nearest of several goals.
+     *
+     * Runs one Dijkstra or A* search that stops at the first goal it settles, instead of
+     * one query per goal. A* uses the Chebyshev distance to the closest goal, which is
+     * admissible, so the reached goal is the nearest one and the path is optimal.
+     *
+     * @param start Starting state
+     * @param goals Candidate goals; invalid and blocked ones are ignored
+     * @param type SearchType::Dijkstra or SearchType::AStar (default); other types fail
+     *
+     * @return PlanResults as returned by plan(), with reachedGoal = index of the goal reached
+     */
+    PlanResults planToNearest(const State& start, const std::vector<State>& goals, SearchType type = SearchType::AStar) const;
+
+    /**
+     * @brief Computes a path from start to the nearest of several goals using the given search state.
+     *
+     * @param start Starting state
+     * @param goals Candidate goals; invalid and blocked ones are ignored
+     * @param type SearchType::Dijkstra or SearchType::AStar; other types fail
+     * @param context Search state for this query (e.g. PlannerContext::forThisThread())
+     *
+     * @return PlanResults as returned by planToNearest(start, goals, type)
+     */
+    PlanResults planToNearest(const State& start, const std::vector<State>& goals, SearchType type,
+        PlannerContext& context) const;
+
+    /**
+     * @brief Answers a batch of independent queries on a fixed pool of worker threads.
+     *
+     * The batch is split into small chunks that are distributed according to the selected
+     * BatchScheduler (shared queue or work stealing). Every worker plans with its own
+     * thread's PlannerContext (see PlannerContext::forThisThread) and this Planner's
+     * settings, and only reads the shared Graph. The workers and their contexts are kept
+     * for later batches, so a warm batch does not create threads or grow workspaces.
+     *
+     * Bidirectional queries always run in BidirectionalMode::Sequential here: the
+     * workers already keep every thread busy, and a second thread per query would
+     * only oversubscribe the cores.
+     *
+     * The graph and the world must not be modified while the batch runs.
+     *
+     * @param queries The queries to answer
+     *
+     * @return Results in input order, with throughput and latency percentiles
+     */
+    BatchResults planBatch(const std::vector<PlanQuery>& queries);
+
+    /**
+     * @brief Checks that a fixed-point (RadixHeap) result matches a double-precision result.
+     *
+     * Every quantized edge cost differs from its exact cost by at most
+     * 0.5 / Graph::FIXED_POINT_SCALE. The path found on quantized costs can therefore
+     * exceed the exact optimum by at most that amount per edge of both paths.
+     *
+     * @param fixed Result of a search with OpenListType::RadixHeap
+     * @param exact Result of the same query with a double-precision open list
+     *
+     * @return true if both agree on success and the costs are within the tolerance
+     */
+    static bool withinQuantizationTolerance(const PlanResults& fixed, const PlanResults& exact);
 };
 
 #endif // PLANNER_H
\ No newline at end of file
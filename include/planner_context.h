@@ -0,0 +1,69 @@
+#ifndef PLANNER_CONTEXT_H
+#define PLANNER_CONTEXT_H
+
+#include "world.h"
+#include "search_workspace.h"
+#include "lazy_binary_heap.h"
+#include "indexed_heap.h"
+#include "radix_heap.h"
+#include "concurrent_closed_set.h"
+#include "helper_thread.h"
+#include "query_arena.h"
+#include "bit_parallel_bfs.h"
+#include "search_limits.h"
+#include "anytime_astar.h"
+#include "state.h"
+#include <vector>
+
+/**
+ * @struct PlannerContext
+ * @brief All mutable state of a Planner query, kept alive between queries.
+ *
+ * A context bundles the per-node search state (g-values, parents, closed markers),
+ * every open list, the BFS frontier and the bitmaps of the bit-parallel BFS. Each
+ * query resets the parts it uses in O(1) (generation counters) or by clearing
+ * containers without releasing their storage, so once a context has served a query
+ * on the largest world it is used with, later dense-engine queries do not allocate
+ * for their search state.
+ *
+ * Transient allocations of a query (e.g. the hash containers of SearchEngine::Hashed)
+ * come from the context's QueryArena, which is reset at the start of every query, and
+ * the path is assembled in reused storage before it is copied to the caller.
+ *
+ * A context must only be used by one query at a time. Queries with different
+ * contexts may run concurrently on the same Planner. Every thread can get its own
+ * context from forThisThread().
+ */
+struct PlannerContext
+{
+    SearchWorkspace workspace;           // Search state of single-direction searches, forward state of bidirectional ones
+    SearchWorkspace backwardWorkspace;   // Backward search state of bidirectional searches
+    LazyBinaryHeap binaryOpen;           // OpenListType::BinaryHeap
+    IndexedHeap indexedOpen;             // OpenListType::IndexedHeap, JPS and forward bidirectional open list
+    IndexedHeap backwardOpen;            // Backward open list of bidirectional searches
+    RadixHeap radixOpen;                 // OpenListType::RadixHeap
+    ConcurrentClosedSet forwardClosed;   // Forward cells visible to the backward thread (parallel bidirectional)
+    ConcurrentClosedSet backwardClosed;  // Backward cells visible to the forward thread (parallel bidirectional)
+    std::vector<CellId> frontier;        // FIFO storage of BFS
+    BitParallelBFS bitBfs;               // Bitmaps of BFSMode::BitParallel
+    AnytimeAStar anytime;                // Search state of planAnytime (kept across its iterations)
+    std::vector<int> goalIndex;          // Goal index per CellId of nearest-goal queries, -1 for other cells
+    std::vector<CellId> goalCells;       // Cells marked in goalIndex
+    std::vector<double> goalField;       // Chebyshev distance to the goal set per CellId (large goal sets)
+    HelperThread backwardHelper;         // Runs the backward direction of parallel bidirectional searches
+    bool batchWorker = false;            // Used by a planBatch worker: bidirectional searches stay on one thread
+    SearchLimits limits;                 // Budget of the current query
+    std::vector<State> path;             // Path of the current query
+    QueryArena arena;                    // Transient allocations of the current query
+
+    /**
+     * @brief Returns the context of the calling thread (thread-local pool).
+     *
+     * The context is created on first use and lives until the thread exits.
+     *
+     * @return The calling thread's context
+     */
+    static PlannerContext& forThisThread();
+};
+
+#endif // PLANNER_CONTEXT_H
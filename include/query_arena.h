@@ -0,0 +1,115 @@
+#ifndef QUERY_ARENA_H
+#define QUERY_ARENA_H
+
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class QueryArena
+ * @brief Monotonic memory resource for the transient allocations of one query.
+ *
+ * Allocations are served by bumping an offset in one buffer; deallocation is a
+ * no-op and all memory is reclaimed at once by reset(). When a query needs more
+ * than the buffer holds, the rest comes from the upstream resource, and the next
+ * reset() replaces the buffer by one large enough for that query. A reused arena
+ * therefore stops requesting memory from upstream once it has served its largest
+ * query, unlike std::pmr::monotonic_buffer_resource, which returns its growth to
+ * upstream on release().
+ *
+ * The arena is not thread-safe; every PlannerContext owns one.
+ */
+class QueryArena : public std::pmr::memory_resource
+{
+private:
+    /**
+     * @struct Block
+     * @brief Memory taken from upstream because the buffer was full.
+     */
+    struct Block
+    {
+        void* memory;       // Start of the block
+        size_t bytes;       // Size of the block
+        size_t alignment;   // Alignment the block was requested with
+    };
+
+    std::pmr::memory_resource* upstream;  // Source of the buffer and of overflow blocks
+    std::byte* buffer = nullptr;          // Bump-allocated buffer
+    size_t capacity = 0;                  // Size of the buffer in bytes
+    size_t used = 0;                      // Bytes of the buffer handed out since the last reset
+    size_t overflowBytes = 0;             // Bytes taken from upstream since the last reset
+    std::pmr::vector<Block> overflow;     // Upstream blocks to free on reset
+
+    /**
+     * @brief Returns the buffer and all overflow blocks to upstream.
+     */
+    void releaseAll();
+
+    /**
+     * @brief Allocates from the buffer, or from upstream when the buffer is full.
+     */
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    /**
+     * @brief Does nothing; memory is reclaimed by reset().
+     */
+    void do_deallocate(void* memory, size_t bytes, size_t alignment) override;
+
+    /**
+     * @brief Two arenas are only equal if they are the same object.
+     */
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    /**
+     * @brief Constructs an empty arena; the buffer is allocated by the first reset() after an overflow.
+     *
+     * @param upstream Resource the arena takes its memory from (must outlive the arena)
+     */
+    explicit QueryArena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    ~QueryArena() override;
+
+    QueryArena(const QueryArena&) = delete;
+    QueryArena& operator=(const QueryArena&) = delete;
+
+    /**
+     * @brief Invalidates all memory handed out since the last reset.
+     *
+     * If the last query overflowed the buffer, the buffer is replaced by one twice
+     * the size that query needed.
+     */
+    void reset();
+
+    /**
+     * @brief Frees all memory and takes future memory from another resource.
+     *
+     * Invalidates all memory handed out by the arena.
+     *
+     * @param resource New upstream resource (must outlive the arena)
+     */
+    void setUpstream(std::pmr::memory_resource* resource);
+
+    /**
+     * @brief Returns the upstream resource.
+     *
+     * @return The resource the arena takes its memory from
+     */
+    std::pmr::memory_resource* getUpstream() const;
+
+    /**
+     * @brief Returns the size of the buffer.
+     *
+     * @return Capacity in bytes
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Returns the number of bytes handed out since the last reset (buffer and upstream).
+     *
+     * @return Bytes in use
+     */
+    size_t getUsed() const;
+};
+
+#endif // QUERY_ARENA_H
@@ -0,0 +1,96 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include "world.h"
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class RadixHeap
+ * @brief Monotone priority queue of cells with unsigned integer keys.
+ *
+ * A radix heap exploits the fact that Dijkstra (and A* with a consistent heuristic)
+ * never pushes a key smaller than the last popped one. Entries are kept in 65
+ * buckets according to the highest bit in which their key differs from the last
+ * popped key. Pops take entries from bucket 0; when it runs dry, the first
+ * non-empty bucket is redistributed relative to its minimum. Each entry moves
+ * to a lower bucket at most 64 times, so push and pop cost O(1) amortized
+ * (O(log C) for a maximum edge cost C).
+ *
+ * Like std::priority_queue it uses lazy deletion: pushing a cell twice stores
+ * two entries, and the search skips outdated ones when they are popped.
+ *
+ * Keys smaller than the last popped key (which only happen with an inconsistent
+ * heuristic) are clamped to it, keeping the queue valid at the cost of ordering
+ * accuracy for those entries.
+ */
+class RadixHeap
+{
+private:
+    static constexpr int BUCKET_COUNT = 65;  // One bucket per differing bit, plus bucket 0
+
+    /**
+     * @struct Entry
+     * @brief Queued cell and its key.
+     */
+    struct Entry
+    {
+        std::uint64_t key;
+        CellId id;
+    };
+
+    std::array<std::vector<Entry>, BUCKET_COUNT> buckets;  // Entries grouped by differing bit
+    std::uint64_t last = 0;                                 // Last popped key (lower bound of all keys)
+    size_t count = 0;                                       // Number of queued entries
+
+    /**
+     * @brief Returns the bucket of a key relative to the last popped key.
+     *
+     * @param key The key (not smaller than 'last')
+     * @return Bucket index in [0, 64]
+     */
+    int bucketOf(std::uint64_t key) const;
+
+public:
+    /**
+     * @brief Removes all entries and resets the lower bound to 0 (buffers are kept).
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether the queue is empty.
+     *
+     * @return true if no entries are queued
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of queued entries.
+     *
+     * @return Number of entries, including outdated duplicates
+     */
+    size_t size() const;
+
+    /**
+     * @brief Queues a cell with the given key.
+     *
+     * The priority is taken as an integer key (fixed-point cost, see Graph::toFixedCost).
+     *
+     * @param id The cell id
+     * @param priority Non-negative, integer-valued priority
+     */
+    void push(CellId id, double priority);
+
+    /**
+     * @brief Removes and returns a cell with the smallest key.
+     *
+     * The queue must not be empty.
+     *
+     * @return CellId of the removed entry
+     */
+    CellId pop();
+};
+
+#endif // RADIX_HEAP_H
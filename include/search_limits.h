@@ -0,0 +1,179 @@
+#ifndef SEARCH_LIMITS_H
+#define SEARCH_LIMITS_H
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+
+/**
+ * @enum SearchStop
+ * @brief Why a search ended.
+ *
+ * - Completed: the goal was reached, or every reachable cell was expanded
+ * - Deadline: the time budget of the query ran out
+ * - ExpansionLimit: the query expanded its maximum number of nodes
+ * - Cancelled: the query's CancellationToken was cancelled
+ */
+enum class SearchStop
+{
+    Completed,
+    Deadline,
+    ExpansionLimit,
+    Cancelled
+};
+
+/**
+ * @class CancellationToken
+ * @brief Flag through which any thread can ask running queries to stop.
+ *
+ * Searches poll the flag together with their deadline, so a cancelled query stops
+ * after at most SearchLimits::CHECK_INTERVAL further expansions. A token can be
+ * shared by any number of queries and reused after reset().
+ */
+class CancellationToken
+{
+private:
+    std::atomic<bool> cancelled{ false };  // Set by cancel(), cleared by reset()
+
+public:
+    /**
+     * @brief Asks every query using this token to stop.
+     */
+    void cancel()
+    {
+        cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Clears the flag, so the token can be used for new queries.
+     */
+    void reset()
+    {
+        cancelled.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether cancel() was called since the last reset().
+     *
+     * @return true if cancelled
+     */
+    bool isCancelled() const
+    {
+        return cancelled.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @struct SearchLimits
+ * @brief Budget of a single query: time, expanded nodes and a cancellation token.
+ *
+ * Every limit is optional; a default-constructed SearchLimits does not limit the
+ * search. The expansion count is compared on every expansion; the clock and the token
+ * are only read every CHECK_INTERVAL expansions, so a query may overrun its deadline
+ * by that many expansions.
+ */
+struct SearchLimits
+{
+    static constexpr int CHECK_INTERVAL = 64;  // Expansions between clock and token checks
+
+    double timeBudget = 0.0;                       // Milliseconds from the start of the search (0 = no limit)
+    int maxExpansions = 0;                         // Nodes the search may expand (0 = no limit)
+    const CancellationToken* cancel = nullptr;     // Token polled by the search (not owned, may be null)
+
+    /**
+     * @brief Checks whether any limit is set.
+     *
+     * @return true if the search has to check its budget
+     */
+    bool isLimited() const
+    {
+        return timeBudget > 0.0 || maxExpansions > 0 || cancel != nullptr;
+    }
+};
+
+/**
+ * @class SearchBudget
+ * @brief Checks the SearchLimits of a running search before every expansion.
+ *
+ * Created when a search starts, which also starts its time budget. The common case is
+ * one comparison of the expansion count with the count of the next check, which
+ * unlimited searches never reach. The clock and the token are read every
+ * SearchLimits::CHECK_INTERVAL expansions.
+ */
+class SearchBudget
+{
+private:
+    const SearchLimits& limits;                        // Limits of the search (must outlive the budget)
+    bool limited;                                      // Any limit set
+    int nextCheck;                                     // Expansion count of the next full check
+    std::chrono::steady_clock::time_point deadline;    // Start of the search + time budget
+
+public:
+    /**
+     * @brief Starts the budget of a search.
+     *
+     * @param limits Limits of the search
+     */
+    explicit SearchBudget(const SearchLimits& limits)
+        : limits(limits), limited(limits.isLimited()), nextCheck(limited ? 0 : std::numeric_limits<int>::max()),
+        deadline(std::chrono::steady_clock::now())
+    {
+        if (limits.timeBudget > 0.0)
+        {
+            deadline += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::milli>(limits.timeBudget));
+        }
+    }
+
+    /**
+     * @brief Checks whether any limit is set.
+     *
+     * @return true if check() can stop the search
+     */
+    bool isLimited() const
+    {
+        return limited;
+    }
+
+    /**
+     * @brief Checks whether the search may expand another node.
+     *
+     * @param expanded Nodes expanded so far
+     *
+     * @return The limit that stops the search, or SearchStop::Completed to continue
+     */
+    SearchStop check(int expanded)
+    {
+        if (expanded < nextCheck)
+        {
+            return SearchStop::Completed;
+        }
+
+        if (limits.maxExpansions > 0 && expanded >= limits.maxExpansions)
+        {
+            return SearchStop::ExpansionLimit;
+        }
+
+        if (limits.cancel != nullptr && limits.cancel->isCancelled())
+        {
+            return SearchStop::Cancelled;
+        }
+
+        if (limits.timeBudget > 0.0 && std::chrono::steady_clock::now() >= deadline)
+        {
+            return SearchStop::Deadline;
+        }
+
+        nextCheck = expanded + SearchLimits::CHECK_INTERVAL;
+
+        if (limits.maxExpansions > 0)
+        {
+            nextCheck = std::min(nextCheck, limits.maxExpansions);
+        }
+
+        return SearchStop::Completed;
+    }
+};
+
+#endif // SEARCH_LIMITS_H
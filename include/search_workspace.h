@@ -0,0 +1,125 @@
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include "world.h"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class SearchWorkspace
+ * @brief Dense per-cell search state (g-value, parent, closed flag) indexed by CellId.
+ *
+ * The workspace replaces hash-based containers in the search algorithms with flat
+ * arrays sized to the world's cell buffer. Every record carries generation stamps:
+ * a record is considered empty unless its stamp matches the current generation.
+ * Starting a new query only increments the generation, so the arrays never need
+ * to be cleared between queries (except when the generation counter wraps around).
+ *
+ * A workspace can be reused for any number of queries, also on worlds of
+ * different size, but must not be used by two searches at the same time.
+ */
+class SearchWorkspace
+{
+public:
+    static constexpr double INF = std::numeric_limits<double>::infinity(); // g-value of unseen cells
+    static constexpr CellId NO_PARENT = World::INVALID_CELL;               // Parent of unseen cells
+
+private:
+    /**
+     * @struct Node
+     * @brief Search record of a single cell.
+     */
+    struct Node
+    {
+        double g = INF;                 // Best known cost from the start
+        CellId parent = NO_PARENT;      // Predecessor on the best known path
+        std::uint32_t seenStamp = 0;    // Generation in which g/parent were written
+        std::uint32_t closedStamp = 0;  // Generation in which the cell was closed
+    };
+
+    std::vector<Node> nodes;       // One record per cell of the padded world buffer
+    std::uint32_t generation = 0;  // Current query generation (0 = never used)
+
+public:
+    /**
+     * @brief Starts a new query on a world with the given number of cells.
+     *
+     * Grows the arrays if needed and invalidates all records in O(1)
+     * by advancing the generation counter.
+     *
+     * @param cellCount Number of cells in the world buffer (World::getCellCount())
+     */
+    void prepare(int cellCount);
+
+    /**
+     * @brief Checks whether a cell has been reached in the current query.
+     *
+     * @param id The cell id
+     * @return true if the cell has a g-value in this query
+     */
+    bool isSeen(CellId id) const
+    {
+        return nodes[id].seenStamp == generation;
+    }
+
+    /**
+     * @brief Returns the g-value of a cell, or `INF` if it has not been reached.
+     *
+     * @param id The cell id
+     * @return Best known cost from the start
+     */
+    double getCost(CellId id) const
+    {
+        return isSeen(id) ? nodes[id].g : INF;
+    }
+
+    /**
+     * @brief Returns the parent of a cell, or `NO_PARENT` if it has not been reached.
+     *
+     * @param id The cell id
+     * @return Parent cell id
+     */
+    CellId getParent(CellId id) const
+    {
+        return isSeen(id) ? nodes[id].parent : NO_PARENT;
+    }
+
+    /**
+     * @brief Records a (better) g-value and parent for a cell.
+     *
+     * @param id The cell id
+     * @param g The new cost from the start
+     * @param parent The predecessor cell
+     */
+    void update(CellId id, double g, CellId parent)
+    {
+        Node& node = nodes[id];
+        node.g = g;
+        node.parent = parent;
+        node.seenStamp = generation;
+    }
+
+    /**
+     * @brief Checks whether a cell has been closed (expanded) in the current query.
+     *
+     * @param id The cell id
+     * @return true if the cell is closed
+     */
+    bool isClosed(CellId id) const
+    {
+        return nodes[id].closedStamp == generation;
+    }
+
+    /**
+     * @brief Marks a cell as closed (expanded) in the current query.
+     *
+     * @param id The cell id
+     */
+    void close(CellId id)
+    {
+        nodes[id].closedStamp = generation;
+    }
+};
+
+#endif // SEARCH_WORKSPACE_H
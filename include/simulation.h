@@ -4,6 +4,7 @@
 #include "world.h"
 #include "graph.h"
 #include "planner.h"
+#include "jump_point_table.h"
 #include <vector>
 
 /**
@@ -12,7 +13,7 @@
  *
  * Responsibilities:
  * - Generate a random world with obstacles
- * - Allow user to select algorithm (BFS, Dijkstra, A*)
+ * - Allow user to select algorithm (BFS, Dijkstra, A*, JPS, JPS+)
  * - Run the planner and get the path
  * - Animate the agent moving along the path
  * - Display grid and path in console
@@ -26,6 +27,7 @@ private:
     World world;
     Graph graph;
     Planner planner;
+    JumpPointTable jumpTable;
     State start;
     State goal;
 
@@ -0,0 +1,104 @@
+#ifndef SNAPSHOT_READER_H
+#define SNAPSHOT_READER_H
+
+#include "world.h"
+#include "graph.h"
+#include "state.h"
+#include "planner.h"
+#include "versioned_world.h"
+#include <memory>
+#include <cstdint>
+
+/**
+ * @class SnapshotReader
+ * @brief Runs planner queries of one thread on the snapshots of a VersionedWorld.
+ *
+ * The reader owns a private World, Graph and Planner. refresh() pins the latest
+ * snapshot and copies into the private world only the tiles whose pointer differs
+ * from the snapshot pinned before, so catching up costs O(changed tiles), not
+ * O(world). Between two refresh() calls the private world does not change: every
+ * query sees one consistent version, whatever the writer does meanwhile, and no
+ * query ever waits for the writer.
+ *
+ * Tiles are copied through World::setWeight, so the private world's epoch and
+ * change journal (and the FlowField::isUpToDate() of fields built on it) follow the
+ * versions too.
+ *
+ * Use one reader per thread; a reader itself is not thread-safe. The VersionedWorld
+ * must outlive its readers.
+ */
+class SnapshotReader
+{
+private:
+    const VersionedWorld& source;                   // World the snapshots come from
+    World world;                                    // Private copy of the pinned version
+    Graph graph;                                    // Graph on the private copy
+    Planner planner;                                // Planner on the private copy
+    std::shared_ptr<const WorldSnapshot> snapshot;  // Pinned snapshot (its version is in 'world')
+    int lastCopiedTiles = 0;                        // Tiles copied by the last refresh()
+
+public:
+    /**
+     * @brief Constructs a reader and loads the latest snapshot.
+     *
+     * @param source The versioned world (must outlive the reader)
+     */
+    explicit SnapshotReader(const VersionedWorld& source);
+
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    /**
+     * @brief Loads the latest published snapshot, copying only the tiles that changed.
+     *
+     * @return true if a newer version was loaded
+     */
+    bool refresh();
+
+    /**
+     * @brief Plans on the pinned version (see Planner::plan).
+     *
+     * @param start Start state
+     * @param goal Goal state
+     * @param type Search algorithm
+     * @return PlanResults as returned by Planner::plan
+     */
+    PlanResults plan(const State& start, const State& goal, SearchType type = SearchType::BFS) const;
+
+    /**
+     * @brief Returns the version the reader currently plans on.
+     *
+     * @return Version of the pinned snapshot
+     */
+    std::uint64_t getVersion() const;
+
+    /**
+     * @brief Returns the pinned snapshot.
+     *
+     * @return The snapshot whose weights the private world holds
+     */
+    const std::shared_ptr<const WorldSnapshot>& getSnapshot() const;
+
+    /**
+     * @brief Returns the number of tiles copied by the last refresh().
+     *
+     * @return Copied tiles (all tiles for the first load)
+     */
+    int getLastCopiedTiles() const;
+
+    /**
+     * @brief Returns the private world of the reader.
+     *
+     * @return World holding the pinned version
+     */
+    const World& getWorld() const;
+
+    /**
+     * @brief Returns the planner of the reader (e.g. for other query types).
+     *
+     * @return Planner on the private world
+     */
+    const Planner& getPlanner() const;
+};
+
+#endif // SNAPSHOT_READER_H
@@ -3,6 +3,9 @@
 
 #include "planner.h"
 #include <string>
+#include <vector>
+#include <utility>
+#include <tuple>
 
 class StatsManager 
 {
@@ -10,17 +13,92 @@ public:
     /**
      * @brief Prints the comparison results of multiple pathfinding algorithms.
      *
-     * This function prints a table comparing the results of BFS, Dijkstra, and A* algorithms on the same grid.
+     * This function prints a table comparing the results of BFS, Dijkstra, A* and the bidirectional
+     * variants of Dijkstra and A* on the same grid.
      * It displays the cost, path length, expanded nodes, and execution time for each algorithm.
      *
      * Additionally, it checks if the A* algorithm is optimal by comparing its total cost with Dijkstras result. 
-     * If both algorithms return the same total cost, A* is considered optimal.
+     * If both algorithms return the same total cost, A* is considered optimal. The bidirectional
+     * searches are checked against Dijkstra in the same way.
      * 
      * @param bfsRes The results of the BFS algorithm.
      * @param dijRes The results of the Dijkstra algorithm.
      * @param aStarRes The results of the A* algorithm.
+     * @param biDijRes The results of the bidirectional Dijkstra algorithm.
+     * @param biAStarRes The results of the bidirectional A* algorithm.
      */
-    static void printComparisonResults(const PlanResults& bfsRes, const PlanResults& dijRes, const PlanResults& aStarRes);
+    static void printComparisonResults(const PlanResults& bfsRes, const PlanResults& dijRes, const PlanResults& aStarRes,
+        const PlanResults& biDijRes, const PlanResults& biAStarRes);
+
+    /**
+     * @brief Prints open list statistics of weighted searches run with different priority queues.
+     *
+     * For every row it displays the cost, expanded nodes, stale pops (entries skipped because
+     * their node was already closed), the peak open list size and the execution time.
+     * This makes the lazy-deletion binary heap directly comparable with the indexed heap.
+     *
+     * @param rows Pairs of (label, results), printed in the given order
+     */
+    static void printOpenListComparison(const std::vector<std::pair<std::string, PlanResults>>& rows);
+
+    /**
+     * @brief Prints wall-clock times of alternative runs of the same workload.
+     *
+     * The first row is the baseline; every row shows its total time and its speedup
+     * over the baseline (baseline time / row time).
+     *
+     * @param rows Pairs of (label, total time in ms), baseline first
+     */
+    static void printTimingComparison(const std::vector<std::pair<std::string, double>>& rows);
+
+    /**
+     * @brief Prints throughput and latency percentiles of a query batch.
+     *
+     * @param name Label of the batch run (e.g. "A*, 4 threads")
+     * @param batch The results of Planner::planBatch
+     */
+    static void printBatchResults(const std::string& name, const BatchResults& batch);
+
+    /**
+     * @brief Prints the load of every worker of a WorkStealingScheduler run.
+     *
+     * For each worker it displays the executed tasks, the stolen tasks, the busy time and
+     * the utilization (busy time / wall time), followed by the total steal count and the
+     * imbalance (largest busy time / mean busy time; 1.00 = perfectly balanced).
+     *
+     * @param stats Per-worker statistics (WorkStealingScheduler::getStats)
+     * @param wallTime Wall-clock time of the run (milliseconds)
+     */
+    static void printWorkerStats(const std::vector<WorkStealingScheduler::WorkerStats>& stats, double wallTime);
+
+    /**
+     * @brief Prints heap allocation counts of repeated queries.
+     *
+     * @param rows Tuples of (label, allocations of the first query, mean allocations of warm
+     *             queries, same mean with the path written into a caller-provided buffer)
+     */
+    static void printAllocationCounts(const std::vector<std::tuple<std::string, double, double, double>>& rows);
+
+    /**
+     * @brief Prints the direction chosen for every layer of a direction-optimizing BFS.
+     *
+     * Consecutive layers that ran in the same direction are merged into one row with
+     * their layer range, largest frontier, edge checks and time.
+     *
+     * @param layers Per-layer statistics (PlanResults::bfsLayers)
+     */
+    static void printBFSLayers(const std::vector<BFSLayerStats>& layers);
+
+    /**
+     * @brief Prints the cost-versus-time curve of an anytime (ARA*) search.
+     *
+     * One row per published solution with its time, heuristic weight, proven bound,
+     * cost and expansions so far, and a bar showing how far its cost lies above the
+     * best solution (relative to the first one).
+     *
+     * @param results Results of Planner::planAnytime
+     */
+    static void printAnytimeCurve(const AnytimeResults& results);
 
     /**
      * @brief Prints a detailed correctness report for a given algorithm.
@@ -0,0 +1,81 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads executing tasks from a shared FIFO queue.
+ *
+ * The workers are started once by the constructor and live until the pool is
+ * destroyed, so submitting work never creates threads. Each task receives the
+ * index of the worker that runs it, which lets callers keep per-worker state
+ * (for example one Planner with its own search workspace per worker) without locking.
+ *
+ * The pool is not copyable. submit() and wait() may be called from any thread
+ * that is not one of the pool's workers.
+ */
+class ThreadPool
+{
+public:
+    using Task = std::function<void(unsigned int)>;  // Called with the index of the running worker
+
+private:
+    std::vector<std::thread> workers;     // Worker threads, indexed 0..size()-1
+    std::deque<Task> tasks;               // Pending tasks in submission order
+    std::mutex mutex;                     // Protects tasks, activeTasks and stopping
+    std::condition_variable taskReady;    // Signalled when a task is queued or the pool stops
+    std::condition_variable allDone;      // Signalled when the queue is empty and no task runs
+    size_t activeTasks = 0;               // Tasks currently being executed
+    bool stopping = false;                // Set by the destructor
+
+    /**
+     * @brief Main loop of a worker: runs queued tasks until the pool stops.
+     *
+     * @param index Index of the worker
+     */
+    void workerLoop(unsigned int index);
+
+public:
+    /**
+     * @brief Starts a pool with the given number of workers.
+     *
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit ThreadPool(unsigned int threadCount = 0);
+
+    /**
+     * @brief Finishes all queued tasks and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return Worker count
+     */
+    unsigned int size() const;
+
+    /**
+     * @brief Queues a task for execution by the next idle worker.
+     *
+     * @param task Callable taking the worker index
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     */
+    void wait();
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,192 @@
+#ifndef VERSIONED_WORLD_H
+#define VERSIONED_WORLD_H
+
+#include "world.h"
+#include "state.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @struct WorldTile
+ * @brief Weights of a TILE_SIZE x TILE_SIZE block of cells (row-major; cells past the world's edge are unused).
+ */
+struct WorldTile
+{
+    static constexpr int TILE_SIZE = 64;   // Cells per tile side
+
+    std::vector<double> weights = std::vector<double>(TILE_SIZE * TILE_SIZE, World::FREE);  // Weight per cell of the tile
+};
+
+/**
+ * @class WorldSnapshot
+ * @brief Immutable version of a world, stored as shared tiles.
+ *
+ * A snapshot never changes after it is published, so any number of threads may read
+ * it without synchronization. Consecutive versions share every tile the writer did
+ * not touch in between: comparing tile pointers tells which tiles changed.
+ */
+class WorldSnapshot
+{
+private:
+    int width;                                              // Width of the world
+    int height;                                             // Height of the world
+    int tilesPerRow;                                        // Tiles per row of the world
+    std::uint64_t version;                                  // Version number (1 = initial world)
+    std::vector<std::shared_ptr<const WorldTile>> tiles;    // Tiles, row-major
+
+public:
+    /**
+     * @brief Creates a snapshot from its tiles.
+     *
+     * @param width Width of the world
+     * @param height Height of the world
+     * @param version Version number
+     * @param tiles Tiles, row-major (shared with other versions)
+     */
+    WorldSnapshot(int width, int height, std::uint64_t version, std::vector<std::shared_ptr<const WorldTile>> tiles);
+
+    /**
+     * @brief Returns the width of the world.
+     *
+     * @return Width in cells
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Returns the height of the world.
+     *
+     * @return Height in cells
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Returns the version number of the snapshot.
+     *
+     * @return Version (increases with every publish)
+     */
+    std::uint64_t getVersion() const;
+
+    /**
+     * @brief Returns the number of tiles.
+     *
+     * @return Tile count
+     */
+    int getTileCount() const;
+
+    /**
+     * @brief Returns a tile.
+     *
+     * @param index Tile index in [0, getTileCount()), row-major
+     * @return Pointer to the shared tile
+     */
+    const WorldTile* getTile(int index) const;
+
+    /**
+     * @brief Returns the weight of a cell.
+     *
+     * @param s The state
+     * @return Weight of the cell, or `World::BLOCK` if it is out of bounds
+     */
+    double getWeight(const State& s) const;
+
+    /**
+     * @brief Checks whether a cell is free.
+     *
+     * @param s The state
+     * @return true if the cell is inside the world and not blocked
+     */
+    bool isFree(const State& s) const;
+};
+
+/**
+ * @class VersionedWorld
+ * @brief A world updated by one writer thread and read through immutable snapshots by any number of readers.
+ *
+ * The writer changes weights with setWeight(); the first change to a tile since the
+ * last publish() copies that tile (copy-on-write), later changes to it write in place.
+ * publish() makes the changes visible at once as a new WorldSnapshot that shares all
+ * untouched tiles with the previous one.
+ *
+ * Readers call pin() to get the latest snapshot and keep it as long as they need a
+ * consistent view; the writer never waits for them and they never wait for the
+ * writer, apart from the atomic exchange of one pointer. A version and its tiles are
+ * freed when the last reader holding them lets go (reference counting takes the role
+ * of RCU's grace period). Planner queries run on a SnapshotReader, which keeps a
+ * private World in sync with the pinned snapshots.
+ *
+ * setWeight() and publish() must only be called from one thread at a time.
+ */
+class VersionedWorld
+{
+private:
+    int width;                                          // Width of the world
+    int height;                                         // Height of the world
+    int tilesPerRow;                                    // Tiles per row of the world
+    std::shared_ptr<const WorldSnapshot> current;       // Latest published snapshot (atomic access only)
+    std::vector<std::shared_ptr<WorldTile>> working;    // Tiles of the next version
+    std::vector<std::uint8_t> copied;                   // Per tile: copied since the last publish
+    std::vector<int> touched;                           // Tiles copied since the last publish
+    std::uint64_t nextVersion = 1;                      // Version of the next published snapshot
+    int lastCopiedTiles = 0;                            // Tiles copied for the last published version
+
+public:
+    /**
+     * @brief Creates version 1 from the current weights of a world.
+     *
+     * @param world The world to copy
+     */
+    explicit VersionedWorld(const World& world);
+
+    VersionedWorld(const VersionedWorld&) = delete;
+    VersionedWorld& operator=(const VersionedWorld&) = delete;
+
+    /**
+     * @brief Returns the width of the world.
+     *
+     * @return Width in cells
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Returns the height of the world.
+     *
+     * @return Height in cells
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Changes a weight in the next version (writer only).
+     *
+     * Negative weights are stored as `World::BLOCK`, as in World::setWeight. Writing
+     * the weight a cell already has changes nothing and copies no tile.
+     *
+     * @param s The cell
+     * @param weight The new weight
+     * @return true if the cell is inside the world
+     */
+    bool setWeight(const State& s, double weight);
+
+    /**
+     * @brief Publishes the changes made since the last publish() as a new snapshot (writer only).
+     *
+     * @return Version of the latest snapshot (unchanged if nothing was changed)
+     */
+    std::uint64_t publish();
+
+    /**
+     * @brief Returns the latest published snapshot (any thread).
+     *
+     * @return The snapshot; it stays valid and unchanged while the pointer is held
+     */
+    std::shared_ptr<const WorldSnapshot> pin() const;
+
+    /**
+     * @brief Returns the number of tiles copied for the last published version (writer only).
+     *
+     * @return Copied tiles
+     */
+    int getLastCopiedTiles() const;
+};
+
+#endif // VERSIONED_WORLD_H
@@ -0,0 +1,211 @@
+#ifndef WORK_STEALING_SCHEDULER_H
+#define WORK_STEALING_SCHEDULER_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+/**
+ * @class WorkStealingScheduler
+ * @brief Fixed set of worker threads with one task deque per worker and work stealing.
+ *
+ * Every worker takes tasks from the back of its own deque (most recently added first).
+ * A worker whose deque is empty steals from the front of another worker's deque, i.e.
+ * the oldest task that owner would have run last. Batches with a few very expensive
+ * tasks therefore keep all workers busy even when the initial split was uneven.
+ *
+ * Tasks receive the index of the worker that runs them, so callers can give every
+ * worker its own state (for example a Planner with its own search workspace) that is
+ * never touched by two threads at once. Tasks submitted from inside a task go to the
+ * running worker's own deque.
+ *
+ * Each worker counts the tasks it executed, the tasks it stole and the time it spent
+ * running tasks (busy time), so the balance of a batch can be checked afterwards.
+ *
+ * parallelFor() waits only for its own chunks, so it may be called from several
+ * threads at once and from inside a task: a worker waiting for a nested parallelFor
+ * runs queued tasks (its own or stolen ones) until the chunks are done instead of
+ * blocking. Nested chunks run with the index of whichever worker picks them up,
+ * possibly the waiting one, so per-worker state must not be held across a nested
+ * call. wait() waits for every submitted task and must not be called from a task.
+ *
+ * The scheduler is not copyable.
+ */
+class WorkStealingScheduler
+{
+public:
+    using Task = std::function<void(unsigned int)>;  // Called with the index of the running worker
+
+    /**
+     * @struct WorkerStats
+     * @brief Load statistics of one worker since construction or the last resetStats().
+     */
+    struct WorkerStats
+    {
+        size_t tasksExecuted = 0;  // Tasks run by this worker (own and stolen)
+        size_t steals = 0;         // Tasks taken from other workers' deques
+        double busyTime = 0.0;     // Time spent running tasks (milliseconds)
+    };
+
+private:
+    /**
+     * @struct QueuedTask
+     * @brief A task and the completion latch of the parallelFor() call it belongs to.
+     */
+    struct QueuedTask
+    {
+        Task task;                             // The task
+        std::atomic<int>* latch = nullptr;     // Decremented after the task and its statistics (may be null)
+    };
+
+    /**
+     * @struct Worker
+     * @brief Task deque and statistics of one worker.
+     */
+    struct Worker
+    {
+        std::deque<QueuedTask> tasks; // Own tasks; the owner pops at the back, thieves at the front
+        std::mutex mutex;         // Protects tasks
+        WorkerStats stats;        // Only written by the owning thread
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;  // One entry per worker thread
+    std::vector<std::thread> threads;              // Worker threads
+    std::atomic<size_t> queued;                    // Tasks waiting in any deque
+    std::atomic<size_t> pending;                   // Tasks submitted but not finished
+    std::atomic<unsigned int> nextWorker;          // Round-robin target of external submissions
+    std::mutex sleepMutex;                         // Guards sleeping, waking and stopping
+    std::condition_variable wakeUp;                // Signalled when tasks are queued or the scheduler stops
+    std::condition_variable allDone;               // Signalled when no task is pending
+    bool stopping = false;                         // Set by the destructor
+
+    /**
+     * @brief Main loop of a worker: runs own and stolen tasks until the scheduler stops.
+     *
+     * @param index Index of the worker
+     */
+    void workerLoop(unsigned int index);
+
+    /**
+     * @brief Takes the newest task of a worker's own deque.
+     *
+     * @param index Index of the worker
+     * @param task Output: the task
+     * @return true if a task was taken
+     */
+    bool popLocal(unsigned int index, QueuedTask& task);
+
+    /**
+     * @brief Takes the oldest task of another worker's deque.
+     *
+     * @param index Index of the stealing worker
+     * @param task Output: the task
+     * @return true if a task was stolen
+     */
+    bool steal(unsigned int index, QueuedTask& task);
+
+    /**
+     * @brief Appends a task to a worker's deque and wakes a sleeping worker.
+     *
+     * @param index Index of the target worker
+     * @param task The task
+     * @param latch Completion latch of a parallelFor() call, or nullptr
+     */
+    void push(unsigned int index, Task task, std::atomic<int>* latch);
+
+    /**
+     * @brief Runs a task on a worker, updating its statistics and the pending count.
+     *
+     * The statistics are updated before the task's latch is released, so they are
+     * complete by the time its parallelFor() call returns.
+     *
+     * @param index Index of the running worker
+     * @param task The task
+     * @param stolen The task was taken from another worker's deque
+     */
+    void runTask(unsigned int index, QueuedTask& task, bool stolen);
+
+public:
+    /**
+     * @brief Starts a scheduler with the given number of workers.
+     *
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit WorkStealingScheduler(unsigned int threadCount = 0);
+
+    /**
+     * @brief Finishes all queued tasks and joins the workers.
+     */
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return Worker count
+     */
+    unsigned int size() const;
+
+    /**
+     * @brief Queues a task.
+     *
+     * From inside a task the task goes to the running worker's deque; from any other
+     * thread the workers are chosen round-robin.
+     *
+     * @param task Callable taking the worker index
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Queues a task on a specific worker's deque (other workers may still steal it).
+     *
+     * @param worker Index of the worker, taken modulo size()
+     * @param task Callable taking the worker index
+     */
+    void submitTo(unsigned int worker, Task task);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     *
+     * Must not be called from inside a task (it would wait for that task itself).
+     */
+    void wait();
+
+    /**
+     * @brief Runs job(begin, end, worker) over [0, count) split into chunks, and waits.
+     *
+     * The range is split into contiguous blocks, one block of chunks per worker;
+     * workers that finish early steal the remaining chunks of slower workers.
+     * Returns when these chunks have finished; other tasks may still be running.
+     * Called from inside a task, the waiting worker runs queued tasks meanwhile.
+     *
+     * @param count Size of the range
+     * @param chunkSize Number of indices per task (0 = about 8 tasks per worker)
+     * @param job Callable `void(int begin, int end, unsigned int worker)`
+     */
+    void parallelFor(int count, int chunkSize, const std::function<void(int, int, unsigned int)>& job);
+
+    /**
+     * @brief Returns the statistics of all workers (call while no task is running).
+     *
+     * The statistics of a parallelFor() call's chunks are complete when it returns.
+     *
+     * @return One WorkerStats per worker
+     */
+    std::vector<WorkerStats> getStats() const;
+
+    /**
+     * @brief Resets the statistics of all workers (call while no task is running).
+     */
+    void resetStats();
+};
+
+#endif // WORK_STEALING_SCHEDULER_H
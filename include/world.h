@@ -2,8 +2,54 @@
 #define WORLD_H
 
 #include <vector>
+#include <cstdint>
+#include <functional>
+#include <utility>
 #include "state.h"
 
+/**
+ * @brief Linear index of a cell inside the world's padded storage buffer.
+ *
+ * Cell ids address the same cells as State, but avoid repeated `y * width + x`
+ * arithmetic. Ids of the 8 neighbors of a cell are obtained by adding a
+ * constant offset (see World::getStride()).
+ */
+using CellId = std::int32_t;
+
+
+/**
+ * @struct DirtyRegion
+ * @brief Rectangle of cells changed by the world up to a given epoch (see World::getChangesSince).
+ *
+ * Bounds are inclusive grid coordinates. A region may include cells whose weight did
+ * not change: nearby changes are merged into one rectangle.
+ */
+struct DirtyRegion
+{
+    std::uint64_t epoch;   // Epoch of the latest change in the region
+    int minX;              // Left column
+    int minY;              // Top row
+    int maxX;              // Right column
+    int maxY;              // Bottom row
+};
+
+/**
+ * @struct WorldChanges
+ * @brief Answer to "what changed since epoch E?".
+ *
+ * - epoch: The current epoch of the world; pass it to the next query
+ * - fullInvalidation: The journal no longer covers E (entries after E were dropped on
+ *   overflow, or E is not an epoch of this world): everything must be treated as
+ *   changed, regions is empty
+ * - regions: Changed rectangles in epoch order (may overlap); empty if nothing changed
+ */
+struct WorldChanges
+{
+    std::uint64_t epoch = 0;           // Current epoch of the world
+    bool fullInvalidation = false;     // Changes since E are unknown: assume everything changed
+    std::vector<DirtyRegion> regions;  // Changed rectangles since E
+};
+
 
 /**
  * @class World
@@ -14,17 +60,64 @@
  * or blocked.
  *
  * It does not handle agent logic, path planning, or decision-making.
+ *
+ * Storage layout:
+ * The weights are kept in a single row-major buffer surrounded by a one-cell
+ * ring of blocked sentinel cells. A world of size W x H therefore occupies
+ * (W + 2) x (H + 2) entries, and every in-grid cell has all 8 neighbors inside
+ * the buffer. Neighbor lookups by CellId need no bounds checks: a neighbor
+ * outside the grid simply reads as BLOCK.
+ *
+ * Change notifications:
+ * Incremental planners register a WeightListener, which setWeight() and clearGrid()
+ * call for every cell whose weight actually changed, after the change. Listeners run
+ * on the thread that modifies the world and must not modify it themselves.
+ *
+ * Change journal:
+ * Every call that changes at least one weight increments the world's epoch and
+ * appends a DirtyRegion (a cell, or the whole grid for clearGrid()). A change next
+ * to the last region is merged into it while the rectangle stays within
+ * JOURNAL_MERGE_AREA cells, so walls and patches drawn cell by cell take one entry.
+ * Caches remember the epoch they were built at and ask getChangesSince() later; the
+ * entries are found by binary search. The journal holds at most its capacity of
+ * regions: when it overflows, its older half is dropped and coalesces into a full
+ * invalidation for every epoch it covered, so memory stays bounded however long the
+ * world runs while recent consumers keep getting regions.
  */
 class World 
 {
 public:
     static constexpr double BLOCK = -1.0; // Represents a blocked cell (obstacle)
     static constexpr double FREE = 1.0;  // Default weight for free cells
+    static constexpr CellId INVALID_CELL = -1; // Cell id of a position outside the grid
+    static constexpr size_t DEFAULT_JOURNAL_CAPACITY = 1024; // Regions kept before a full invalidation
+    static constexpr int JOURNAL_MERGE_AREA = 64; // Largest rectangle (cells) built by merging changes
+
+    using WeightListener = std::function<void(const State&)>; // Called with a cell whose weight changed
 
 private:
-    int width;                             // Width of the world (number of columns)
-    int height;                            // Height of the world (number of rows)
-    std::vector<std::vector<double>> grid; // Grid storing weights for each cell
+    int width;                 // Width of the world (number of columns)
+    int height;                // Height of the world (number of rows)
+    int stride;                // Row length of the padded buffer (width + 2)
+    std::vector<double> grid;  // Padded row-major buffer storing weights for each cell
+    std::uint64_t obstacleVersion = 0; // Incremented whenever cells become blocked or free
+    std::uint64_t instanceId;  // Unique per World object (copies get their own)
+    std::vector<std::pair<int, WeightListener>> listeners; // Registered listeners and their ids
+    int nextListenerId = 0;    // Id of the next registered listener
+    std::uint64_t epoch = 0;   // Number of changes so far
+    std::uint64_t invalidatedEpoch = 0; // Changes up to this epoch are no longer in the journal
+    size_t journalCapacity = DEFAULT_JOURNAL_CAPACITY; // Maximum number of journal entries
+    std::vector<DirtyRegion> journal; // Changed regions after invalidatedEpoch, by epoch
+
+    /**
+     * @brief Starts a new epoch and records the changed rectangle in the journal.
+     *
+     * @param minX Left column
+     * @param minY Top row
+     * @param maxX Right column
+     * @param maxY Bottom row
+     */
+    void recordChange(int minX, int minY, int maxX, int maxY);
 
     /**
      * @brief Checks if the given coordinates are within world boundaries.
@@ -50,6 +143,32 @@ public:
      */
     World(int w, int h);
 
+    /**
+     * @brief Copies the weights of another world.
+     *
+     * The copy gets its own instance id, so caches bound to the original are not
+     * mistaken as built for the copy. The epoch and change journal are copied, so
+     * epochs of the original stay meaningful for the copy. Weight listeners are not
+     * copied: they belong to the original, and a copy starts with none.
+     *
+     * @param other The world to copy
+     */
+    World(const World& other);
+
+    /**
+     * @brief Replaces the weights with those of another world.
+     *
+     * The world gets a new instance id: caches bound to it before the assignment
+     * no longer recognize it. The assignment counts as one change that fully
+     * invalidates every earlier epoch; the journal capacity is kept. Its own weight
+     * listeners stay registered and are not told about the replaced weights; those
+     * of the other world are not copied.
+     *
+     * @param other The world to copy
+     * @return This world
+     */
+    World& operator=(const World& other);
+
     /**
      * @brief Returns the width of the world.
      *
@@ -64,6 +183,109 @@ public:
      */
     int getHeight() const;
 
+    /**
+     * @brief Returns the row length of the padded storage buffer.
+     *
+     * Moving one row up or down changes a CellId by exactly this amount.
+     *
+     * @return Stride of the buffer (width + 2)
+     */
+    int getStride() const;
+
+    /**
+     * @brief Returns the total number of entries in the padded storage buffer.
+     *
+     * Every valid CellId (including sentinel cells) is smaller than this value,
+     * so it can be used to size per-cell arrays indexed by CellId.
+     *
+     * @return Number of cells in the buffer ((width + 2) * (height + 2))
+     */
+    int getCellCount() const;
+
+    /**
+     * @brief Returns a counter of obstacle changes.
+     *
+     * Increases whenever setWeight() blocks or frees a cell and on clearGrid();
+     * weight changes between free values leave it unchanged. Caches that depend
+     * only on obstacles compare it with the value they were built at.
+     *
+     * @return Obstacle version of the world
+     */
+    std::uint64_t getObstacleVersion() const;
+
+    /**
+     * @brief Returns an id no other World object has had during this run.
+     *
+     * Unlike the object's address, the id is never reused after the world is
+     * destroyed, so caches can use it to recognize the world they were built for.
+     *
+     * @return Instance id (> 0)
+     */
+    std::uint64_t getInstanceId() const;
+
+    /**
+     * @brief Converts a state to its cell id without bounds checking.
+     *
+     * The state must lie inside the grid or on the sentinel ring around it.
+     *
+     * @param s The state to convert
+     *
+     * @return CellId of the state
+     */
+    CellId toCell(const State& s) const
+    {
+        return (s.y + 1) * stride + (s.x + 1);
+    }
+
+    /**
+     * @brief Converts a state to its cell id, checking the grid boundaries.
+     *
+     * @param s The state to convert
+     *
+     * @return CellId of the state, or `INVALID_CELL` if it is out of bounds
+     */
+    CellId findCell(const State& s) const;
+
+    /**
+     * @brief Converts a cell id back to the state it represents.
+     *
+     * @param id The cell id to convert
+     *
+     * @return State (x, y) of the cell
+     */
+    State toState(CellId id) const
+    {
+        return { id % stride - 1, id / stride - 1 };
+    }
+
+    /**
+     * @brief Returns the weight of a cell addressed by its id (no bounds checking).
+     *
+     * Sentinel cells around the grid return `BLOCK`.
+     *
+     * @param id The cell id
+     *
+     * @return Weight of the cell
+     */
+    double getWeight(CellId id) const
+    {
+        return grid[id];
+    }
+
+    /**
+     * @brief Checks whether a cell addressed by its id is free (no bounds checking).
+     *
+     * Sentinel cells around the grid are never free.
+     *
+     * @param id The cell id
+     *
+     * @return true if the cell is free (walkable), false otherwise
+     */
+    bool isFree(CellId id) const
+    {
+        return grid[id] != BLOCK;
+    }
+
     /**
      * @brief Returns the weight (movement cost) of a given cell.
      *
@@ -109,6 +331,77 @@ public:
      * It will override all previously set weights, including blocked cells (which had weight = -1.0), setting them all to the default value of 1.0.
      */
     void clearGrid();
+
+    /**
+     * @brief Registers a function that is told about every cell whose weight changes.
+     *
+     * @param listener Called with the state of each changed cell
+     *
+     * @return Id for removeWeightListener
+     */
+    int addWeightListener(WeightListener listener);
+
+    /**
+     * @brief Unregisters a listener.
+     *
+     * @param id Id returned by addWeightListener; unknown ids are ignored
+     */
+    void removeWeightListener(int id);
+
+    /**
+     * @brief Returns the current epoch (number of changes since construction).
+     *
+     * @return Epoch, starting at 0
+     */
+    std::uint64_t getEpoch() const
+    {
+        return epoch;
+    }
+
+    /**
+     * @brief Checks in O(1) whether anything changed since an epoch.
+     *
+     * @param since Epoch returned by getEpoch() earlier
+     * @return true if any weight changed after that epoch
+     */
+    bool hasChangedSince(std::uint64_t since) const
+    {
+        return epoch != since;
+    }
+
+    /**
+     * @brief Returns the regions changed after an epoch.
+     *
+     * O(log(journal size) + number of regions returned).
+     *
+     * @param since Epoch returned by getEpoch() earlier
+     * @return The current epoch and the changed regions, or a full invalidation
+     */
+    WorldChanges getChangesSince(std::uint64_t since) const;
+
+    /**
+     * @brief Sets the maximum number of regions in the journal.
+     *
+     * A smaller capacity than the current journal size empties the journal (full
+     * invalidation of all earlier epochs). Capacity 0 keeps no journal at all.
+     *
+     * @param capacity Maximum number of regions
+     */
+    void setJournalCapacity(size_t capacity);
+
+    /**
+     * @brief Returns the maximum number of regions in the journal.
+     *
+     * @return Journal capacity
+     */
+    size_t getJournalCapacity() const;
+
+    /**
+     * @brief Returns the number of regions currently in the journal.
+     *
+     * @return Journal size
+     */
+    size_t getJournalSize() const;
 };
 
 #endif // WORLD_H
\ No newline at end of file
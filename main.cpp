@@ -1,4 +1,5 @@
 ﻿#include "simulation.h"
+#include "benchmark.h"
 #include "run_tests.h"    
 #include "colors.h"
 #include <iostream>
@@ -16,7 +17,8 @@ void printMainMenu()
     std::cout << Colors::CYAN << "  [1]  Run Unit Tests" << Colors::RESET << "\n";
     std::cout << Colors::CYAN << "  [2]  Run Console Simulation" << Colors::RESET << "\n";
     std::cout << Colors::CYAN << "  [3]  Compare All Algorithms" << Colors::RESET << "\n";
-    std::cout << Colors::CYAN << "  [4]  Exit" << Colors::RESET << "\n\n";
+    std::cout << Colors::CYAN << "  [4]  Run Benchmarks" << Colors::RESET << "\n";
+    std::cout << Colors::CYAN << "  [5]  Exit" << Colors::RESET << "\n\n";
 
     std::cout << Colors::LIGHT_PURPLE << "-------------------------------------" << Colors::RESET << "\n";
     std::cout << Colors::GRAY << "Select option: " << Colors::RESET;
@@ -34,6 +36,10 @@ SearchType chooseAlgorithm()
     std::cout << "  [1] BFS\n";
     std::cout << "  [2] Dijkstra\n";
     std::cout << "  [3] A*\n";
+    std::cout << "  [4] JPS\n";
+    std::cout << "  [5] JPS+\n";
+    std::cout << "  [6] Bidirectional Dijkstra\n";
+    std::cout << "  [7] Bidirectional A*\n";
     std::cout << "Choice: ";
 
     std::cin >> choice;
@@ -45,6 +51,18 @@ SearchType chooseAlgorithm()
     case 3: 
         return SearchType::AStar;
 
+    case 4:
+        return SearchType::JPS;
+
+    case 5:
+        return SearchType::JPSPlus;
+
+    case 6:
+        return SearchType::BidirectionalDijkstra;
+
+    case 7:
+        return SearchType::BidirectionalAStar;
+
     default: 
         return SearchType::BFS;
     }
@@ -95,6 +113,19 @@ void runComparison()
 }
 
 
+// -----------------------------
+// RUN BENCHMARKS - HELPER
+// -----------------------------
+void runBenchmarks()
+{
+    Benchmark::runAll();
+
+    std::cout << "\nPress Enter to return to menu...";
+    std::cin.ignore();
+    std::cin.get();
+}
+
+
 // -------------------------
 // MAIN
 // -------------------------
@@ -124,6 +155,10 @@ int main()
             break;
 
         case 4:
+            runBenchmarks();
+            break;
+
+        case 5:
             running = false;
             break;
 
@@ -0,0 +1,72 @@
+#include "allocation_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+#ifdef PATHFINDER_COUNT_ALLOCATIONS
+
+// Number of calls to the global operator new
+static std::atomic<std::size_t> allocations(0);
+
+
+/******************** COUNT ********************/
+
+std::size_t AllocationCounter::count()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+
+/****************** IS ENABLED *****************/
+
+bool AllocationCounter::isEnabled()
+{
+    return true;
+}
+
+
+/********** GLOBAL OPERATOR NEW / DELETE **********/
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* memory = std::malloc(size != 0 ? size : 1))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+#else
+
+/******************** COUNT ********************/
+
+std::size_t AllocationCounter::count()
+{
+    return 0;
+}
+
+
+/****************** IS ENABLED *****************/
+
+bool AllocationCounter::isEnabled()
+{
+    return false;
+}
+
+#endif // PATHFINDER_COUNT_ALLOCATIONS
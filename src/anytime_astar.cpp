@@ -0,0 +1,203 @@
+#include "anytime_astar.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+
+/**************** NEXT ITERATION ***************/
+
+void AnytimeAStar::nextIteration(int cellCount)
+{
+    if (closedIn.size() < static_cast<size_t>(cellCount))
+    {
+        closedIn.resize(cellCount, 0);
+        inconsIn.resize(cellCount, 0);
+    }
+
+    // After a wrap-around, stamps of old iterations could match again
+    if (++iteration == 0)
+    {
+        std::fill(closedIn.begin(), closedIn.end(), 0);
+        std::fill(inconsIn.begin(), inconsIn.end(), 0);
+        iteration = 1;
+    }
+
+    inconsistent.clear();
+}
+
+
+/****************** IMPROVE PATH ***************/
+
+bool AnytimeAStar::improvePath(const Graph& graph, const State& goal, double weight, SearchBudget& budget,
+    AnytimeResults& results)
+{
+    const World& world = *graph.getWorld();
+    CellId goalCell = world.toCell(goal);
+
+    // The goal's f is its g (h = 0): stop once no open cell has a smaller f
+    while (!open.empty() && workspace.getCost(goalCell) > open.topPriority())
+    {
+        CellId cell = World::INVALID_CELL;
+        double g = 0.0;
+
+        results.stopReason = budget.check(results.nodesExpanded);
+
+        if (results.stopReason != SearchStop::Completed)
+        {
+            return false;
+        }
+
+        cell = open.pop();
+        g = workspace.getCost(cell);
+        closedIn[cell] = iteration;
+        results.nodesExpanded++;
+
+        graph.forEachNeighbor(cell, [&](CellId next, double cost)
+        {
+            if (g + cost >= workspace.getCost(next))
+            {
+                return;
+            }
+
+            workspace.update(next, g + cost, cell);
+
+            // Expanded cells are not reopened in this iteration, only remembered for the next one
+            if (closedIn[next] != iteration)
+            {
+                open.push(next, g + cost + weight * Graph::chebyshevDistance(world.toState(next), goal));
+            }
+            else if (inconsIn[next] != iteration)
+            {
+                inconsIn[next] = iteration;
+                inconsistent.push_back(next);
+            }
+        });
+    }
+
+    return true;
+}
+
+
+/********************* SEARCH ******************/
+
+AnytimeResults AnytimeAStar::search(const Graph& graph, const State& start, const State& goal,
+    const AnytimeSettings& settings, const SearchLimits& limits)
+{
+    const World& world = *graph.getWorld();
+    auto startTime = std::chrono::steady_clock::now();
+    SearchBudget budget(limits);
+    AnytimeResults results;
+    int cellCount = world.getCellCount();
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
+    double weight = std::max(1.0, settings.initialWeight);
+    double finalWeight = std::min(std::max(1.0, settings.finalWeight), weight);
+    double bestCost = SearchWorkspace::INF;
+    double bestBound = SearchWorkspace::INF;
+
+    workspace.prepare(cellCount);
+    open.reserve(cellCount);
+    nextIteration(cellCount);
+
+    workspace.update(startCell, 0.0, startCell);
+    open.push(startCell, weight * Graph::chebyshevDistance(start, goal));
+
+    while (true)
+    {
+        AnytimeSolution solution;
+        double lowest = SearchWorkspace::INF;
+        CellId current = goalCell;
+        size_t length = 1;
+
+        results.iterations++;
+
+        if (!improvePath(graph, goal, weight, budget, results))
+        {
+            results.truncated = true;
+            break;
+        }
+
+        // Open list exhausted without reaching the goal
+        if (workspace.getCost(goalCell) == SearchWorkspace::INF)
+        {
+            break;
+        }
+
+        // Drain the open list: the bound needs all its cells, and the next iteration re-keys them
+        pending.clear();
+
+        while (!open.empty())
+        {
+            pending.push_back(open.pop());
+        }
+
+        for (CellId cell : pending)
+        {
+            lowest = std::min(lowest, workspace.getCost(cell) + Graph::chebyshevDistance(world.toState(cell), goal));
+        }
+
+        for (CellId cell : inconsistent)
+        {
+            lowest = std::min(lowest, workspace.getCost(cell) + Graph::chebyshevDistance(world.toState(cell), goal));
+        }
+
+        // Every parent has a lower g than its child, so the walk ends at the start
+        for (current = goalCell; current != startCell; current = workspace.getParent(current))
+        {
+            length++;
+        }
+
+        solution.path.resize(length);
+
+        for (current = goalCell; current != startCell; current = workspace.getParent(current))
+        {
+            solution.path[--length] = world.toState(current);
+        }
+        solution.path[0] = start;
+
+        for (size_t i = 1; i < solution.path.size(); ++i)
+        {
+            solution.cost += graph.getCost(solution.path[i - 1], solution.path[i]);
+        }
+
+        // No path can cost less than the lowest g + h that could still improve the goal
+        solution.weight = weight;
+        solution.bound = (solution.cost <= lowest) ? 1.0 : std::min(weight, solution.cost / lowest);
+        solution.nodesExpanded = results.nodesExpanded;
+        solution.time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        if (solution.cost < bestCost - 1e-9 || solution.bound < bestBound - 1e-9)
+        {
+            bestCost = std::min(bestCost, solution.cost);
+            bestBound = std::min(bestBound, solution.bound);
+
+            if (settings.onSolution)
+            {
+                settings.onSolution(solution);
+            }
+
+            results.solutions.push_back(std::move(solution));
+        }
+
+        if (bestBound <= 1.0 + 1e-9 || weight <= finalWeight)
+        {
+            break;
+        }
+
+        weight = (settings.weightStep > 0.0) ? std::max(finalWeight, weight - settings.weightStep) : finalWeight;
+
+        // Next iteration: open and inconsistent cells, keyed with the new weight
+        pending.insert(pending.end(), inconsistent.begin(), inconsistent.end());
+        nextIteration(cellCount);
+
+        for (CellId cell : pending)
+        {
+            open.push(cell, workspace.getCost(cell) + weight * Graph::chebyshevDistance(world.toState(cell), goal));
+        }
+    }
+
+    results.success = !results.solutions.empty();
+    results.executionTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    return results;
+}
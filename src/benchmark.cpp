@@ -0,0 +1,1363 @@
+#include "benchmark.h"
+#include "allocation_counter.h"
+#include "stats_manager.h"
+#include "world.h"
+#include "graph.h"
+#include "jump_point_table.h"
+#include "work_stealing_scheduler.h"
+#include "delta_stepping.h"
+#include "direction_optimizing_bfs.h"
+#include "flow_field.h"
+#include "distance_matrix.h"
+#include "d_star_lite.h"
+#include "lpa_star.h"
+#include "versioned_world.h"
+#include "snapshot_reader.h"
+#include "search_workspace.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <iomanip>
+#include <memory_resource>
+
+
+// Static helper function declarations
+static void fillRandomWorld(World& world, std::mt19937& rng, int obstaclePercentage);
+
+static std::vector<std::pair<State, State>> generateQueries(const World& world, std::mt19937& rng, int count);
+
+
+/******************* RUN ALL *******************/
+
+void Benchmark::runAll()
+{
+    runBidirectionalBenchmark(400, 40);
+    runBatchBenchmark(200, 500);
+    runSchedulerBenchmark(300, 2000);
+    runAllocationBenchmark(150, 200);
+    runDeltaSteppingBenchmark(1000);
+    runBitParallelBFSBenchmark(1000, 40);
+    runDirectionOptimizingBFSBenchmark(2000);
+    runFlowFieldBenchmark(400, 200);
+    runDistanceMatrixBenchmark(250, 30, 30);
+    runNearestGoalBenchmark(300, 20);
+    runTimeBudgetBenchmark(600, 20, 10.0);
+    runAnytimeBenchmark(600, 20);
+    runDStarLiteBenchmark(500, 300);
+    runLPAStarBenchmark(300, 60);
+    runChangeJournalBenchmark(1000, 200);
+    runSnapshotBenchmark(400, 40);
+}
+
+
+/********** RUN BIDIRECTIONAL BENCHMARK ********/
+
+void Benchmark::runBidirectionalBenchmark(int size, int queryCount)
+{
+    std::mt19937 rng(12345);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<std::pair<State, State>> queries;
+    bool sameCosts = true;
+
+    fillRandomWorld(world, rng, 20);
+    queries = generateQueries(world, rng, queryCount);
+
+    std::cout << "\nBidirectional search: " << queries.size() << " queries on a "
+        << size << "x" << size << " world, " << std::thread::hardware_concurrency() << " hardware threads\n";
+
+    for (SearchType type : { SearchType::BidirectionalDijkstra, SearchType::BidirectionalAStar })
+    {
+        std::vector<std::pair<std::string, double>> rows;
+        std::vector<double> sequentialCosts;
+        std::string name = (type == SearchType::BidirectionalDijkstra) ? "Bi-Dijkstra" : "Bi-A*";
+        size_t i = 0;
+
+        for (BidirectionalMode mode : { BidirectionalMode::Sequential, BidirectionalMode::Parallel })
+        {
+            auto startTime = std::chrono::steady_clock::now();
+
+            planner.setBidirectionalMode(mode);
+
+            for (i = 0; i < queries.size(); ++i)
+            {
+                PlanResults result = planner.plan(queries[i].first, queries[i].second, type);
+
+                if (mode == BidirectionalMode::Sequential)
+                {
+                    sequentialCosts.push_back(result.totalCost);
+                }
+                else if (std::abs(result.totalCost - sequentialCosts[i]) > 1e-9)
+                {
+                    sameCosts = false;
+                }
+            }
+
+            auto endTime = std::chrono::steady_clock::now();
+            rows.push_back({ name + ((mode == BidirectionalMode::Sequential) ? " (1 thread)" : " (2 threads)"),
+                std::chrono::duration<double, std::milli>(endTime - startTime).count() });
+        }
+
+        StatsManager::printTimingComparison(rows);
+    }
+
+    std::cout << "Parallel costs match sequential costs: " << (sameCosts ? "VERIFIED" : "FAILED") << "\n";
+}
+
+
+/************* RUN BATCH BENCHMARK *************/
+
+void Benchmark::runBatchBenchmark(int size, int queryCount)
+{
+    std::mt19937 rng(54321);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<PlanQuery> batch;
+    std::vector<PlanResults> serial;
+    BatchResults parallel;
+    bool sameCosts = true;
+    size_t i = 0;
+
+    fillRandomWorld(world, rng, 20);
+
+    for (const auto& [start, goal] : generateQueries(world, rng, queryCount))
+    {
+        batch.push_back({ start, goal, SearchType::AStar });
+    }
+
+    std::cout << "\nQuery batch: " << batch.size() << " A* queries on a " << size << "x" << size << " world\n";
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (const auto& query : batch)
+    {
+        serial.push_back(planner.plan(query.start, query.goal, query.type));
+    }
+    auto endTime = std::chrono::steady_clock::now();
+
+    // Warm-up batch creates the pool and sizes the worker workspaces
+    planner.planBatch(batch);
+    parallel = planner.planBatch(batch);
+
+    for (i = 0; i < batch.size(); ++i)
+    {
+        sameCosts &= std::abs(serial[i].totalCost - parallel.results[i].totalCost) < 1e-9;
+    }
+
+    StatsManager::printTimingComparison({
+        { "Serial plan()", std::chrono::duration<double, std::milli>(endTime - startTime).count() },
+        { "planBatch (" + std::to_string(std::max(1u, std::thread::hardware_concurrency())) + " workers)", parallel.wallTime } });
+    StatsManager::printBatchResults("A*", parallel);
+
+    std::cout << "Batch results match serial results: " << (sameCosts ? "VERIFIED" : "FAILED") << "\n";
+}
+
+
+/*********** RUN SCHEDULER BENCHMARK ***********/
+
+void Benchmark::runSchedulerBenchmark(int size, int queryCount)
+{
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> offset(-4, 4);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<PlanQuery> batch;
+    std::vector<std::pair<std::string, double>> rows;
+    BatchResults stealing;
+    JumpPointTable table;
+    int i = 0;
+
+    fillRandomWorld(world, rng, 15);
+
+    // Walled-off corner: queries into it search the whole reachable world in vain
+    for (i = 0; i < 10; ++i)
+    {
+        world.setWeight({ size - 11, size - 1 - i }, World::BLOCK);
+        world.setWeight({ size - 1 - i, size - 11 }, World::BLOCK);
+    }
+    world.setWeight({ size - 11, size - 11 }, World::BLOCK);
+    world.setWeight({ size - 3, size - 3 }, World::FREE);
+
+    for (const auto& [start, goal] : generateQueries(world, rng, queryCount))
+    {
+        State target{ std::clamp(start.x + offset(rng), 0, size - 12), std::clamp(start.y + offset(rng), 0, size - 12) };
+
+        // One query in 50 is expensive; the others stay within a few cells
+        if (batch.size() % 50 == 0)
+        {
+            target = { size - 3, size - 3 };
+        }
+        else if (!world.isFree(target))
+        {
+            target = goal;
+        }
+
+        batch.push_back({ start, target, SearchType::AStar });
+    }
+
+    std::cout << "\nSkewed batch: " << batch.size() << " A* queries (2% unreachable) on a "
+        << size << "x" << size << " world\n";
+
+    for (BatchScheduler scheduler : { BatchScheduler::SharedQueue, BatchScheduler::WorkStealing })
+    {
+        planner.setBatchScheduler(scheduler);
+        planner.planBatch(batch);  // warm-up
+        BatchResults result = planner.planBatch(batch);
+
+        rows.push_back({ (scheduler == BatchScheduler::SharedQueue) ? "Shared queue" : "Work stealing", result.wallTime });
+
+        if (scheduler == BatchScheduler::WorkStealing)
+        {
+            stealing = result;
+        }
+    }
+
+    StatsManager::printTimingComparison(rows);
+    StatsManager::printWorkerStats(stealing.workerStats, stealing.wallTime);
+
+    // Precomputation jobs on the same kind of scheduler
+    WorkStealingScheduler scheduler;
+    auto startTime = std::chrono::steady_clock::now();
+    table.build(world, scheduler);
+    auto endTime = std::chrono::steady_clock::now();
+
+    std::cout << "JumpPointTable build as scheduler jobs: " << std::fixed << std::setprecision(3)
+        << std::chrono::duration<double, std::milli>(endTime - startTime).count() << " ms\n";
+    StatsManager::printWorkerStats(scheduler.getStats(), std::chrono::duration<double, std::milli>(endTime - startTime).count());
+}
+
+
+/*********** RUN ALLOCATION BENCHMARK **********/
+
+void Benchmark::runAllocationBenchmark(int size, int queryCount)
+{
+    struct Setup
+    {
+        std::string name;
+        SearchType type;
+        SearchEngine engine;
+        OpenListType openList;
+    };
+
+    const std::vector<Setup> setups =
+    {
+        { "BFS", SearchType::BFS, SearchEngine::Dense, OpenListType::BinaryHeap },
+        { "Dijkstra (binary)", SearchType::Dijkstra, SearchEngine::Dense, OpenListType::BinaryHeap },
+        { "A* (binary)", SearchType::AStar, SearchEngine::Dense, OpenListType::BinaryHeap },
+        { "A* (4-ary)", SearchType::AStar, SearchEngine::Dense, OpenListType::IndexedHeap },
+        { "A* (radix)", SearchType::AStar, SearchEngine::Dense, OpenListType::RadixHeap },
+        { "Bi-A*", SearchType::BidirectionalAStar, SearchEngine::Dense, OpenListType::BinaryHeap },
+        { "JPS", SearchType::JPS, SearchEngine::Dense, OpenListType::BinaryHeap },
+        { "A* (hashed)", SearchType::AStar, SearchEngine::Hashed, OpenListType::BinaryHeap }
+    };
+
+    std::mt19937 rng(777);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<std::pair<State, State>> queries;
+    std::vector<std::tuple<std::string, double, double, double>> rows;
+
+    fillRandomWorld(world, rng, 20);
+    queries = generateQueries(world, rng, queryCount);
+
+    std::cout << "\nHeap allocations per query: " << queries.size() << " queries on a "
+        << size << "x" << size << " world, one PlannerContext per search\n";
+
+    if (!AllocationCounter::isEnabled())
+    {
+        std::cout << "Allocation counting is off: build with -DPATHFINDER_COUNT_ALLOCATIONS (Visual Studio: Benchmark configuration) to enable it\n";
+        return;
+    }
+
+    for (const auto& setup : setups)
+    {
+        PlannerContext context;
+        std::pmr::vector<State> pathBuffer;
+        size_t first = 0;
+        size_t warm = 0;
+        size_t buffered = 0;
+        size_t i = 0;
+
+        planner.setEngine(setup.engine);
+        planner.setOpenList(setup.openList);
+
+        // First pass warms the context and the path buffer up, the other two are measured
+        for (i = 0; i < queries.size(); ++i)
+        {
+            size_t before = AllocationCounter::count();
+            planner.plan(queries[i].first, queries[i].second, setup.type, context, pathBuffer);
+
+            if (i == 0)
+            {
+                first = AllocationCounter::count() - before;
+            }
+        }
+
+        for (i = 0; i < queries.size(); ++i)
+        {
+            size_t before = AllocationCounter::count();
+            planner.plan(queries[i].first, queries[i].second, setup.type, context);
+            warm += AllocationCounter::count() - before;
+        }
+
+        for (i = 0; i < queries.size(); ++i)
+        {
+            size_t before = AllocationCounter::count();
+            planner.plan(queries[i].first, queries[i].second, setup.type, context, pathBuffer);
+            buffered += AllocationCounter::count() - before;
+        }
+
+        double warmQueries = static_cast<double>(std::max<size_t>(1, queries.size()));
+        rows.push_back({ setup.name, static_cast<double>(first), warm / warmQueries, buffered / warmQueries });
+    }
+
+    StatsManager::printAllocationCounts(rows);
+}
+
+
+/********* RUN DELTA STEPPING BENCHMARK ********/
+
+void Benchmark::runDeltaSteppingBenchmark(int size)
+{
+    std::mt19937 rng(99);
+    World world(size, size);
+    Graph graph(&world);
+    State source{ size / 2, size / 2 };
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<std::string> details;
+    std::vector<unsigned int> threadCounts = { 1, 2, 4 };
+    unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    ShortestPathTree reference;
+    bool allMatch = true;
+
+    fillRandomWorld(world, rng, 20);
+    world.setWeight(source, World::FREE);
+
+    if (hardwareThreads > 4)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    auto matches = [&reference](const ShortestPathTree& tree)
+    {
+        for (size_t i = 0; i < reference.distance.size(); ++i)
+        {
+            double expected = reference.distance[i];
+            double actual = tree.distance[i];
+
+            if ((expected == SearchWorkspace::INF) != (actual == SearchWorkspace::INF) ||
+                (expected != SearchWorkspace::INF && std::abs(expected - actual) > 1e-9))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    std::cout << "\nSingle-source shortest paths over a " << size << "x" << size << " weighted world\n";
+
+    reference = DeltaStepping(graph, 1).runSequential(source);
+    rows.push_back({ "Dijkstra (sequential)", reference.executionTime });
+
+    // Thread scaling with the automatic delta
+    for (unsigned int threads : threadCounts)
+    {
+        DeltaStepping engine(graph, threads);
+        engine.run(source);  // warm-up
+        ShortestPathTree tree = engine.run(source);
+
+        allMatch &= matches(tree);
+        rows.push_back({ "Delta-stepping, " + std::to_string(threads) + " thr", tree.executionTime });
+    }
+
+    StatsManager::printTimingComparison(rows);
+    rows.clear();
+
+    // Delta sweep on all hardware threads: small deltas do less work, large ones more per bucket
+    DeltaStepping engine(graph, hardwareThreads);
+
+    for (double delta : { 1.0, 4.0, 0.0, 32.0 })
+    {
+        engine.setDelta(delta);
+        engine.run(source);  // warm-up
+        ShortestPathTree tree = engine.run(source);
+
+        allMatch &= matches(tree);
+        rows.push_back({ (delta > 0.0) ? "delta = " + std::to_string(static_cast<int>(delta))
+            : std::string("delta = auto (max edge)"), tree.executionTime });
+
+        details.push_back(std::to_string(tree.buckets) + " buckets, " + std::to_string(tree.relaxations) + " relaxations");
+    }
+
+    StatsManager::printTimingComparison(rows);
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        std::cout << std::left << std::setw(28) << rows[i].first << details[i] << "\n";
+    }
+
+    std::cout << "Distances match sequential Dijkstra: " << (allMatch ? "yes" : "NO") << "\n";
+}
+
+
+/******** RUN BIT-PARALLEL BFS BENCHMARK *******/
+
+void Benchmark::runBitParallelBFSBenchmark(int size, int queryCount)
+{
+    std::mt19937 rng(2024);
+    bool sameLengths = true;
+
+    std::cout << "\nBFS: " << queryCount << " queries on " << size << "x" << size << " worlds\n";
+
+    for (int obstacles : { 10, 30 })
+    {
+        World world(size, size);
+        Graph graph(&world);
+        Planner planner(graph);
+        std::vector<std::pair<std::string, double>> rows;
+        std::vector<std::pair<State, State>> queries;
+        std::vector<double> queueCosts;
+
+        fillRandomWorld(world, rng, obstacles);
+        queries = generateQueries(world, rng, queryCount);
+
+        for (BFSMode mode : { BFSMode::Queue, BFSMode::BitParallel })
+        {
+            double total = 0.0;
+            size_t i = 0;
+
+            planner.setBFSMode(mode);
+            planner.plan(queries[0].first, queries[0].second, SearchType::BFS);  // warm-up
+
+            for (i = 0; i < queries.size(); ++i)
+            {
+                PlanResults result = planner.plan(queries[i].first, queries[i].second, SearchType::BFS);
+                total += result.executionTime;
+
+                if (mode == BFSMode::Queue)
+                {
+                    queueCosts.push_back(result.totalCost);
+                }
+                else
+                {
+                    sameLengths &= (result.totalCost == queueCosts[i]);
+                }
+            }
+
+            rows.push_back({ std::string((mode == BFSMode::Queue) ? "Queue" : "Bit-parallel") + ", " +
+                std::to_string(obstacles) + "% blocked", total });
+        }
+
+        StatsManager::printTimingComparison(rows);
+    }
+
+    std::cout << "Path lengths match queue BFS: " << (sameLengths ? "yes" : "NO") << "\n";
+}
+
+
+/**** RUN DIRECTION-OPTIMIZING BFS BENCHMARK ***/
+
+void Benchmark::runDirectionOptimizingBFSBenchmark(int size)
+{
+    std::mt19937 rng(4242);
+    World world(size, size);
+    Graph graph(&world);
+    State source{ size / 2, size / 2 };
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<unsigned int> threadCounts = { 1, 2, 4 };
+    std::vector<unsigned int> topDownThreads = { 1 };
+    unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> reference;
+    std::vector<int> distance;
+    std::vector<BFSLayerStats> layers;
+    bool allMatch = true;
+
+    fillRandomWorld(world, rng, 5);
+    world.setWeight(source, World::FREE);
+
+    if (hardwareThreads > 1)
+    {
+        topDownThreads.push_back(hardwareThreads);
+    }
+
+    if (hardwareThreads > 4)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    // Runs one full BFS after a warm-up and returns its time
+    auto timeRun = [&](DirectionOptimizingBFS& bfs, std::vector<int>& output)
+    {
+        bfs.computeLayers(source, output, layers);  // warm-up
+        auto startTime = std::chrono::steady_clock::now();
+        bfs.computeLayers(source, output, layers);
+        auto endTime = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    };
+
+    std::cout << "\nBFS layers of every cell of a " << size << "x" << size << " world (5% blocked)\n";
+
+    // Top-down only: sequential baseline and all threads
+    for (unsigned int threads : topDownThreads)
+    {
+        DirectionOptimizingBFS bfs(graph, threads);
+        bfs.setSwitchThresholds(0.0, 0.0);
+
+        double time = timeRun(bfs, threads == 1 ? reference : distance);
+        allMatch &= (threads == 1) || distance == reference;
+        rows.push_back({ "Top-down, " + std::to_string(threads) + " thr", time });
+    }
+
+    for (unsigned int threads : threadCounts)
+    {
+        DirectionOptimizingBFS bfs(graph, threads);
+        double time = timeRun(bfs, distance);
+
+        allMatch &= (distance == reference);
+        rows.push_back({ "Direction-opt., " + std::to_string(threads) + " thr", time });
+    }
+
+    StatsManager::printTimingComparison(rows);
+    StatsManager::printBFSLayers(layers);
+
+    std::cout << "Layers match sequential top-down BFS: " << (allMatch ? "yes" : "NO") << "\n";
+}
+
+
+/*********** RUN FLOW FIELD BENCHMARK **********/
+
+void Benchmark::runFlowFieldBenchmark(int size, int agentCount)
+{
+    std::mt19937 rng(777);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    FlowField field(graph);
+    State depot{ size / 2, size / 2 };
+    std::vector<std::pair<State, State>> queries;
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<double> plannerCosts;
+    double total = 0.0;
+    bool sameCosts = true;
+
+    fillRandomWorld(world, rng, 20);
+    world.setWeight(depot, World::FREE);
+    queries = generateQueries(world, rng, agentCount);
+
+    std::cout << "\n" << agentCount << " agents heading to one depot on a " << size << "x" << size << " world\n";
+
+    planner.setOpenList(OpenListType::IndexedHeap);
+
+    for (const auto& query : queries)
+    {
+        PlanResults result = planner.plan(query.first, depot, SearchType::AStar);
+        total += result.executionTime;
+        plannerCosts.push_back(result.success ? result.totalCost : -1.0);
+    }
+
+    rows.push_back({ "A* per agent", total });
+
+    // One backward search, then only lookups per agent
+    auto startTime = std::chrono::steady_clock::now();
+    field.compute(depot);
+
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        std::vector<State> path = field.extractPath(queries[i].first);
+        double cost = 0.0;
+
+        for (size_t k = 1; k < path.size(); ++k)
+        {
+            cost += graph.getCost(path[k - 1], path[k]);
+        }
+
+        sameCosts &= path.empty() ? plannerCosts[i] < 0.0 : std::abs(cost - plannerCosts[i]) < 1e-6;
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    rows.push_back({ "Flow field + lookups", std::chrono::duration<double, std::milli>(endTime - startTime).count() });
+
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "Field build: " << std::fixed << std::setprecision(3) << field.getBuildTime() << " ms, "
+        << field.getReachedCells() << " cells reached, " << field.getFieldBytes() / 1024 << " KiB\n";
+    std::cout << "Path costs match A*: " << (sameCosts ? "yes" : "NO") << "\n";
+}
+
+
+
+/********* RUN DISTANCE MATRIX BENCHMARK *******/
+
+void Benchmark::runDistanceMatrixBenchmark(int size, int sourceCount, int targetCount)
+{
+    std::mt19937 rng(4242);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<State> sources;
+    std::vector<State> targets;
+    std::vector<double> pairwise;
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<unsigned int> threadCounts{ 1 };
+    unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    double total = 0.0;
+    size_t settledCells = 0;
+    bool sameCosts = true;
+
+    fillRandomWorld(world, rng, 20);
+
+    for (const auto& query : generateQueries(world, rng, std::max(sourceCount, targetCount)))
+    {
+        if (static_cast<int>(sources.size()) < sourceCount)
+        {
+            sources.push_back(query.first);
+        }
+
+        if (static_cast<int>(targets.size()) < targetCount)
+        {
+            targets.push_back(query.second);
+        }
+    }
+
+    if (hardware > 1)
+    {
+        threadCounts.push_back(hardware);
+    }
+
+    std::cout << "\n" << sourceCount << " x " << targetCount << " cost matrix on a " << size << "x" << size << " world\n";
+
+    planner.setOpenList(OpenListType::IndexedHeap);
+
+    for (const State& source : sources)
+    {
+        for (const State& target : targets)
+        {
+            PlanResults result = planner.plan(source, target, SearchType::AStar);
+            total += result.executionTime;
+            pairwise.push_back(result.success ? result.totalCost : SearchWorkspace::INF);
+        }
+    }
+
+    rows.push_back({ "Pairwise A*", total });
+
+    for (unsigned int threads : threadCounts)
+    {
+        DistanceMatrix matrix(graph, threads);
+
+        matrix.compute(sources, targets);
+        settledCells = matrix.getSettledCells();
+
+        for (size_t k = 0; k < pairwise.size(); ++k)
+        {
+            sameCosts &= (pairwise[k] == SearchWorkspace::INF) ? matrix.getCosts()[k] == pairwise[k] :
+                std::abs(matrix.getCosts()[k] - pairwise[k]) < 1e-6;
+        }
+
+        rows.push_back({ "Distance matrix, " + std::to_string(threads) + " thr", matrix.getExecutionTime() });
+    }
+
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "Cells settled per source: " << settledCells / sources.size() << " of " << size * size << "\n";
+    std::cout << "Costs match pairwise A*: " << (sameCosts ? "yes" : "NO") << "\n";
+}
+
+
+
+/********** RUN NEAREST GOAL BENCHMARK *********/
+
+void Benchmark::runNearestGoalBenchmark(int size, int queryCount)
+{
+    std::mt19937 rng(2468);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<std::pair<State, State>> queries;
+
+    fillRandomWorld(world, rng, 20);
+    queries = generateQueries(world, rng, queryCount);
+    planner.setOpenList(OpenListType::IndexedHeap);
+
+    for (int goalCount : { 8, 64 })
+    {
+        std::vector<State> chargers;
+        std::vector<std::pair<std::string, double>> rows;
+        std::vector<double> best(queries.size(), -1.0);
+        double total = 0.0;
+        bool sameCosts = true;
+
+        for (const auto& query : generateQueries(world, rng, goalCount))
+        {
+            chargers.push_back(query.second);
+        }
+
+        std::cout << "\n" << queryCount << " queries to the nearest of " << goalCount << " chargers on a "
+            << size << "x" << size << " world\n";
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            for (const State& charger : chargers)
+            {
+                PlanResults result = planner.plan(queries[i].first, charger, SearchType::AStar);
+                total += result.executionTime;
+
+                if (result.success && (best[i] < 0.0 || result.totalCost < best[i]))
+                {
+                    best[i] = result.totalCost;
+                }
+            }
+        }
+
+        rows.push_back({ "A* per charger", total });
+
+        // Scan every goal per estimate, then look estimates up in the goal field
+        for (size_t threshold : { static_cast<size_t>(goalCount), static_cast<size_t>(0) })
+        {
+            planner.setGoalFieldThreshold(threshold);
+            total = 0.0;
+
+            for (size_t i = 0; i < queries.size(); ++i)
+            {
+                PlanResults result = planner.planToNearest(queries[i].first, chargers, SearchType::AStar);
+                total += result.executionTime;
+                sameCosts &= result.success ? std::abs(result.totalCost - best[i]) < 1e-9 : best[i] < 0.0;
+            }
+
+            rows.push_back({ (threshold > 0) ? "Nearest A*, goal scan" : "Nearest A*, goal field", total });
+        }
+
+        StatsManager::printTimingComparison(rows);
+
+        std::cout << "Costs match the per-charger minimum: " << (sameCosts ? "yes" : "NO") << "\n";
+    }
+}
+
+
+
+/********** RUN TIME BUDGET BENCHMARK **********/
+
+void Benchmark::runTimeBudgetBenchmark(int size, int queryCount, double budget)
+{
+    std::mt19937 rng(1357);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<std::pair<State, State>> queries;
+    std::vector<std::pair<std::string, double>> rows;
+    SearchLimits timed;
+    SearchLimits loose;
+    double unlimitedTime = 0.0;
+    double budgetedTime = 0.0;
+    double slowest = 0.0;
+    int truncated = 0;
+    bool samePaths = true;
+
+    fillRandomWorld(world, rng, 20);
+    queries = generateQueries(world, rng, queryCount);
+    planner.setOpenList(OpenListType::IndexedHeap);
+
+    timed.timeBudget = budget;
+    loose.timeBudget = 1e6;
+    loose.maxExpansions = size * size;
+
+    std::cout << "\n" << queryCount << " A* queries on a " << size << "x" << size << " world, budget "
+        << budget << " ms\n";
+
+    // Wall in every goal: an unlimited search expands the whole connected component
+    for (const auto& query : queries)
+    {
+        std::vector<std::pair<State, double>> ring;
+
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                State cell{ query.second.x + dx, query.second.y + dy };
+
+                if ((dx != 0 || dy != 0) && world.isFree(cell))
+                {
+                    ring.push_back({ cell, world.getWeight(cell) });
+                    world.setWeight(cell, World::BLOCK);
+                }
+            }
+        }
+
+        PlanResults unlimited = planner.plan(query.first, query.second, SearchType::AStar);
+        PlanResults limited = planner.plan(query.first, query.second, SearchType::AStar, timed);
+
+        unlimitedTime += unlimited.executionTime;
+        budgetedTime += limited.executionTime;
+        slowest = std::max(slowest, limited.executionTime);
+        truncated += limited.truncated ? 1 : 0;
+
+        for (const auto& cell : ring)
+        {
+            world.setWeight(cell.first, cell.second);
+        }
+    }
+
+    rows.push_back({ "Unreachable, no limit", unlimitedTime });
+    rows.push_back({ "Unreachable, budget", budgetedTime });
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "Truncated: " << truncated << " of " << queryCount << ", slowest budgeted query: "
+        << std::fixed << std::setprecision(3) << slowest << " ms\n";
+
+    // Overhead of the checks when no limit is hit
+    rows.clear();
+    unlimitedTime = 0.0;
+    budgetedTime = 0.0;
+
+    for (const auto& query : queries)
+    {
+        PlanResults unlimited = planner.plan(query.first, query.second, SearchType::AStar);
+        PlanResults limited = planner.plan(query.first, query.second, SearchType::AStar, loose);
+
+        unlimitedTime += unlimited.executionTime;
+        budgetedTime += limited.executionTime;
+        samePaths &= unlimited.path == limited.path && !limited.truncated;
+    }
+
+    rows.push_back({ "Reachable, no limit", unlimitedTime });
+    rows.push_back({ "Reachable, limits not hit", budgetedTime });
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "Same paths with limits: " << (samePaths ? "yes" : "NO") << "\n";
+}
+
+
+/************ RUN ANYTIME BENCHMARK ************/
+
+void Benchmark::runAnytimeBenchmark(int size, int queryCount)
+{
+    std::mt19937 rng(2468);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<std::pair<State, State>> queries;
+    std::vector<std::pair<std::string, double>> rows;
+    AnytimeSettings settings;
+    AnytimeResults longest;
+    double optimalTime = 0.0;
+    double firstTime = 0.0;
+    double anytimeTime = 0.0;
+    double firstRatio = 0.0;
+    int solved = 0;
+    bool optimalCosts = true;
+
+    fillRandomWorld(world, rng, 20);
+    queries = generateQueries(world, rng, queryCount);
+    planner.setOpenList(OpenListType::IndexedHeap);
+
+    settings.initialWeight = 3.0;
+    settings.weightStep = 0.5;
+
+    std::cout << "\nAnytime A*: " << queryCount << " queries on a " << size << "x" << size << " world, weights "
+        << settings.initialWeight << " to " << settings.finalWeight << "\n";
+
+    for (const auto& query : queries)
+    {
+        PlanResults optimal = planner.plan(query.first, query.second, SearchType::AStar);
+        AnytimeResults anytime = planner.planAnytime(query.first, query.second, settings);
+
+        optimalTime += optimal.executionTime;
+        anytimeTime += anytime.executionTime;
+
+        if (!optimal.success || !anytime.success)
+        {
+            optimalCosts &= optimal.success == anytime.success;
+            continue;
+        }
+
+        solved++;
+        firstTime += anytime.solutions.front().time;
+        firstRatio += anytime.solutions.front().cost / optimal.totalCost;
+        optimalCosts &= std::abs(anytime.solutions.back().cost - optimal.totalCost) < 1e-6;
+
+        if (anytime.executionTime > longest.executionTime)
+        {
+            longest = std::move(anytime);
+        }
+    }
+
+    rows.push_back({ "A* (optimal)", optimalTime });
+    rows.push_back({ "ARA* first solution", firstTime });
+    rows.push_back({ "ARA* to optimal", anytimeTime });
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "First solutions cost " << std::fixed << std::setprecision(3) << (solved > 0 ? firstRatio / solved : 0.0)
+        << "x the optimum on average; last solutions optimal: " << (optimalCosts ? "yes" : "NO") << "\n";
+
+    if (longest.success)
+    {
+        std::cout << "Longest query:\n";
+        StatsManager::printAnytimeCurve(longest);
+    }
+}
+
+
+
+/*********** RUN D* LITE BENCHMARK *************/
+
+void Benchmark::runDStarLiteBenchmark(int size, int stepCount)
+{
+    std::mt19937 rng(8642);
+    World world(size, size);
+    Graph graph(&world);
+    Planner planner(graph);
+    DStarLite dstar(graph);
+    std::vector<std::pair<std::string, double>> rows;
+    std::uniform_int_distribution<int> lookahead(3, 8);
+    State start{ 1, 1 };
+    State goal{ size - 2, size - 2 };
+    PlanResults current;
+    double freshTime = 0.0;
+    double repairTime = 0.0;
+    long long freshExpanded = 0;
+    long long repairExpanded = 0;
+    long long repairUpdates = 0;
+    int replans = 0;
+    int steps = 0;
+    bool sameCosts = true;
+
+    fillRandomWorld(world, rng, 20);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+    planner.setOpenList(OpenListType::IndexedHeap);
+
+    dstar.initialize(start, goal);
+    current = dstar.replan();
+
+    std::cout << "\nD* Lite: agent on a " << size << "x" << size << " world, initial search "
+        << current.nodesExpanded << " expansions in " << std::fixed << std::setprecision(3) << current.executionTime << " ms\n";
+
+    // Every 5 steps a cell a few steps ahead on the path becomes blocked
+    while (current.success && current.path.size() > 1 && steps < stepCount)
+    {
+        dstar.moveStart(current.path[1]);
+        steps++;
+
+        if (steps % 5 != 0 || current.path.size() < 10)
+        {
+            current.path.erase(current.path.begin());
+            continue;
+        }
+
+        State blocked = current.path[lookahead(rng)];
+        world.setWeight(blocked, World::BLOCK);
+
+        PlanResults fresh = planner.plan(dstar.getStart(), goal, SearchType::AStar);
+
+        dstar.updateCells({ blocked });
+        current = dstar.replan();
+
+        freshTime += fresh.executionTime;
+        repairTime += current.executionTime;
+        freshExpanded += fresh.nodesExpanded;
+        repairExpanded += current.nodesExpanded;
+        repairUpdates += dstar.getLastUpdateCount();
+        sameCosts &= fresh.success == current.success && std::abs(fresh.totalCost - current.totalCost) < 1e-6;
+        replans++;
+    }
+
+    rows.push_back({ "A* from scratch", freshTime });
+    rows.push_back({ "D* Lite repair", repairTime });
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << steps << " steps, " << replans << " replans; expansions per replan: A* "
+        << (replans > 0 ? freshExpanded / replans : 0) << ", D* Lite " << (replans > 0 ? repairExpanded / replans : 0)
+        << " (" << (replans > 0 ? repairUpdates / replans : 0) << " rhs updates)\n";
+    std::cout << "Repaired costs match A*: " << (sameCosts ? "yes" : "NO") << "\n";
+}
+
+
+/*********** RUN LPA* BENCHMARK ****************/
+
+void Benchmark::runLPAStarBenchmark(int size, int tickCount)
+{
+    std::mt19937 rng(97531);
+    World world(size, size);
+    Graph graph(&world);
+    LPAStar lpa(world, graph);
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<std::pair<State, double>> congested;
+    State start{ 1, 1 };
+    State goal{ size - 2, size - 2 };
+    PlanResults route;
+    double freshTime = 0.0;
+    double repairTime = 0.0;
+    long long freshExpanded = 0;
+    long long repairExpanded = 0;
+    bool sameCosts = true;
+    int tick = 0;
+
+    fillRandomWorld(world, rng, 20);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    lpa.bind(start, goal);
+    route = lpa.replan();
+    lpa.setCompareWithFresh(true);
+
+    std::cout << "\nLPA*: fixed route on a " << size << "x" << size << " world, " << tickCount
+        << " congestion updates, initial search " << route.nodesExpanded << " expansions\n";
+
+    for (tick = 0; tick < tickCount && route.success; ++tick)
+    {
+        std::uniform_int_distribution<size_t> onRoute(1, route.path.size() - 2);
+        std::uniform_int_distribution<int> anywhere(0, size - 1);
+
+        // Congestion clears on the oldest cells and builds up on one cell of the route and a few elsewhere
+        while (congested.size() > 20)
+        {
+            world.setWeight(congested.front().first, congested.front().second);
+            congested.erase(congested.begin());
+        }
+
+        for (int k = 0; k < 5; ++k)
+        {
+            State cell = (k == 0) ? route.path[onRoute(rng)] : State{ anywhere(rng), anywhere(rng) };
+
+            if (world.isFree(cell) && !(cell == goal))
+            {
+                congested.push_back({ cell, world.getWeight(cell) });
+                world.setWeight(cell, world.getWeight(cell) + 2.0);
+            }
+        }
+
+        route = lpa.replan();
+
+        const RepairStats& repair = lpa.getLastRepair();
+        freshTime += repair.freshTime;
+        repairTime += repair.executionTime;
+        freshExpanded += repair.freshExpanded;
+        repairExpanded += repair.nodesExpanded;
+        sameCosts &= std::abs(route.totalCost - repair.freshCost) < 1e-6;
+    }
+
+    rows.push_back({ "A* from scratch", freshTime });
+    rows.push_back({ "LPA* repair", repairTime });
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "Expansions per update: A* " << (tick > 0 ? freshExpanded / tick : 0) << ", LPA* "
+        << (tick > 0 ? repairExpanded / tick : 0) << "\n";
+    std::cout << "Repaired costs match A*: " << (sameCosts ? "yes" : "NO") << "\n";
+}
+
+
+/********* RUN CHANGE JOURNAL BENCHMARK ********/
+
+void Benchmark::runChangeJournalBenchmark(int size, int changeCount)
+{
+    const int batchCount = 20;
+    const int repeatCount = 5;
+    std::mt19937 rng(24680);
+    World world(size, size);
+    std::uniform_int_distribution<int> coordinate(0, size - 1);
+    std::uniform_real_distribution<double> weight(1.0, 8.0);
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<std::pair<State, double>> sequence;
+    std::vector<double> saved(static_cast<size_t>(size) * size, World::FREE);
+    double setTime[2] = { 0.0, 0.0 };
+    double scanTime = 0.0;
+    double journalTime = 0.0;
+    size_t scannedCells = 0;
+    size_t journalCells = 0;
+    int invalidations = 0;
+    int repeat = 0;
+    int batch = 0;
+    int x = 0;
+    int y = 0;
+
+    std::cout << "\nChange journal: " << batchCount << " batches of " << changeCount << " scattered changes on a "
+        << size << "x" << size << " world\n";
+
+    // Cost of recording: one change sequence, replayed without and with a journal
+    for (int k = 0; k < batchCount * changeCount; ++k)
+    {
+        State cell{ coordinate(rng), coordinate(rng) };
+
+        sequence.push_back({ cell, weight(rng) });
+    }
+
+    // Every run starts from a cleared (warm) grid; repeat 0 is an untimed warm-up, and
+    // the order alternates so neither variant always runs first
+    for (repeat = 0; repeat <= repeatCount; ++repeat)
+    {
+        for (int side = 0; side < 2; ++side)
+        {
+            int journaled = (side + repeat) % 2;
+
+            world.clearGrid();
+            world.setJournalCapacity(journaled ? World::DEFAULT_JOURNAL_CAPACITY : 0);
+
+            auto startTime = std::chrono::steady_clock::now();
+
+            for (const auto& change : sequence)
+            {
+                world.setWeight(change.first, change.second);
+            }
+
+            auto endTime = std::chrono::steady_clock::now();
+
+            if (repeat > 0)
+            {
+                setTime[journaled] += std::chrono::duration<double, std::milli>(endTime - startTime).count() / repeatCount;
+            }
+        }
+    }
+
+    world.setJournalCapacity(World::DEFAULT_JOURNAL_CAPACITY);
+
+    std::cout << "setWeight: mean of " << repeatCount << " alternating runs over the same " << sequence.size()
+        << " changes\n";
+    rows.push_back({ "setWeight, no journal", setTime[0] });
+    rows.push_back({ "setWeight, journal", setTime[1] });
+    StatsManager::printTimingComparison(rows);
+
+    // Cost of finding out what changed since the last batch
+    for (y = 0; y < size; ++y)
+    {
+        for (x = 0; x < size; ++x)
+        {
+            saved[static_cast<size_t>(y) * size + x] = world.getWeight({ x, y });
+        }
+    }
+
+    for (batch = 0; batch < batchCount; ++batch)
+    {
+        std::uint64_t since = world.getEpoch();
+
+        for (int k = 0; k < changeCount; ++k)
+        {
+            world.setWeight({ coordinate(rng), coordinate(rng) }, weight(rng));
+        }
+
+        auto scanStart = std::chrono::steady_clock::now();
+        for (y = 0; y < size; ++y)
+        {
+            for (x = 0; x < size; ++x)
+            {
+                double current = world.getWeight({ x, y });
+                double& old = saved[static_cast<size_t>(y) * size + x];
+
+                if (current != old)
+                {
+                    old = current;
+                    scannedCells++;
+                }
+            }
+        }
+        auto scanEnd = std::chrono::steady_clock::now();
+
+        WorldChanges changes = world.getChangesSince(since);
+        auto journalEnd = std::chrono::steady_clock::now();
+
+        invalidations += changes.fullInvalidation ? 1 : 0;
+
+        for (const DirtyRegion& region : changes.regions)
+        {
+            journalCells += static_cast<size_t>(region.maxX - region.minX + 1) * (region.maxY - region.minY + 1);
+        }
+
+        scanTime += std::chrono::duration<double, std::milli>(scanEnd - scanStart).count();
+        journalTime += std::chrono::duration<double, std::milli>(journalEnd - scanEnd).count();
+    }
+
+    rows.clear();
+    rows.push_back({ "Scan against a copy", scanTime });
+    rows.push_back({ "getChangesSince", journalTime });
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << "Changed cells found: scan " << scannedCells << ", journal regions cover " << journalCells
+        << " cells; full invalidations (journal overflow): " << invalidations << " of " << batchCount << "\n";
+}
+
+/*********** RUN SNAPSHOT BENCHMARK ************/
+
+void Benchmark::runSnapshotBenchmark(int size, int queryCount)
+{
+    const int readerCount = 2;
+    const int clusterCells = 40;
+    std::mt19937 rng(86420);
+    World world(size, size);
+    Graph graph(&world);
+    std::vector<std::pair<std::string, double>> rows;
+    std::vector<std::pair<State, State>> queries;
+    double worstLatency[2] = { 0.0, 0.0 };
+    double worstBatch[2] = { 0.0, 0.0 };
+    int batches[2] = { 0, 0 };
+    long long copiedTiles = 0;
+
+    fillRandomWorld(world, rng, 20);
+    queries = generateQueries(world, rng, queryCount * readerCount);
+
+    VersionedWorld versioned(world);
+    std::mutex worldMutex;
+
+    std::cout << "\nSnapshots: " << readerCount << " reader threads x " << queryCount << " A* queries on a "
+        << size << "x" << size << " world, one writer changing clusters of " << clusterCells << " weights\n";
+
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        std::atomic<int> running{ readerCount };
+        std::vector<std::thread> readers;
+        std::vector<double> worst(readerCount, 0.0);
+        std::mt19937 writerRng(mode == 0 ? 11111 : 22222);
+        std::uniform_int_distribution<int> corner(0, size - 16);
+        std::uniform_int_distribution<int> offset(0, 15);
+        std::uniform_real_distribution<double> weight(1.0, 8.0);
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        for (int r = 0; r < readerCount; ++r)
+        {
+            readers.emplace_back([&, r]()
+            {
+                Planner locked(graph);
+                SnapshotReader reader(versioned);
+
+                for (int q = r * queryCount; q < (r + 1) * queryCount; ++q)
+                {
+                    auto queryStart = std::chrono::steady_clock::now();
+
+                    if (mode == 0)
+                    {
+                        std::lock_guard<std::mutex> lock(worldMutex);
+                        locked.plan(queries[q].first, queries[q].second, SearchType::AStar);
+                    }
+                    else
+                    {
+                        reader.refresh();
+                        reader.plan(queries[q].first, queries[q].second, SearchType::AStar);
+                    }
+
+                    auto queryEnd = std::chrono::steady_clock::now();
+                    worst[r] = std::max(worst[r], std::chrono::duration<double, std::milli>(queryEnd - queryStart).count());
+                }
+
+                running--;
+            });
+        }
+
+        // Writer: a cluster of weight changes (obstacles stay where they are) per batch
+        while (running > 0)
+        {
+            int cornerX = corner(writerRng);
+            int cornerY = corner(writerRng);
+            auto batchStart = std::chrono::steady_clock::now();
+
+            if (mode == 0)
+            {
+                std::lock_guard<std::mutex> lock(worldMutex);
+
+                for (int k = 0; k < clusterCells; ++k)
+                {
+                    State cell{ cornerX + offset(writerRng), cornerY + offset(writerRng) };
+                    double w = weight(writerRng);
+
+                    if (world.isFree(cell))
+                    {
+                        world.setWeight(cell, w);
+                    }
+                }
+            }
+            else
+            {
+                for (int k = 0; k < clusterCells; ++k)
+                {
+                    State cell{ cornerX + offset(writerRng), cornerY + offset(writerRng) };
+                    double w = weight(writerRng);
+
+                    if (world.isFree(cell))
+                    {
+                        versioned.setWeight(cell, w);
+                    }
+                }
+
+                versioned.publish();
+                copiedTiles += versioned.getLastCopiedTiles();
+            }
+
+            auto batchEnd = std::chrono::steady_clock::now();
+            worstBatch[mode] = std::max(worstBatch[mode], std::chrono::duration<double, std::milli>(batchEnd - batchStart).count());
+            batches[mode]++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        for (auto& thread : readers)
+        {
+            thread.join();
+        }
+
+        auto endTime = std::chrono::steady_clock::now();
+
+        rows.push_back({ (mode == 0) ? "Shared World + mutex" : "VersionedWorld snapshots",
+            std::chrono::duration<double, std::milli>(endTime - startTime).count() });
+        worstLatency[mode] = *std::max_element(worst.begin(), worst.end());
+    }
+
+    StatsManager::printTimingComparison(rows);
+
+    std::cout << std::fixed << std::setprecision(3) << "Worst query latency: mutex " << worstLatency[0]
+        << " ms, snapshots " << worstLatency[1] << " ms\n";
+    std::cout << "Worst writer batch (waiting included): mutex " << worstBatch[0] << " ms, snapshots " << worstBatch[1] << " ms\n";
+    std::cout << "Writer batches applied: mutex " << batches[0] << ", snapshots " << batches[1]
+        << "; tiles copied per publish " << (batches[1] > 0 ? static_cast<double>(copiedTiles) / batches[1] : 0.0)
+        << " of " << versioned.pin()->getTileCount() << "\n";
+}
+
+/*********** HELPER FUNCTIONS ***********/
+
+// Block random cells and give the others random weights in [1, 8]
+static void fillRandomWorld(World& world, std::mt19937& rng, int obstaclePercentage)
+{
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_real_distribution<double> weight(1.0, 8.0);
+    int x = 0;
+    int y = 0;
+
+    for (y = 0; y < world.getHeight(); ++y)
+    {
+        for (x = 0; x < world.getWidth(); ++x)
+        {
+            world.setWeight({ x, y }, (percent(rng) < obstaclePercentage) ? World::BLOCK : weight(rng));
+        }
+    }
+}
+
+
+// Random pairs of free cells
+static std::vector<std::pair<State, State>> generateQueries(const World& world, std::mt19937& rng, int count)
+{
+    std::uniform_int_distribution<int> xs(0, world.getWidth() - 1);
+    std::uniform_int_distribution<int> ys(0, world.getHeight() - 1);
+    std::vector<std::pair<State, State>> queries;
+
+    while (static_cast<int>(queries.size()) < count)
+    {
+        State start{ xs(rng), ys(rng) };
+        State goal{ xs(rng), ys(rng) };
+
+        if (world.isFree(start) && world.isFree(goal))
+        {
+            queries.push_back({ start, goal });
+        }
+    }
+
+    return queries;
+}
+
@@ -0,0 +1,383 @@
+#include "bit_parallel_bfs.h"
+#include <algorithm>
+
+
+// Static helper function declarations
+static int lowestBit(std::uint64_t word);
+
+static int popCount(std::uint64_t word);
+
+static const int MOVE_DX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };  // Same order as Graph's moves
+static const int MOVE_DY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+
+/******************** PREPARE ******************/
+
+void BitParallelBFS::prepare(const World& world)
+{
+    if (world.getWidth() != width || world.getHeight() != height)
+    {
+        width = world.getWidth();
+        height = world.getHeight();
+        words = (width + 63) / 64;
+        rowStride = words + 2;
+        summaryWords = (words + 63) / 64;
+        summaryStride = summaryWords + 2;
+
+        size_t bitmapSize = static_cast<size_t>(height + 2) * rowStride;
+        size_t summarySize = static_cast<size_t>(height + 2) * summaryStride;
+
+        rowStamps.assign(height, 0);
+        freeMask.assign(bitmapSize, 0);
+        visited.assign(bitmapSize, 0);
+        frontier.assign(bitmapSize, 0);
+        next.assign(bitmapSize, 0);
+        layerLow.assign(bitmapSize, 0);
+        layerHigh.assign(bitmapSize, 0);
+        frontierSummary.assign(summarySize, 0);
+        nextSummary.assign(summarySize, 0);
+        generation = 0;
+    }
+
+    generation++;
+
+    // Stamps wrapped around: mark every row as uninitialized
+    if (generation == 0)
+    {
+        std::fill(rowStamps.begin(), rowStamps.end(), 0);
+        generation = 1;
+    }
+
+    frontierFirstRow = 0;
+    frontierLastRow = -1;
+}
+
+
+/****************** ENSURE ROW *****************/
+
+void BitParallelBFS::ensureRow(const World& world, int row)
+{
+    CellId first = 0;
+    size_t base = 0;
+    int word = 0;
+
+    if (rowStamps[row] == generation)
+    {
+        return;
+    }
+
+    rowStamps[row] = generation;
+    first = world.toCell({ 0, row });
+    base = wordIndex(row, 0);
+
+    for (word = 0; word < words; ++word)
+    {
+        int begin = word * 64;
+        int count = std::min(64, width - begin);
+        Word bits = 0;
+        int bit = 0;
+
+        // Dense, branch-free loop over consecutive cells
+        for (bit = 0; bit < count; ++bit)
+        {
+            bits |= static_cast<Word>(world.isFree(first + begin + bit)) << bit;
+        }
+
+        freeMask[base + word] = bits;
+        visited[base + word] = 0;
+        layerLow[base + word] = 0;
+        layerHigh[base + word] = 0;
+    }
+}
+
+
+/****************** IS VISITED *****************/
+
+bool BitParallelBFS::isVisited(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= width || y >= height || rowStamps[y] != generation)
+    {
+        return false;
+    }
+
+    return (visited[wordIndex(y, x / 64)] >> (x % 64)) & 1;
+}
+
+
+/****************** LAYER MOD 3 ****************/
+
+int BitParallelBFS::layerMod3(int x, int y) const
+{
+    size_t index = wordIndex(y, x / 64);
+
+    return static_cast<int>(((layerHigh[index] >> (x % 64)) & 1) << 1 | ((layerLow[index] >> (x % 64)) & 1));
+}
+
+
+/********************* START *******************/
+
+void BitParallelBFS::start(const World& world, const State& source)
+{
+    Word bit = Word(1) << (source.x % 64);
+    int word = source.x / 64;
+
+    ensureRow(world, source.y);
+
+    frontier[wordIndex(source.y, word)] = bit;
+    visited[wordIndex(source.y, word)] = bit;
+    frontierSummary[summaryIndex(source.y, word / 64)] = Word(1) << (word % 64);
+    frontierFirstRow = source.y;
+    frontierLastRow = source.y;
+}
+
+
+/****************** EXPAND LAYER ***************/
+
+template <typename Visitor>
+size_t BitParallelBFS::expandLayer(const World& world, int layer, Visitor&& visit)
+{
+    int firstRow = std::max(0, frontierFirstRow - 1);
+    int lastRow = std::min(height - 1, frontierLastRow + 1);
+    int newFirstRow = height;
+    int newLastRow = -1;
+    size_t count = 0;
+    bool low = (layer % 3) & 1;
+    bool high = (layer % 3) & 2;
+    int row = 0;
+    int s = 0;
+
+    // Dilation of one frontier row at word k: the word itself and its left/right neighbors,
+    // with the bits that cross the word boundaries
+    auto dilate = [](const Word* row, int k)
+    {
+        Word center = row[k];
+        return center | (center << 1) | (center >> 1) | (row[k - 1] >> 63) | (row[k + 1] << 63);
+    };
+
+    for (row = firstRow; row <= lastRow; ++row)
+    {
+        const Word* above = &frontier[wordIndex(row - 1, 0)];
+        const Word* middle = &frontier[wordIndex(row, 0)];
+        const Word* below = &frontier[wordIndex(row + 1, 0)];
+        size_t base = wordIndex(row, 0);
+        bool rowHasBits = false;
+
+        ensureRow(world, row);
+
+        for (s = 0; s < summaryWords; ++s)
+        {
+            // Candidate words: non-zero frontier words of the three rows and their neighbors
+            auto summaryAt = [&](int index)
+            {
+                return frontierSummary[summaryIndex(row - 1, index)] | frontierSummary[summaryIndex(row, index)] |
+                    frontierSummary[summaryIndex(row + 1, index)];
+            };
+            Word active = summaryAt(s);
+            Word candidates = active | (active << 1) | (active >> 1) | (summaryAt(s - 1) >> 63) | (summaryAt(s + 1) << 63);
+
+            if (s == summaryWords - 1 && words % 64 != 0)
+            {
+                candidates &= (Word(1) << (words % 64)) - 1;
+            }
+
+            while (candidates != 0)
+            {
+                int k = s * 64 + lowestBit(candidates);
+                Word reached = (dilate(above, k) | dilate(middle, k) | dilate(below, k)) &
+                    freeMask[base + k] & ~visited[base + k];
+
+                candidates &= candidates - 1;
+
+                if (reached == 0)
+                {
+                    continue;
+                }
+
+                next[base + k] = reached;
+                visited[base + k] |= reached;
+                layerLow[base + k] |= low ? reached : 0;
+                layerHigh[base + k] |= high ? reached : 0;
+                nextSummary[summaryIndex(row, k / 64)] |= Word(1) << (k % 64);
+                count += popCount(reached);
+                rowHasBits = true;
+
+                visit(row, k, reached);
+            }
+        }
+
+        if (rowHasBits)
+        {
+            newFirstRow = std::min(newFirstRow, row);
+            newLastRow = row;
+        }
+    }
+
+    clearFrontier();
+    frontier.swap(next);
+    frontierSummary.swap(nextSummary);
+    frontierFirstRow = newFirstRow;
+    frontierLastRow = newLastRow;
+
+    return count;
+}
+
+
+/**************** CLEAR FRONTIER ***************/
+
+void BitParallelBFS::clearFrontier()
+{
+    int row = 0;
+    int s = 0;
+
+    // Only the words marked in the summary can be non-zero
+    for (row = frontierFirstRow; row <= frontierLastRow; ++row)
+    {
+        for (s = 0; s < summaryWords; ++s)
+        {
+            Word& summary = frontierSummary[summaryIndex(row, s)];
+
+            while (summary != 0)
+            {
+                frontier[wordIndex(row, s * 64 + lowestBit(summary))] = 0;
+                summary &= summary - 1;
+            }
+        }
+    }
+
+    frontierFirstRow = 0;
+    frontierLastRow = -1;
+}
+
+
+/********************* SEARCH ******************/
+
+int BitParallelBFS::search(const World& world, const State& start, const State& goal, std::vector<State>& path, int& reachedCells)
+{
+    State current = goal;
+    int layer = 0;
+    int step = 0;
+    size_t reached = 1;
+    size_t count = 0;
+
+    path.clear();
+    prepare(world);
+    this->start(world, start);
+
+    // Expand layer by layer until the goal bit is set
+    while (!isVisited(goal.x, goal.y))
+    {
+        count = expandLayer(world, ++layer, [](int, int, Word) {});
+        reached += count;
+
+        if (count == 0)
+        {
+            reachedCells = static_cast<int>(reached);
+            return -1;
+        }
+    }
+
+    clearFrontier();
+    reachedCells = static_cast<int>(reached);
+
+    // Walk back from the goal, each step into a visited neighbor of the previous layer
+    path.resize(static_cast<size_t>(layer) + 1);
+    path[layer] = goal;
+
+    for (step = layer; step > 0; --step)
+    {
+        int wanted = (step - 1) % 3;
+        int i = 0;
+
+        for (i = 0; i < 8; ++i)
+        {
+            int x = current.x + MOVE_DX[i];
+            int y = current.y + MOVE_DY[i];
+
+            if (isVisited(x, y) && layerMod3(x, y) == wanted)
+            {
+                current = { x, y };
+                break;
+            }
+        }
+
+        path[step - 1] = current;
+    }
+
+    return layer;
+}
+
+
+/***************** COMPUTE LAYERS **************/
+
+int BitParallelBFS::computeLayers(const World& world, const State& source, std::vector<int>& distance)
+{
+    int layer = 0;
+
+    distance.assign(world.getCellCount(), -1);
+
+    if (!world.isFree(source))
+    {
+        return -1;
+    }
+
+    prepare(world);
+    start(world, source);
+    distance[world.toCell(source)] = 0;
+
+    // Newly reached bits are turned into cell ids only to store their layer
+    while (expandLayer(world, layer + 1, [&](int row, int word, Word bits)
+    {
+        CellId first = world.toCell({ word * 64, row });
+
+        while (bits != 0)
+        {
+            distance[first + lowestBit(bits)] = layer + 1;
+            bits &= bits - 1;
+        }
+    }) > 0)
+    {
+        layer++;
+    }
+
+    return layer;
+}
+
+
+/*********** HELPER FUNCTIONS ***********/
+
+// Index of the lowest set bit of a non-zero word
+static int lowestBit(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+
+    return index;
+#endif
+}
+
+
+// Number of set bits of a word
+static int popCount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+
+    while (word != 0)
+    {
+        word &= word - 1;
+        count++;
+    }
+
+    return count;
+#endif
+}
@@ -0,0 +1,32 @@
+#include "concurrent_closed_set.h"
+
+/******************* PREPARE *******************/
+
+void ConcurrentClosedSet::prepare(int cellCount)
+{
+    size_t i = 0;
+
+    if (capacity < static_cast<size_t>(cellCount))
+    {
+        capacity = static_cast<size_t>(cellCount);
+        stamps.reset(new std::atomic<std::uint32_t>[capacity]);
+        costs.resize(capacity);
+
+        for (i = 0; i < capacity; ++i)
+        {
+            stamps[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    generation++;
+
+    // On wrap-around old stamps could collide with new generations
+    if (generation == 0)
+    {
+        for (i = 0; i < capacity; ++i)
+        {
+            stamps[i].store(0, std::memory_order_relaxed);
+        }
+        generation = 1;
+    }
+}
@@ -0,0 +1,302 @@
+#include "d_star_lite.h"
+#include "search_workspace.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+
+/***************** CONSTRUCTOR *****************/
+
+DStarLite::DStarLite(const Graph& graph) : graph(graph)
+{
+}
+
+
+/****************** INITIALIZE *****************/
+
+bool DStarLite::initialize(const State& newStart, const State& newGoal)
+{
+    const World& world = *graph.getWorld();
+    int cellCount = world.getCellCount();
+
+    goalCell = World::INVALID_CELL;
+
+    if (!world.isFree(newStart) || !world.isFree(newGoal))
+    {
+        return false;
+    }
+
+    start = newStart;
+    goal = newGoal;
+    startCell = world.toCell(start);
+    goalCell = world.toCell(goal);
+    lastCell = startCell;
+    km = 0.0;
+    expanded = 0;
+    updated = 0;
+    lastUpdateCount = 0;
+
+    g.assign(cellCount, SearchWorkspace::INF);
+    rhs.assign(cellCount, SearchWorkspace::INF);
+    open.reserve(cellCount);
+
+    rhs[goalCell] = 0.0;
+    open.push(goalCell, calculateKey(goalCell));
+
+    return true;
+}
+
+
+/****************** MOVE START *****************/
+
+bool DStarLite::moveStart(const State& newStart)
+{
+    const World& world = *graph.getWorld();
+
+    if (goalCell == World::INVALID_CELL || !world.isFree(newStart))
+    {
+        return false;
+    }
+
+    start = newStart;
+    startCell = world.toCell(start);
+
+    return true;
+}
+
+
+/***************** UPDATE CELLS ****************/
+
+void DStarLite::updateCells(const std::vector<State>& changed)
+{
+    const World& world = *graph.getWorld();
+    int i = 0;
+
+    if (goalCell == World::INVALID_CELL || changed.empty())
+    {
+        return;
+    }
+
+    // Keys queued before the start moved are lowered by at most the distance it moved
+    km += Graph::chebyshevDistance(world.toState(lastCell), start);
+    lastCell = startCell;
+
+    for (const State& s : changed)
+    {
+        CellId cell = world.findCell(s);
+
+        if (cell == World::INVALID_CELL)
+        {
+            continue;
+        }
+
+        // Edges into the cell and out of it changed: the cell and all its neighbors
+        updateVertex(cell);
+
+        for (i = 0; i < Graph::MOVE_COUNT; ++i)
+        {
+            updateVertex(cell + graph.getOffset(i));
+        }
+    }
+}
+
+
+/********************* REPLAN ******************/
+
+PlanResults DStarLite::replan()
+{
+    const World& world = *graph.getWorld();
+    auto startTime = std::chrono::steady_clock::now();
+    PlanResults results{};
+    CellId current = startCell;
+    int steps = 0;
+
+    results.success = false;
+    results.totalCost = 0.0;
+
+    if (goalCell == World::INVALID_CELL)
+    {
+        return results;
+    }
+
+    computeShortestPath();
+
+    results.nodesExpanded = expanded;
+    lastUpdateCount = updated;
+    expanded = 0;
+    updated = 0;
+
+    if (rhs[startCell] != SearchWorkspace::INF)
+    {
+        results.path.push_back(start);
+
+        // Follow the cheapest edge cost + g; g falls along the way, the step limit guards against cycles
+        while (current != goalCell && steps++ < world.getCellCount())
+        {
+            CellId best = World::INVALID_CELL;
+            double bestValue = SearchWorkspace::INF;
+            double bestCost = 0.0;
+
+            graph.forEachNeighbor(current, [&](CellId next, double cost)
+            {
+                if (cost + g[next] < bestValue)
+                {
+                    best = next;
+                    bestValue = cost + g[next];
+                    bestCost = cost;
+                }
+            });
+
+            if (best == World::INVALID_CELL)
+            {
+                break;
+            }
+
+            current = best;
+            results.totalCost += bestCost;
+            results.path.push_back(world.toState(current));
+        }
+
+        results.success = current == goalCell;
+
+        if (!results.success)
+        {
+            results.path.clear();
+            results.totalCost = 0.0;
+        }
+    }
+
+    results.peakOpenSize = static_cast<int>(open.size());
+    results.executionTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    return results;
+}
+
+
+/******************* GET START *****************/
+
+const State& DStarLite::getStart() const
+{
+    return start;
+}
+
+
+/******************* GET GOAL ******************/
+
+const State& DStarLite::getGoal() const
+{
+    return goal;
+}
+
+
+/************ GET LAST UPDATE COUNT ************/
+
+int DStarLite::getLastUpdateCount() const
+{
+    return lastUpdateCount;
+}
+
+
+/***************** CALCULATE KEY ***************/
+
+QueueKey DStarLite::calculateKey(CellId cell) const
+{
+    const World& world = *graph.getWorld();
+    double best = std::min(g[cell], rhs[cell]);
+
+    return { best + Graph::chebyshevDistance(start, world.toState(cell)) + km, best };
+}
+
+
+/***************** UPDATE VERTEX ***************/
+
+void DStarLite::updateVertex(CellId cell)
+{
+    const World& world = *graph.getWorld();
+
+    updated++;
+
+    // Blocked and sentinel cells cannot be entered, so they never lead to the goal
+    if (cell != goalCell)
+    {
+        double best = SearchWorkspace::INF;
+
+        if (world.isFree(cell))
+        {
+            graph.forEachNeighbor(cell, [&](CellId next, double cost)
+            {
+                best = std::min(best, cost + g[next]);
+            });
+        }
+
+        rhs[cell] = best;
+    }
+
+    if (g[cell] != rhs[cell])
+    {
+        open.push(cell, calculateKey(cell));
+    }
+    else
+    {
+        open.remove(cell);
+    }
+}
+
+
+/************ COMPUTE SHORTEST PATH ************/
+
+void DStarLite::computeShortestPath()
+{
+    int i = 0;
+
+    while (!open.empty() && (open.topKey() < calculateKey(startCell) || rhs[startCell] != g[startCell]))
+    {
+        CellId cell = open.top();
+        QueueKey newKey = calculateKey(cell);
+
+        // Queued before the start moved: re-queue with the current key
+        if (open.topKey() < newKey)
+        {
+            open.push(cell, newKey);
+            continue;
+        }
+
+        open.remove(cell);
+        expanded++;
+
+        if (g[cell] > rhs[cell])
+        {
+            // Overconsistent: settle the cell and offer it to its predecessors
+            g[cell] = rhs[cell];
+
+            graph.forEachPredecessor(cell, [&](CellId previous, double cost)
+            {
+                if (previous != goalCell && cost + g[cell] < rhs[previous])
+                {
+                    rhs[previous] = cost + g[cell];
+                    updated++;
+
+                    if (g[previous] != rhs[previous])
+                    {
+                        open.push(previous, calculateKey(previous));
+                    }
+                    else
+                    {
+                        open.remove(previous);
+                    }
+                }
+            });
+        }
+        else
+        {
+            // Underconsistent: forget the cell's cost and recompute everything that may depend on it
+            g[cell] = SearchWorkspace::INF;
+            updateVertex(cell);
+
+            for (i = 0; i < Graph::MOVE_COUNT; ++i)
+            {
+                updateVertex(cell + graph.getOffset(i));
+            }
+        }
+    }
+}
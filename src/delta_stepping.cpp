@@ -0,0 +1,403 @@
+#include "delta_stepping.h"
+#include "search_workspace.h"
+#include "indexed_heap.h"
+#include <algorithm>
+#include <chrono>
+
+
+// Static helper function declaration
+static bool lowerDistance(std::atomic<double>& distance, double value);
+
+
+/***************** CONSTRUCTOR *****************/
+
+DeltaStepping::DeltaStepping(const Graph& graph, unsigned int threadCount)
+    : graph(graph), delta(0.0), scheduler(threadCount), capacity(0), buffers(scheduler.size())
+{
+}
+
+
+/****************** SET DELTA ******************/
+
+void DeltaStepping::setDelta(double bucketWidth)
+{
+    delta = std::max(0.0, bucketWidth);
+}
+
+
+/****************** GET DELTA ******************/
+
+double DeltaStepping::getDelta() const
+{
+    return delta;
+}
+
+
+/*************** GET THREAD COUNT **************/
+
+unsigned int DeltaStepping::getThreadCount() const
+{
+    return scheduler.size();
+}
+
+
+/******************** PREPARE ******************/
+
+double DeltaStepping::prepare(int cellCount)
+{
+    const World& world = *graph.getWorld();
+    double maxWeight = 0.0;
+
+    if (capacity != static_cast<size_t>(cellCount))
+    {
+        distances = std::make_unique<std::atomic<double>[]>(cellCount);
+        roundStamps = std::make_unique<std::atomic<std::uint32_t>[]>(cellCount);
+        bucketStamps = std::make_unique<std::atomic<std::uint32_t>[]>(cellCount);
+        capacity = static_cast<size_t>(cellCount);
+    }
+
+    for (auto& bucket : buckets)
+    {
+        bucket.clear();
+    }
+
+    for (auto& buffer : buffers)
+    {
+        buffer.inserts.clear();
+        buffer.settled.clear();
+        buffer.relaxations = 0;
+        buffer.reachedCells = 0;
+        buffer.maxWeight = 0.0;
+    }
+
+    // Reset the arrays in parallel and find the heaviest cell for the automatic delta
+    scheduler.parallelFor(cellCount, 0, [&](int begin, int end, unsigned int worker)
+    {
+        WorkerBuffer& buffer = buffers[worker];
+
+        for (int id = begin; id < end; ++id)
+        {
+            distances[id].store(SearchWorkspace::INF, std::memory_order_relaxed);
+            roundStamps[id].store(0, std::memory_order_relaxed);
+            bucketStamps[id].store(0, std::memory_order_relaxed);
+            buffer.maxWeight = std::max(buffer.maxWeight, world.getWeight(id));
+        }
+    });
+
+    for (const auto& buffer : buffers)
+    {
+        maxWeight = std::max(maxWeight, buffer.maxWeight);
+    }
+
+    return Graph::DIAGONAL_COST * std::max(maxWeight, World::FREE);
+}
+
+
+/********************** RUN ********************/
+
+ShortestPathTree DeltaStepping::run(const State& source)
+{
+    const World& world = *graph.getWorld();
+    auto startTime = std::chrono::steady_clock::now();
+    ShortestPathTree tree;
+    CellId sourceCell = world.findCell(source);
+    double automaticDelta = prepare(world.getCellCount());
+    double bucketWidth = (delta > 0.0) ? delta : automaticDelta;
+    std::uint32_t round = 0;
+    std::uint32_t bucketStamp = 0;
+    size_t i = 0;
+
+    if (sourceCell != World::INVALID_CELL && world.isFree(sourceCell))
+    {
+        distances[sourceCell].store(0.0, std::memory_order_relaxed);
+
+        if (buckets.empty())
+        {
+            buckets.resize(1);
+        }
+        buckets[0].push_back(sourceCell);
+    }
+
+    // Buckets grow while they are processed, so the bound is re-read every iteration
+    for (i = 0; i < buckets.size(); ++i)
+    {
+        if (buckets[i].empty())
+        {
+            continue;
+        }
+
+        bucketStamp++;
+        settled.clear();
+        tree.buckets++;
+
+        // Light edges: repeat until no relaxation puts a cell back into this bucket
+        while (!buckets[i].empty())
+        {
+            current.swap(buckets[i]);
+            buckets[i].clear();
+            round++;
+
+            scheduler.parallelFor(static_cast<int>(current.size()), 0, [&](int begin, int end, unsigned int worker)
+            {
+                WorkerBuffer& buffer = buffers[worker];
+
+                for (int k = begin; k < end; ++k)
+                {
+                    CellId cell = current[k];
+                    double distance = distances[cell].load(std::memory_order_relaxed);
+
+                    // Stale entry (the cell moved to a lower bucket) or a duplicate in this round
+                    if (static_cast<size_t>(distance / bucketWidth) != i ||
+                        roundStamps[cell].exchange(round, std::memory_order_relaxed) == round)
+                    {
+                        continue;
+                    }
+
+                    if (bucketStamps[cell].exchange(bucketStamp, std::memory_order_relaxed) != bucketStamp)
+                    {
+                        buffer.settled.push_back(cell);
+                    }
+
+                    relax(cell, bucketWidth, true, buffer);
+                }
+            });
+
+            mergeInserts();
+        }
+
+        // Heavy edges: the settled cells are final now, relax them once
+        for (auto& buffer : buffers)
+        {
+            settled.insert(settled.end(), buffer.settled.begin(), buffer.settled.end());
+            buffer.settled.clear();
+        }
+
+        scheduler.parallelFor(static_cast<int>(settled.size()), 0, [&](int begin, int end, unsigned int worker)
+        {
+            for (int k = begin; k < end; ++k)
+            {
+                relax(settled[k], bucketWidth, false, buffers[worker]);
+            }
+        });
+
+        mergeInserts();
+    }
+
+    buildTree(sourceCell, tree);
+
+    auto endTime = std::chrono::steady_clock::now();
+    tree.executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return tree;
+}
+
+
+/********************* RELAX *******************/
+
+void DeltaStepping::relax(CellId cell, double bucketWidth, bool light, WorkerBuffer& buffer)
+{
+    double distance = distances[cell].load(std::memory_order_relaxed);
+
+    graph.forEachNeighbor(cell, [&](CellId next, double cost)
+    {
+        double newDistance = distance + cost;
+
+        if ((cost <= bucketWidth) != light)
+        {
+            return;
+        }
+
+        buffer.relaxations++;
+
+        if (lowerDistance(distances[next], newDistance))
+        {
+            buffer.inserts.push_back({ static_cast<size_t>(newDistance / bucketWidth), next });
+        }
+    });
+}
+
+
+/***************** MERGE INSERTS ***************/
+
+void DeltaStepping::mergeInserts()
+{
+    for (auto& buffer : buffers)
+    {
+        for (const auto& [bucket, cell] : buffer.inserts)
+        {
+            if (bucket >= buckets.size())
+            {
+                buckets.resize(bucket + 1);
+            }
+
+            buckets[bucket].push_back(cell);
+        }
+
+        buffer.inserts.clear();
+    }
+}
+
+
+/****************** BUILD TREE *****************/
+
+void DeltaStepping::buildTree(CellId source, ShortestPathTree& tree)
+{
+    const World& world = *graph.getWorld();
+    int cellCount = world.getCellCount();
+
+    tree.distance.resize(cellCount);
+    tree.parent.resize(cellCount);
+
+    // Every reached cell takes the predecessor through which its final distance is obtained
+    scheduler.parallelFor(cellCount, 0, [&](int begin, int end, unsigned int worker)
+    {
+        WorkerBuffer& buffer = buffers[worker];
+
+        for (int id = begin; id < end; ++id)
+        {
+            double distance = distances[id].load(std::memory_order_relaxed);
+            double best = SearchWorkspace::INF;
+            CellId parent = SearchWorkspace::NO_PARENT;
+
+            tree.distance[id] = distance;
+
+            if (distance == SearchWorkspace::INF)
+            {
+                tree.parent[id] = SearchWorkspace::NO_PARENT;
+                continue;
+            }
+
+            buffer.reachedCells++;
+
+            if (id == source)
+            {
+                tree.parent[id] = source;
+                continue;
+            }
+
+            graph.forEachPredecessor(id, [&](CellId previous, double cost)
+            {
+                double through = distances[previous].load(std::memory_order_relaxed) + cost;
+
+                if (through < best)
+                {
+                    best = through;
+                    parent = previous;
+                }
+            });
+
+            tree.parent[id] = parent;
+        }
+    });
+
+    for (auto& buffer : buffers)
+    {
+        tree.reachedCells += buffer.reachedCells;
+        tree.relaxations += buffer.relaxations;
+        buffer.reachedCells = 0;
+        buffer.relaxations = 0;
+    }
+}
+
+
+/**************** RUN SEQUENTIAL ***************/
+
+ShortestPathTree DeltaStepping::runSequential(const State& source) const
+{
+    const World& world = *graph.getWorld();
+    auto startTime = std::chrono::steady_clock::now();
+    ShortestPathTree tree;
+    IndexedHeap open;
+    CellId sourceCell = world.findCell(source);
+
+    tree.distance.assign(world.getCellCount(), SearchWorkspace::INF);
+    tree.parent.assign(world.getCellCount(), SearchWorkspace::NO_PARENT);
+
+    if (sourceCell != World::INVALID_CELL && world.isFree(sourceCell))
+    {
+        open.reserve(world.getCellCount());
+        tree.distance[sourceCell] = 0.0;
+        tree.parent[sourceCell] = sourceCell;
+        open.push(sourceCell, 0.0);
+    }
+
+    while (!open.empty())
+    {
+        CellId cell = open.pop();
+        double distance = tree.distance[cell];
+
+        tree.reachedCells++;
+
+        graph.forEachNeighbor(cell, [&](CellId next, double cost)
+        {
+            tree.relaxations++;
+
+            if (distance + cost < tree.distance[next])
+            {
+                tree.distance[next] = distance + cost;
+                tree.parent[next] = cell;
+                open.push(next, distance + cost);
+            }
+        });
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    tree.executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return tree;
+}
+
+
+/***************** EXTRACT PATH ****************/
+
+std::vector<State> DeltaStepping::extractPath(const World& world, const ShortestPathTree& tree, const State& target)
+{
+    std::vector<State> path;
+    CellId cell = world.findCell(target);
+    size_t length = 1;
+
+    if (cell == World::INVALID_CELL || static_cast<size_t>(cell) >= tree.parent.size() ||
+        tree.parent[cell] == SearchWorkspace::NO_PARENT)
+    {
+        return path;
+    }
+
+    // Count first, so the path is allocated once and filled back to front
+    for (CellId step = cell; tree.parent[step] != step; step = tree.parent[step])
+    {
+        length++;
+    }
+
+    path.resize(length);
+
+    for (CellId step = cell; ; step = tree.parent[step])
+    {
+        path[--length] = world.toState(step);
+
+        if (tree.parent[step] == step)
+        {
+            break;
+        }
+    }
+
+    return path;
+}
+
+
+/*********** HELPER FUNCTION ***********/
+
+// Atomic minimum: stores 'value' if it is below the current distance, returns whether it did
+static bool lowerDistance(std::atomic<double>& distance, double value)
+{
+    double current = distance.load(std::memory_order_relaxed);
+
+    while (value < current)
+    {
+        if (distance.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
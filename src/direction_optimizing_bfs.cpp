@@ -0,0 +1,341 @@
+#include "direction_optimizing_bfs.h"
+#include <algorithm>
+#include <chrono>
+
+
+/***************** CONSTRUCTOR *****************/
+
+DirectionOptimizingBFS::DirectionOptimizingBFS(const Graph& graph, unsigned int threadCount)
+    : graph(graph), scheduler(threadCount), alpha(14.0), beta(24.0), sequentialLimit(4096), capacity(0),
+    buffers(scheduler.size())
+{
+}
+
+
+/************ SET SWITCH THRESHOLDS ************/
+
+void DirectionOptimizingBFS::setSwitchThresholds(double toBottomUp, double toTopDown)
+{
+    alpha = std::max(0.0, toBottomUp);
+    beta = std::max(alpha, toTopDown);
+}
+
+
+/*************** GET THREAD COUNT **************/
+
+unsigned int DirectionOptimizingBFS::getThreadCount() const
+{
+    return scheduler.size();
+}
+
+
+/******************** PREPARE ******************/
+
+void DirectionOptimizingBFS::prepare(int cellCount)
+{
+    if (capacity != static_cast<size_t>(cellCount))
+    {
+        layerOf = std::make_unique<std::atomic<int>[]>(cellCount);
+        capacity = static_cast<size_t>(cellCount);
+    }
+
+    runStep(cellCount, cellCount / 8, [&](int begin, int end, unsigned int)
+    {
+        for (int id = begin; id < end; ++id)
+        {
+            layerOf[id].store(-1, std::memory_order_relaxed);
+        }
+    });
+}
+
+
+/********************* EXPAND ******************/
+
+int DirectionOptimizingBFS::expand(CellId source, CellId target, std::vector<BFSLayerStats>& layers, int& reachedCells)
+{
+    const World& world = *graph.getWorld();
+    State sourceState = world.toState(source);
+    bool bottomUp = false;
+    int layer = 0;
+
+    prepare(world.getCellCount());
+    layers.clear();
+
+    for (auto& buffer : buffers)
+    {
+        buffer.next.clear();
+        buffer.edgesChecked = 0;
+        buffer.minX = world.getWidth();
+        buffer.maxX = -1;
+        buffer.minY = world.getHeight();
+        buffer.maxY = -1;
+    }
+
+    layerOf[source].store(0, std::memory_order_relaxed);
+    frontier.assign(1, source);
+    minX = std::max(0, sourceState.x - 1);
+    maxX = std::min(world.getWidth() - 1, sourceState.x + 1);
+    minY = std::max(0, sourceState.y - 1);
+    maxY = std::min(world.getHeight() - 1, sourceState.y + 1);
+    reachedCells = 1;
+
+    while (!frontier.empty() && (target == World::INVALID_CELL || layerOf[target].load(std::memory_order_relaxed) < 0))
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        BFSLayerStats stats;
+        double frontierSize = static_cast<double>(frontier.size());
+
+        stats.frontierSize = static_cast<int>(frontier.size());
+        stats.boxCells = (maxX - minX + 1) * (maxY - minY + 1);
+
+        // Dense frontiers are cheaper to find from the unvisited side, sparse ones from the frontier
+        if (!bottomUp && frontierSize * alpha > stats.boxCells)
+        {
+            bottomUp = true;
+        }
+        else if (bottomUp && frontierSize * beta < stats.boxCells)
+        {
+            bottomUp = false;
+        }
+
+        stats.bottomUp = bottomUp;
+
+        if (bottomUp)
+        {
+            stepBottomUp(layer + 1, stats);
+        }
+        else
+        {
+            stepTopDown(layer + 1, stats);
+        }
+
+        mergeNext(stats);
+
+        if (!frontier.empty())
+        {
+            layer++;
+            reachedCells += static_cast<int>(frontier.size());
+        }
+
+        auto endTime = std::chrono::steady_clock::now();
+        stats.time = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        layers.push_back(stats);
+    }
+
+    frontier.clear();
+
+    return layer;
+}
+
+
+/****************** STEP TOP DOWN **************/
+
+void DirectionOptimizingBFS::stepTopDown(int layer, BFSLayerStats& stats)
+{
+    const World& world = *graph.getWorld();
+
+    runStep(stats.frontierSize, stats.frontierSize * Graph::MOVE_COUNT, [&](int begin, int end, unsigned int worker)
+    {
+        WorkerBuffer& buffer = buffers[worker];
+
+        for (int k = begin; k < end; ++k)
+        {
+            graph.forEachNeighbor(frontier[k], [&](CellId next, double)
+            {
+                int unvisited = -1;
+
+                buffer.edgesChecked++;
+
+                // Only the worker whose exchange succeeds adds the cell to the next layer
+                if (layerOf[next].load(std::memory_order_relaxed) < 0 &&
+                    layerOf[next].compare_exchange_strong(unvisited, layer, std::memory_order_relaxed))
+                {
+                    State state = world.toState(next);
+
+                    buffer.next.push_back(next);
+                    buffer.minX = std::min(buffer.minX, state.x);
+                    buffer.maxX = std::max(buffer.maxX, state.x);
+                    buffer.minY = std::min(buffer.minY, state.y);
+                    buffer.maxY = std::max(buffer.maxY, state.y);
+                }
+            });
+        }
+    });
+}
+
+
+/***************** STEP BOTTOM UP **************/
+
+void DirectionOptimizingBFS::stepBottomUp(int layer, BFSLayerStats& stats)
+{
+    const World& world = *graph.getWorld();
+
+    runStep(maxY - minY + 1, stats.boxCells, [&](int begin, int end, unsigned int worker)
+    {
+        WorkerBuffer& buffer = buffers[worker];
+
+        for (int y = minY + begin; y < minY + end; ++y)
+        {
+            CellId rowStart = world.toCell({ minX, y });
+
+            for (int x = minX; x <= maxX; ++x)
+            {
+                CellId cell = rowStart + (x - minX);
+                bool found = false;
+
+                if (!world.isFree(cell) || layerOf[cell].load(std::memory_order_relaxed) >= 0)
+                {
+                    continue;
+                }
+
+                // The first neighbor in the previous layer is enough
+                graph.forEachPredecessor(cell, [&](CellId previous, double)
+                {
+                    if (!found)
+                    {
+                        buffer.edgesChecked++;
+                        found = layerOf[previous].load(std::memory_order_relaxed) == layer - 1;
+                    }
+                });
+
+                if (found)
+                {
+                    layerOf[cell].store(layer, std::memory_order_relaxed);
+                    buffer.next.push_back(cell);
+                    buffer.minX = std::min(buffer.minX, x);
+                    buffer.maxX = std::max(buffer.maxX, x);
+                    buffer.minY = std::min(buffer.minY, y);
+                    buffer.maxY = std::max(buffer.maxY, y);
+                }
+            }
+        }
+    });
+}
+
+
+/********************* RUN STEP ****************/
+
+void DirectionOptimizingBFS::runStep(int count, int work, const std::function<void(int, int, unsigned int)>& job)
+{
+    // Task overhead dominates small steps
+    if (work < sequentialLimit || scheduler.size() == 1)
+    {
+        job(0, count, 0);
+        return;
+    }
+
+    scheduler.parallelFor(count, 0, job);
+}
+
+
+/******************** MERGE NEXT ***************/
+
+void DirectionOptimizingBFS::mergeNext(BFSLayerStats& stats)
+{
+    const World& world = *graph.getWorld();
+    int newMinX = world.getWidth();
+    int newMaxX = -1;
+    int newMinY = world.getHeight();
+    int newMaxY = -1;
+
+    frontier.clear();
+
+    for (auto& buffer : buffers)
+    {
+        frontier.insert(frontier.end(), buffer.next.begin(), buffer.next.end());
+        stats.edgesChecked += buffer.edgesChecked;
+
+        if (!buffer.next.empty())
+        {
+            newMinX = std::min(newMinX, buffer.minX);
+            newMaxX = std::max(newMaxX, buffer.maxX);
+            newMinY = std::min(newMinY, buffer.minY);
+            newMaxY = std::max(newMaxY, buffer.maxY);
+        }
+
+        buffer.next.clear();
+        buffer.edgesChecked = 0;
+        buffer.minX = world.getWidth();
+        buffer.maxX = -1;
+        buffer.minY = world.getHeight();
+        buffer.maxY = -1;
+    }
+
+    // Cells of the next layer lie at most one cell outside the frontier's box
+    minX = std::max(0, newMinX - 1);
+    maxX = std::min(world.getWidth() - 1, newMaxX + 1);
+    minY = std::max(0, newMinY - 1);
+    maxY = std::min(world.getHeight() - 1, newMaxY + 1);
+}
+
+
+/********************* SEARCH ******************/
+
+int DirectionOptimizingBFS::search(const State& start, const State& goal, std::vector<State>& path, int& reachedCells,
+    std::vector<BFSLayerStats>& layers)
+{
+    const World& world = *graph.getWorld();
+    CellId current = world.toCell(goal);
+    int length = 0;
+    int step = 0;
+
+    path.clear();
+
+    expand(world.toCell(start), current, layers, reachedCells);
+    length = layerOf[current].load(std::memory_order_relaxed);
+
+    if (length < 0)
+    {
+        return -1;
+    }
+
+    // Walk back from the goal, each step into the first neighbor of the previous layer
+    path.resize(static_cast<size_t>(length) + 1);
+    path[length] = goal;
+
+    for (step = length; step > 0; --step)
+    {
+        CellId previousCell = current;
+
+        graph.forEachPredecessor(current, [&](CellId previous, double)
+        {
+            if (previousCell == current && layerOf[previous].load(std::memory_order_relaxed) == step - 1)
+            {
+                previousCell = previous;
+            }
+        });
+
+        current = previousCell;
+        path[step - 1] = world.toState(current);
+    }
+
+    return length;
+}
+
+
+/***************** COMPUTE LAYERS **************/
+
+int DirectionOptimizingBFS::computeLayers(const State& source, std::vector<int>& distance, std::vector<BFSLayerStats>& layers)
+{
+    const World& world = *graph.getWorld();
+    CellId sourceCell = world.findCell(source);
+    int reachedCells = 0;
+    int lastLayer = 0;
+
+    distance.assign(world.getCellCount(), -1);
+    layers.clear();
+
+    if (sourceCell == World::INVALID_CELL || !world.isFree(sourceCell))
+    {
+        return -1;
+    }
+
+    lastLayer = expand(sourceCell, World::INVALID_CELL, layers, reachedCells);
+
+    for (size_t id = 0; id < distance.size(); ++id)
+    {
+        distance[id] = layerOf[id].load(std::memory_order_relaxed);
+    }
+
+    return lastLayer;
+}
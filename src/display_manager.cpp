@@ -109,6 +109,22 @@ static void printAlgorithmHeader(SearchType type, int step, int points)
         std::cout << "A*";
         break;
 
+    case SearchType::JPS:
+        std::cout << "JPS";
+        break;
+
+    case SearchType::JPSPlus:
+        std::cout << "JPS+";
+        break;
+
+    case SearchType::BidirectionalDijkstra:
+        std::cout << "Bi-Dijkstra";
+        break;
+
+    case SearchType::BidirectionalAStar:
+        std::cout << "Bi-A*";
+        break;
+
     default:
         std::cout << "BFS";
         break;
@@ -0,0 +1,265 @@
+#include "distance_matrix.h"
+#include <algorithm>
+#include <chrono>
+
+
+/***************** CONSTRUCTOR *****************/
+
+DistanceMatrix::DistanceMatrix(const Graph& graph, unsigned int threadCount)
+    : graph(graph), scheduler(threadCount), workers(scheduler.size())
+{
+}
+
+
+/*************** GET THREAD COUNT **************/
+
+unsigned int DistanceMatrix::getThreadCount() const
+{
+    return scheduler.size();
+}
+
+
+/********************* COMPUTE *****************/
+
+bool DistanceMatrix::compute(const std::vector<State>& sourceSet, const std::vector<State>& targetSet)
+{
+    const World& world = *graph.getWorld();
+    auto startTime = std::chrono::steady_clock::now();
+    int cellCount = world.getCellCount();
+    size_t columns = targetSet.size();
+    bool anySource = false;
+
+    sources = sourceSet;
+    targets = targetSet;
+    settledCells = 0;
+
+    // Only the slots of the previous targets need resetting
+    for (CellId cell : targetCells)
+    {
+        targetSlot[cell] = -1;
+    }
+
+    targetSlot.resize(cellCount, -1);
+    targetCells.clear();
+    columnSlot.assign(columns, -1);
+    costs.assign(sources.size() * columns, SearchWorkspace::INF);
+
+    for (size_t j = 0; j < columns; ++j)
+    {
+        CellId cell = world.findCell(targets[j]);
+
+        if (cell == World::INVALID_CELL || !world.isFree(cell))
+        {
+            continue;
+        }
+
+        if (targetSlot[cell] < 0)
+        {
+            targetSlot[cell] = static_cast<int>(targetCells.size());
+            targetCells.push_back(cell);
+        }
+
+        columnSlot[j] = targetSlot[cell];
+    }
+
+    for (const State& source : sources)
+    {
+        CellId cell = world.findCell(source);
+        anySource |= cell != World::INVALID_CELL && world.isFree(cell);
+    }
+
+    if (anySource && !targetCells.empty())
+    {
+        for (auto& worker : workers)
+        {
+            worker.settledCells = 0;
+        }
+
+        auto job = [&](int begin, int end, unsigned int index)
+        {
+            Worker& worker = workers[index];
+
+            for (int i = begin; i < end; ++i)
+            {
+                CellId source = world.findCell(sources[i]);
+                double* row = costs.data() + static_cast<size_t>(i) * columns;
+
+                if (source == World::INVALID_CELL || !world.isFree(source))
+                {
+                    continue;
+                }
+
+                worker.settledCells += search(worker, source, World::INVALID_CELL);
+
+                // Every row belongs to one task, so workers never write the same entries
+                for (size_t j = 0; j < columns; ++j)
+                {
+                    if (columnSlot[j] >= 0)
+                    {
+                        row[j] = worker.found[columnSlot[j]];
+                    }
+                }
+            }
+        };
+
+        if (scheduler.size() == 1)
+        {
+            job(0, static_cast<int>(sources.size()), 0);
+        }
+        else
+        {
+            scheduler.parallelFor(static_cast<int>(sources.size()), 1, job);
+        }
+
+        for (const auto& worker : workers)
+        {
+            settledCells += worker.settledCells;
+        }
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return anySource && !targetCells.empty();
+}
+
+
+/********************* SEARCH ******************/
+
+size_t DistanceMatrix::search(Worker& worker, CellId source, CellId stopCell) const
+{
+    SearchWorkspace& workspace = worker.workspace;
+    IndexedHeap& open = worker.open;
+    size_t remaining = targetCells.size();
+    size_t settled = 0;
+
+    workspace.prepare(graph.getWorld()->getCellCount());
+    open.reserve(graph.getWorld()->getCellCount());
+    worker.found.assign(targetCells.size(), SearchWorkspace::INF);
+
+    workspace.update(source, 0.0, source);
+    open.push(source, 0.0);
+
+    while (!open.empty())
+    {
+        CellId cell = open.pop();
+        double g = workspace.getCost(cell);
+
+        workspace.close(cell);
+        settled++;
+
+        // A settled cell's cost is final: record targets and stop once the last one is found
+        if (targetSlot[cell] >= 0)
+        {
+            worker.found[targetSlot[cell]] = g;
+            remaining--;
+        }
+
+        if ((stopCell == World::INVALID_CELL) ? remaining == 0 : cell == stopCell)
+        {
+            break;
+        }
+
+        graph.forEachNeighbor(cell, [&](CellId next, double cost)
+        {
+            if (!workspace.isClosed(next) && g + cost < workspace.getCost(next))
+            {
+                workspace.update(next, g + cost, cell);
+                open.push(next, g + cost);
+            }
+        });
+    }
+
+    return settled;
+}
+
+
+/******************** GET COST *****************/
+
+double DistanceMatrix::getCost(size_t source, size_t target) const
+{
+    if (source >= sources.size() || target >= targets.size())
+    {
+        return SearchWorkspace::INF;
+    }
+
+    return costs[source * targets.size() + target];
+}
+
+
+/******************** GET COSTS ****************/
+
+const std::vector<double>& DistanceMatrix::getCosts() const
+{
+    return costs;
+}
+
+
+/******************** GET PATH *****************/
+
+std::vector<State> DistanceMatrix::getPath(size_t source, size_t target)
+{
+    const World& world = *graph.getWorld();
+    std::vector<State> path;
+    Worker& worker = workers[0];
+    CellId sourceCell = World::INVALID_CELL;
+    CellId current = World::INVALID_CELL;
+
+    if (getCost(source, target) == SearchWorkspace::INF)
+    {
+        return path;
+    }
+
+    sourceCell = world.toCell(sources[source]);
+    current = targetCells[columnSlot[target]];
+
+    search(worker, sourceCell, current);
+
+    if (!worker.workspace.isClosed(current))
+    {
+        return path;
+    }
+
+    while (current != sourceCell)
+    {
+        path.push_back(world.toState(current));
+        current = worker.workspace.getParent(current);
+    }
+
+    path.push_back(sources[source]);
+    std::reverse(path.begin(), path.end());
+
+    return path;
+}
+
+
+/**************** GET SOURCE COUNT *************/
+
+size_t DistanceMatrix::getSourceCount() const
+{
+    return sources.size();
+}
+
+
+/**************** GET TARGET COUNT *************/
+
+size_t DistanceMatrix::getTargetCount() const
+{
+    return targets.size();
+}
+
+
+/**************** GET SETTLED CELLS ************/
+
+size_t DistanceMatrix::getSettledCells() const
+{
+    return settledCells;
+}
+
+
+/*************** GET EXECUTION TIME ************/
+
+double DistanceMatrix::getExecutionTime() const
+{
+    return executionTime;
+}
@@ -0,0 +1,235 @@
+#include "flow_field.h"
+#include "search_workspace.h"
+#include <chrono>
+
+
+/***************** CONSTRUCTOR *****************/
+
+FlowField::FlowField(const Graph& graph) : graph(graph)
+{
+}
+
+
+/******************** INDEX OF *****************/
+
+int FlowField::indexOf(const State& s) const
+{
+    if (s.x < 0 || s.y < 0 || s.x >= width || s.y >= height)
+    {
+        return -1;
+    }
+
+    return s.y * width + s.x;
+}
+
+
+/********************* COMPUTE *****************/
+
+bool FlowField::compute(const State& goal)
+{
+    return compute(std::vector<State>{ goal });
+}
+
+
+bool FlowField::compute(const std::vector<State>& goalSet)
+{
+    const World& world = *graph.getWorld();
+    auto startTime = std::chrono::steady_clock::now();
+    int cellCount = world.getCellCount();
+    int x = 0;
+    int y = 0;
+
+    width = world.getWidth();
+    height = world.getHeight();
+    builtEpoch = world.getEpoch();
+    reachedCells = 0;
+    goals.clear();
+
+    cost.assign(cellCount, SearchWorkspace::INF);
+    nextMove.assign(cellCount, 0);
+    open.reserve(cellCount);
+
+    for (const State& goal : goalSet)
+    {
+        CellId cell = world.findCell(goal);
+
+        if (cell != World::INVALID_CELL && world.isFree(cell) && cost[cell] != 0.0)
+        {
+            goals.push_back(goal);
+            cost[cell] = 0.0;
+            open.push(cell, 0.0);
+        }
+    }
+
+    // Backward Dijkstra: a predecessor reaches 'cell' by the opposite of the offset that leads to it
+    while (!open.empty())
+    {
+        CellId cell = open.pop();
+        double distance = cost[cell];
+        double weight = world.getWeight(cell);
+        int i = 0;
+
+        for (i = 0; i < Graph::MOVE_COUNT; ++i)
+        {
+            CellId previous = cell + graph.getOffset(i);
+            double through = distance + Graph::getMoveCost(i) * weight;
+
+            if (world.isFree(previous) && through < cost[previous])
+            {
+                cost[previous] = through;
+                nextMove[previous] = static_cast<std::uint8_t>(Graph::getOppositeMove(i));
+                open.push(previous, through);
+            }
+        }
+    }
+
+    // Pack the result per grid cell
+    distances.assign(static_cast<size_t>(width) * height, UNREACHABLE);
+    moves.assign((distances.size() + MOVES_PER_WORD - 1) / MOVES_PER_WORD, 0);
+
+    for (y = 0; y < height; ++y)
+    {
+        CellId rowStart = world.toCell({ 0, y });
+
+        for (x = 0; x < width; ++x)
+        {
+            int index = y * width + x;
+            double distance = cost[rowStart + x];
+
+            if (distance == SearchWorkspace::INF)
+            {
+                continue;
+            }
+
+            distances[index] = static_cast<float>(distance);
+            moves[index / MOVES_PER_WORD] |= static_cast<std::uint64_t>(nextMove[rowStart + x]) << (3 * (index % MOVES_PER_WORD));
+            reachedCells++;
+        }
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    buildTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return !goals.empty();
+}
+
+
+/********************* REFRESH *****************/
+
+bool FlowField::refresh()
+{
+    std::vector<State> current = goals;
+
+    if (isUpToDate())
+    {
+        return !goals.empty();
+    }
+
+    return compute(current);
+}
+
+
+/****************** IS UP TO DATE **************/
+
+bool FlowField::isUpToDate() const
+{
+    return !distances.empty() && !graph.getWorld()->hasChangedSince(builtEpoch);
+}
+
+
+/******************** GET MOVE *****************/
+
+int FlowField::getMove(const State& s) const
+{
+    int index = indexOf(s);
+
+    // Goals (distance 0) and unreachable cells have no move
+    if (index < 0 || !(distances[index] > 0.0f) || distances[index] == UNREACHABLE)
+    {
+        return NO_MOVE;
+    }
+
+    return storedMove(index);
+}
+
+
+/***************** GET NEXT STATE **************/
+
+State FlowField::getNextState(const State& s) const
+{
+    int move = getMove(s);
+
+    if (move == NO_MOVE)
+    {
+        return s;
+    }
+
+    return { s.x + Graph::getMove(move).x, s.y + Graph::getMove(move).y };
+}
+
+
+/****************** GET DISTANCE ***************/
+
+float FlowField::getDistance(const State& s) const
+{
+    int index = indexOf(s);
+
+    return (index < 0) ? UNREACHABLE : distances[index];
+}
+
+
+/****************** EXTRACT PATH ***************/
+
+std::vector<State> FlowField::extractPath(const State& start) const
+{
+    std::vector<State> path;
+    State current = start;
+
+    if (getDistance(start) == UNREACHABLE)
+    {
+        return path;
+    }
+
+    path.push_back(current);
+
+    // The moves form the shortest path tree of the backward search, so the walk ends at a goal
+    while (getMove(current) != NO_MOVE)
+    {
+        current = getNextState(current);
+        path.push_back(current);
+    }
+
+    return path;
+}
+
+
+/******************* GET GOALS *****************/
+
+const std::vector<State>& FlowField::getGoals() const
+{
+    return goals;
+}
+
+
+/*************** GET REACHED CELLS *************/
+
+int FlowField::getReachedCells() const
+{
+    return reachedCells;
+}
+
+
+/***************** GET BUILD TIME **************/
+
+double FlowField::getBuildTime() const
+{
+    return buildTime;
+}
+
+
+/***************** GET FIELD BYTES *************/
+
+size_t FlowField::getFieldBytes() const
+{
+    return distances.size() * sizeof(float) + moves.size() * sizeof(std::uint64_t);
+}
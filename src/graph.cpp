@@ -9,9 +9,41 @@ const std::vector<State> Graph::moves =
 };
 
 
+const std::array<double, 8> Graph::moveCosts =
+{
+	1.0, 1.0, 1.0, 1.0,                                       // cardinal
+	DIAGONAL_COST, DIAGONAL_COST, DIAGONAL_COST, DIAGONAL_COST // diagonal
+};
+
+
 /***************** CONSTRUCTOR *****************/
 
-Graph::Graph(const World* world) : world(world) {}
+Graph::Graph(const World* world) : world(world), offsets{}
+{
+	size_t i = 0;
+	int stride = (world != nullptr) ? world->getStride() : 0;
+
+	for (i = 0; i < moves.size(); ++i)
+	{
+		offsets[i] = moves[i].y * stride + moves[i].x;
+	}
+}
+
+
+/****************** GET WORLD ******************/
+
+const World* Graph::getWorld() const
+{
+	return world;
+}
+
+
+/******************* GET MOVE ******************/
+
+const State& Graph::getMove(int index)
+{
+	return moves[index];
+}
 
 
 /**************** GET NEIGHBOR ****************/
@@ -19,16 +51,19 @@ Graph::Graph(const World* world) : world(world) {}
 std::vector<State> Graph::getNeighbors(const State& state) const
 {
 	std::vector<State> neighbors;
-	State next;
-	
-	for (const auto& move : moves)
+	CellId cell = world->findCell(state);
+	size_t i = 0;
+
+	if (cell == World::INVALID_CELL)
 	{
-		next.x = state.x + move.x;
-		next.y = state.y + move.y;
+		return neighbors;
+	}
 
-		if (isValid(next))
+	for (i = 0; i < moves.size(); ++i)
+	{
+		if (world->isFree(cell + offsets[i]))
 		{
-			neighbors.push_back(next);
+			neighbors.push_back({ state.x + moves[i].x, state.y + moves[i].y });
 		}
 	}
 
@@ -42,8 +77,9 @@ double Graph::getCost(const State& from, const State& to) const
 {
 	int dx = 0;
 	int dy = 0;
+	CellId toCell = world->findCell(to);
 
-	if (!isValid(to))
+	if (toCell == World::INVALID_CELL || !world->isFree(toCell))
 	{
 		return world->BLOCK;
 	}
@@ -58,12 +94,12 @@ double Graph::getCost(const State& from, const State& to) const
 
 	if (dx + dy == 2)
 	{
-		return DIAGONAL_COST * world->getWeight(to);  // diagonal
+		return DIAGONAL_COST * world->getWeight(toCell);  // diagonal
 	}
 
 	else
 	{
-		return world->getWeight(to);  // cardinal
+		return world->getWeight(toCell);  // cardinal
 	}
 }
 
@@ -0,0 +1,76 @@
+#include "helper_thread.h"
+#include <utility>
+
+/****************** DESTRUCTOR *****************/
+
+HelperThread::~HelperThread()
+{
+    if (!thread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    jobReady.notify_one();
+    thread.join();
+}
+
+
+/********************** RUN ********************/
+
+void HelperThread::run(std::function<void()> task)
+{
+    if (!thread.joinable())
+    {
+        thread = std::thread(&HelperThread::loop, this);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = std::move(task);
+        busy = true;
+    }
+
+    jobReady.notify_one();
+}
+
+
+/********************* WAIT ********************/
+
+void HelperThread::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    jobDone.wait(lock, [this] { return !busy; });
+}
+
+
+/********************* LOOP ********************/
+
+void HelperThread::loop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true)
+    {
+        jobReady.wait(lock, [this] { return stopping || busy; });
+
+        if (!busy)
+        {
+            return;
+        }
+
+        // The owner does not touch the job until wait() returns, so it runs unlocked
+        lock.unlock();
+        job();
+        lock.lock();
+
+        job = nullptr;
+        busy = false;
+        jobDone.notify_one();
+    }
+}
@@ -0,0 +1,216 @@
+#include "incremental_queue.h"
+
+/******************* RESERVE *******************/
+
+void IncrementalQueue::reserve(int cellCount)
+{
+    clear();
+
+    if (position.size() < static_cast<size_t>(cellCount))
+    {
+        position.resize(cellCount, NOT_IN_HEAP);
+    }
+}
+
+
+/******************** CLEAR ********************/
+
+void IncrementalQueue::clear()
+{
+    for (const auto& entry : heap)
+    {
+        position[entry.id] = NOT_IN_HEAP;
+    }
+
+    heap.clear();
+}
+
+
+/******************** EMPTY ********************/
+
+bool IncrementalQueue::empty() const
+{
+    return heap.empty();
+}
+
+
+/******************** SIZE *********************/
+
+size_t IncrementalQueue::size() const
+{
+    return heap.size();
+}
+
+
+/****************** CONTAINS *******************/
+
+bool IncrementalQueue::contains(CellId id) const
+{
+    return position[id] != NOT_IN_HEAP;
+}
+
+
+/******************** PUSH *********************/
+
+void IncrementalQueue::push(CellId id, const QueueKey& key)
+{
+    int index = position[id];
+
+    if (index == NOT_IN_HEAP)
+    {
+        heap.push_back({ key, id });
+        position[id] = static_cast<int>(heap.size() - 1);
+        siftUp(heap.size() - 1);
+        return;
+    }
+
+    // Update in place, towards the root or the leaves
+    if (key < heap[index].key)
+    {
+        heap[index].key = key;
+        siftUp(index);
+    }
+    else
+    {
+        heap[index].key = key;
+        siftDown(index);
+    }
+}
+
+
+/******************* REMOVE ********************/
+
+void IncrementalQueue::remove(CellId id)
+{
+    int index = position[id];
+    QueueKey removedKey;
+
+    if (index == NOT_IN_HEAP)
+    {
+        return;
+    }
+
+    removedKey = heap[index].key;
+    position[id] = NOT_IN_HEAP;
+    heap[index] = heap.back();
+    heap.pop_back();
+
+    if (static_cast<size_t>(index) == heap.size())
+    {
+        return;
+    }
+
+    // The last entry fills the hole and may belong above or below it
+    position[heap[index].id] = index;
+
+    if (heap[index].key < removedKey)
+    {
+        siftUp(index);
+    }
+    else
+    {
+        siftDown(index);
+    }
+}
+
+
+/********************* TOP *********************/
+
+CellId IncrementalQueue::top() const
+{
+    return heap.front().id;
+}
+
+
+/******************* TOP KEY *******************/
+
+const QueueKey& IncrementalQueue::topKey() const
+{
+    return heap.front().key;
+}
+
+
+/********************* POP *********************/
+
+CellId IncrementalQueue::pop()
+{
+    CellId first = heap.front().id;
+
+    remove(first);
+
+    return first;
+}
+
+
+/******************* SIFT UP *******************/
+
+void IncrementalQueue::siftUp(size_t index)
+{
+    Entry entry = heap[index];
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / ARITY;
+
+        if (!(entry.key < heap[parent].key))
+        {
+            break;
+        }
+
+        heap[index] = heap[parent];
+        position[heap[index].id] = static_cast<int>(index);
+        index = parent;
+    }
+
+    heap[index] = entry;
+    position[entry.id] = static_cast<int>(index);
+}
+
+
+/****************** SIFT DOWN ******************/
+
+void IncrementalQueue::siftDown(size_t index)
+{
+    Entry entry = heap[index];
+    size_t count = heap.size();
+
+    while (true)
+    {
+        size_t first = index * ARITY + 1;
+        size_t last = first + ARITY;
+        size_t best = index;
+        QueueKey bestKey = entry.key;
+        size_t child = 0;
+
+        if (first >= count)
+        {
+            break;
+        }
+
+        if (last > count)
+        {
+            last = count;
+        }
+
+        for (child = first; child < last; ++child)
+        {
+            if (heap[child].key < bestKey)
+            {
+                best = child;
+                bestKey = heap[child].key;
+            }
+        }
+
+        if (best == index)
+        {
+            break;
+        }
+
+        heap[index] = heap[best];
+        position[heap[index].id] = static_cast<int>(index);
+        index = best;
+    }
+
+    heap[index] = entry;
+    position[entry.id] = static_cast<int>(index);
+}
@@ -0,0 +1,175 @@
+#include "indexed_heap.h"
+
+/******************* RESERVE *******************/
+
+void IndexedHeap::reserve(int cellCount)
+{
+    clear();
+
+    if (position.size() < static_cast<size_t>(cellCount))
+    {
+        position.resize(cellCount, NOT_IN_HEAP);
+    }
+}
+
+
+/******************** CLEAR ********************/
+
+void IndexedHeap::clear()
+{
+    for (const auto& entry : heap)
+    {
+        position[entry.id] = NOT_IN_HEAP;
+    }
+
+    heap.clear();
+}
+
+
+/******************** EMPTY ********************/
+
+bool IndexedHeap::empty() const
+{
+    return heap.empty();
+}
+
+
+/******************** SIZE *********************/
+
+size_t IndexedHeap::size() const
+{
+    return heap.size();
+}
+
+
+/****************** CONTAINS *******************/
+
+bool IndexedHeap::contains(CellId id) const
+{
+    return position[id] != NOT_IN_HEAP;
+}
+
+
+/******************** PUSH *********************/
+
+void IndexedHeap::push(CellId id, double priority)
+{
+    int index = position[id];
+
+    if (index == NOT_IN_HEAP)
+    {
+        heap.push_back({ priority, id });
+        position[id] = static_cast<int>(heap.size() - 1);
+        siftUp(heap.size() - 1);
+        return;
+    }
+
+    // Decrease-key
+    if (priority < heap[index].priority)
+    {
+        heap[index].priority = priority;
+        siftUp(index);
+    }
+}
+
+
+/**************** TOP PRIORITY *****************/
+
+double IndexedHeap::topPriority() const
+{
+    return heap.front().priority;
+}
+
+
+/********************* POP *********************/
+
+CellId IndexedHeap::pop()
+{
+    CellId top = heap.front().id;
+
+    position[top] = NOT_IN_HEAP;
+    heap.front() = heap.back();
+    heap.pop_back();
+
+    if (!heap.empty())
+    {
+        position[heap.front().id] = 0;
+        siftDown(0);
+    }
+
+    return top;
+}
+
+
+/******************* SIFT UP *******************/
+
+void IndexedHeap::siftUp(size_t index)
+{
+    Entry entry = heap[index];
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / ARITY;
+
+        if (heap[parent].priority <= entry.priority)
+        {
+            break;
+        }
+
+        heap[index] = heap[parent];
+        position[heap[index].id] = static_cast<int>(index);
+        index = parent;
+    }
+
+    heap[index] = entry;
+    position[entry.id] = static_cast<int>(index);
+}
+
+
+/****************** SIFT DOWN ******************/
+
+void IndexedHeap::siftDown(size_t index)
+{
+    Entry entry = heap[index];
+    size_t count = heap.size();
+
+    while (true)
+    {
+        size_t first = index * ARITY + 1;
+        size_t last = first + ARITY;
+        size_t best = index;
+        double bestPriority = entry.priority;
+        size_t child = 0;
+
+        if (first >= count)
+        {
+            break;
+        }
+
+        if (last > count)
+        {
+            last = count;
+        }
+
+        for (child = first; child < last; ++child)
+        {
+            if (heap[child].priority < bestPriority)
+            {
+                best = child;
+                bestPriority = heap[child].priority;
+            }
+        }
+
+        if (best == index)
+        {
+            break;
+        }
+
+        heap[index] = heap[best];
+        position[heap[index].id] = static_cast<int>(index);
+        index = best;
+    }
+
+    heap[index] = entry;
+    position[entry.id] = static_cast<int>(index);
+}
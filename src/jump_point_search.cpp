@@ -0,0 +1,361 @@
+#include "jump_point_search.h"
+#include "graph.h"
+#include <algorithm>
+#include <cstdlib>
+
+
+// Static helper function declaration
+static int sign(int value);
+
+
+/***************** CONSTRUCTOR *****************/
+
+JumpPointSearch::JumpPointSearch(const World& world) : world(world), stride(world.getStride()) {}
+
+
+/******************* OCTILE ********************/
+
+double JumpPointSearch::octile(const State& a, const State& b)
+{
+    int dx = std::abs(a.x - b.x);
+    int dy = std::abs(a.y - b.y);
+
+    return std::max(dx, dy) - std::min(dx, dy) + Graph::DIAGONAL_COST * std::min(dx, dy);
+}
+
+
+/************* HAS FORCED NEIGHBOR *************/
+
+bool JumpPointSearch::hasForcedNeighbor(const World& world, CellId cell, int dx, int dy)
+{
+    const int stride = world.getStride();
+
+    if (dx != 0 && dy != 0)
+    {
+        return (!world.isFree(cell - dx) && world.isFree(cell - dx + dy * stride)) ||
+            (!world.isFree(cell - dy * stride) && world.isFree(cell + dx - dy * stride));
+    }
+
+    if (dx != 0)
+    {
+        return (!world.isFree(cell + stride) && world.isFree(cell + dx + stride)) ||
+            (!world.isFree(cell - stride) && world.isFree(cell + dx - stride));
+    }
+
+    return (!world.isFree(cell + 1) && world.isFree(cell + 1 + dy * stride)) ||
+        (!world.isFree(cell - 1) && world.isFree(cell - 1 + dy * stride));
+}
+
+
+/********************* JUMP ********************/
+
+CellId JumpPointSearch::jump(CellId from, int dx, int dy, CellId goal, int& steps) const
+{
+    CellId offset = dy * stride + dx;
+    CellId current = from;
+    int straightSteps = 0;
+
+    steps = 0;
+
+    while (true)
+    {
+        current += offset;
+        steps++;
+
+        if (!world.isFree(current))
+        {
+            return World::INVALID_CELL;
+        }
+
+        if (current == goal || hasForcedNeighbor(world, current, dx, dy))
+        {
+            return current;
+        }
+
+        // A diagonal cell is a jump point if a straight jump from it finds one
+        if (dx != 0 && dy != 0)
+        {
+            if (jump(current, dx, 0, goal, straightSteps) != World::INVALID_CELL ||
+                jump(current, 0, dy, goal, straightSteps) != World::INVALID_CELL)
+            {
+                return current;
+            }
+        }
+    }
+}
+
+
+/****************** EXPAND PATH ****************/
+
+void JumpPointSearch::expandPath(CellId startCell, CellId goalCell, const SearchWorkspace& workspace,
+    std::vector<State>& path) const
+{
+    CellId cell = goalCell;
+    size_t length = 1;
+
+    // Consecutive jump points lie on one straight or diagonal line, so the number
+    // of cells between them is their Chebyshev distance
+    for (cell = goalCell; cell != startCell; cell = workspace.getParent(cell))
+    {
+        State from = world.toState(workspace.getParent(cell));
+        State to = world.toState(cell);
+
+        length += std::max(std::abs(to.x - from.x), std::abs(to.y - from.y));
+    }
+
+    path.resize(length);
+
+    // Fill back to front, walking from each jump point towards its parent
+    for (cell = goalCell; cell != startCell; cell = workspace.getParent(cell))
+    {
+        State current = world.toState(cell);
+        State parent = world.toState(workspace.getParent(cell));
+        int dx = sign(parent.x - current.x);
+        int dy = sign(parent.y - current.y);
+
+        while (current != parent)
+        {
+            path[--length] = current;
+            current.x += dx;
+            current.y += dy;
+        }
+    }
+    path[0] = world.toState(startCell);
+}
+
+
+/*********** ADD PRUNED DIRECTIONS ************/
+
+void JumpPointSearch::addPrunedDirections(CellId cell, CellId parent, int dirs[][2], int& dirCount) const
+{
+    State cellState = world.toState(cell);
+    State parentState = world.toState(parent);
+    int dx = sign(cellState.x - parentState.x);
+    int dy = sign(cellState.y - parentState.y);
+
+    if (dx != 0 && dy != 0)
+    {
+        // Natural neighbors, then forced neighbors next to obstacles behind the move
+        dirs[dirCount][0] = dx; dirs[dirCount++][1] = 0;
+        dirs[dirCount][0] = 0; dirs[dirCount++][1] = dy;
+        dirs[dirCount][0] = dx; dirs[dirCount++][1] = dy;
+
+        if (!world.isFree(cell - dx))
+        {
+            dirs[dirCount][0] = -dx; dirs[dirCount++][1] = dy;
+        }
+        if (!world.isFree(cell - dy * stride))
+        {
+            dirs[dirCount][0] = dx; dirs[dirCount++][1] = -dy;
+        }
+    }
+    else if (dx != 0)
+    {
+        dirs[dirCount][0] = dx; dirs[dirCount++][1] = 0;
+
+        if (!world.isFree(cell + stride))
+        {
+            dirs[dirCount][0] = dx; dirs[dirCount++][1] = 1;
+        }
+        if (!world.isFree(cell - stride))
+        {
+            dirs[dirCount][0] = dx; dirs[dirCount++][1] = -1;
+        }
+    }
+    else
+    {
+        dirs[dirCount][0] = 0; dirs[dirCount++][1] = dy;
+
+        if (!world.isFree(cell + 1))
+        {
+            dirs[dirCount][0] = 1; dirs[dirCount++][1] = dy;
+        }
+        if (!world.isFree(cell - 1))
+        {
+            dirs[dirCount][0] = -1; dirs[dirCount++][1] = dy;
+        }
+    }
+}
+
+
+/****************** RUN SEARCH *****************/
+
+template <typename JumpFunction>
+PlanResults JumpPointSearch::runSearch(const State& start, const State& goal, SearchWorkspace& workspace,
+    IndexedHeap& open, std::vector<State>& path, JumpFunction jumpFrom) const
+{
+    static const int directions[8][2] =
+    {
+        {1,0}, {-1,0}, {0,1}, {0,-1},
+        {1,1}, {1,-1}, {-1,1}, {-1,-1}
+    };
+
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
+    PlanResults result;
+    int nodesExpanded = 0;
+    size_t peakOpenSize = 0;
+
+    path.clear();
+
+    if (start == goal)
+    {
+        path.assign(1, start);
+        return { {}, true, 0.0, 0.0, 1 };
+    }
+
+    workspace.prepare(world.getCellCount());
+    open.reserve(world.getCellCount());
+
+    workspace.update(startCell, 0.0, startCell);
+    open.push(startCell, octile(start, goal));
+
+    while (!open.empty())
+    {
+        peakOpenSize = std::max(peakOpenSize, open.size());
+
+        CellId current = open.pop();
+        CellId parent = workspace.getParent(current);
+        double currentCost = workspace.getCost(current);
+        int dirs[8][2] = {};
+        int dirCount = 0;
+        int i = 0;
+
+        workspace.close(current);
+        nodesExpanded++;
+
+        if (current == goalCell)
+        {
+            break;
+        }
+
+        // Pruned successor directions, based on the direction of arrival
+        if (current == startCell)
+        {
+            for (i = 0; i < 8; ++i)
+            {
+                dirs[dirCount][0] = directions[i][0]; dirs[dirCount++][1] = directions[i][1];
+            }
+        }
+        else
+        {
+            addPrunedDirections(current, parent, dirs, dirCount);
+        }
+
+        for (i = 0; i < dirCount; ++i)
+        {
+            int steps = 0;
+            CellId next = jumpFrom(current, dirs[i][0], dirs[i][1], steps);
+
+            if (next == World::INVALID_CELL || workspace.isClosed(next))
+            {
+                continue;
+            }
+
+            double stepCost = (dirs[i][0] != 0 && dirs[i][1] != 0) ? Graph::DIAGONAL_COST : 1.0;
+            double newCost = currentCost + steps * stepCost;
+
+            if (newCost < workspace.getCost(next))
+            {
+                workspace.update(next, newCost, current);
+                open.push(next, newCost + octile(world.toState(next), goal));
+            }
+        }
+    }
+
+    result.nodesExpanded = nodesExpanded;
+    result.peakOpenSize = static_cast<int>(peakOpenSize);
+    result.executionTime = 0.0;
+
+    if (!workspace.isClosed(goalCell))
+    {
+        result.success = false;
+        result.totalCost = 0.0;
+        return result;
+    }
+
+    expandPath(startCell, goalCell, workspace, path);
+    result.totalCost = workspace.getCost(goalCell);
+    result.success = true;
+
+    return result;
+}
+
+
+/******************** SEARCH *******************/
+
+PlanResults JumpPointSearch::search(const State& start, const State& goal, SearchWorkspace& workspace, IndexedHeap& open,
+    std::vector<State>& path) const
+{
+    CellId goalCell = world.toCell(goal);
+
+    return runSearch(start, goal, workspace, open, path, [&](CellId from, int dx, int dy, int& steps)
+    {
+        return jump(from, dx, dy, goalCell, steps);
+    });
+}
+
+
+/***************** SEARCH PLUS *****************/
+
+PlanResults JumpPointSearch::searchPlus(const State& start, const State& goal, const JumpPointTable& table,
+    SearchWorkspace& workspace, IndexedHeap& open, std::vector<State>& path) const
+{
+    return runSearch(start, goal, workspace, open, path, [&](CellId from, int dx, int dy, int& steps)
+    {
+        return tableJump(from, dx, dy, goal, table, steps);
+    });
+}
+
+
+/****************** TABLE JUMP *****************/
+
+CellId JumpPointSearch::tableJump(CellId from, int dx, int dy, const State& goal, const JumpPointTable& table, int& steps) const
+{
+    int distance = table.getDistance(from, JumpPointTable::directionIndex(dx, dy));
+    int reach = std::abs(distance);
+    State fromState = world.toState(from);
+    int gx = goal.x - fromState.x;
+    int gy = goal.y - fromState.y;
+    CellId offset = dy * stride + dx;
+
+    // Goal bounding: stop at the goal, or at the diagonal cell aligned with it,
+    // if it lies in this direction before the next jump point or wall
+    if (dx == 0 || dy == 0)
+    {
+        bool inLine = (dx != 0) ? (gy == 0 && sign(gx) == dx) : (gx == 0 && sign(gy) == dy);
+        int goalDistance = std::abs(gx) + std::abs(gy);
+
+        if (inLine && goalDistance <= reach)
+        {
+            steps = goalDistance;
+            return from + goalDistance * offset;
+        }
+    }
+    else if (sign(gx) == dx && sign(gy) == dy)
+    {
+        int aligned = std::min(std::abs(gx), std::abs(gy));
+
+        if (aligned <= reach)
+        {
+            steps = aligned;
+            return from + aligned * offset;
+        }
+    }
+
+    if (distance > 0)
+    {
+        steps = distance;
+        return from + distance * offset;
+    }
+
+    return World::INVALID_CELL;
+}
+
+
+/*********** HELPER FUNCTION ***********/
+
+static int sign(int value)
+{
+    return (value > 0) - (value < 0);
+}
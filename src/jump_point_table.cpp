@@ -0,0 +1,330 @@
+#include "jump_point_table.h"
+#include "jump_point_search.h"
+#include "work_stealing_scheduler.h"
+#include <fstream>
+#include <thread>
+#include <algorithm>
+#include <functional>
+#include <cstring>
+
+
+// Static helper function declaration
+static void runParallel(int count, unsigned int threadCount, const std::function<void(int, int)>& job);
+
+static const char FILE_MAGIC[4] = { 'J', 'P', 'S', 'P' };
+static const std::uint32_t FILE_VERSION = 1;
+
+
+/****************** DIRECTIONS *****************/
+
+const int JumpPointTable::DX[DIRECTION_COUNT] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+const int JumpPointTable::DY[DIRECTION_COUNT] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+
+/*************** DIRECTION INDEX ***************/
+
+int JumpPointTable::directionIndex(int dx, int dy)
+{
+    static const int index[3][3] =
+    {
+        // dx = -1, 0, 1
+        { 7, 3, 5 },   // dy = -1
+        { 1, -1, 0 },  // dy = 0
+        { 6, 2, 4 }    // dy = 1
+    };
+
+    return index[dy + 1][dx + 1];
+}
+
+
+/************* COMPUTE FINGERPRINT *************/
+
+std::uint64_t JumpPointTable::computeFingerprint(const World& world)
+{
+    const std::uint64_t prime = 1099511628211ULL;
+    std::uint64_t hash = 14695981039346656037ULL;  // FNV-1a offset basis
+    int x = 0;
+    int y = 0;
+
+    hash = (hash ^ static_cast<std::uint64_t>(world.getWidth())) * prime;
+    hash = (hash ^ static_cast<std::uint64_t>(world.getHeight())) * prime;
+
+    for (y = 0; y < world.getHeight(); ++y)
+    {
+        for (x = 0; x < world.getWidth(); ++x)
+        {
+            hash = (hash ^ (world.isFree(world.toCell({ x, y })) ? 1u : 0u)) * prime;
+        }
+    }
+
+    return hash;
+}
+
+
+/******************** BUILD ********************/
+
+bool JumpPointTable::build(const World& world, unsigned int threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    return buildWith(world, [threadCount](int count, const std::function<void(int, int)>& job)
+    {
+        runParallel(count, threadCount, job);
+    });
+}
+
+
+/************* BUILD WITH SCHEDULER ************/
+
+bool JumpPointTable::build(const World& world, WorkStealingScheduler& scheduler)
+{
+    return buildWith(world, [&scheduler](int count, const std::function<void(int, int)>& job)
+    {
+        scheduler.parallelFor(count, 0, [&job](int begin, int end, unsigned int) { job(begin, end); });
+    });
+}
+
+
+/****************** BUILD WITH *****************/
+
+bool JumpPointTable::buildWith(const World& world, const ParallelFor& parallelFor)
+{
+    const int w = world.getWidth();
+    const int h = world.getHeight();
+    const int stride = world.getStride();
+
+    if (w > MAX_SIDE || h > MAX_SIDE)
+    {
+        return false;
+    }
+
+    table.assign(static_cast<size_t>(world.getCellCount()) * DIRECTION_COUNT, 0);
+
+    // Distance of a cell from the distance of the next cell in the same direction
+    auto step = [&](CellId cell, int dir, bool isJumpPoint)
+    {
+        CellId next = cell + DY[dir] * stride + DX[dir];
+        int nextDistance = getDistance(next, dir);
+        int distance = 0;
+
+        if (!world.isFree(next))
+        {
+            distance = 0;
+        }
+        else if (isJumpPoint)
+        {
+            distance = 1;
+        }
+        else
+        {
+            distance = (nextDistance > 0) ? nextDistance + 1 : nextDistance - 1;
+        }
+
+        table[static_cast<size_t>(cell) * DIRECTION_COUNT + dir] = static_cast<std::int16_t>(distance);
+    };
+
+    auto straight = [&](CellId cell, int dir)
+    {
+        CellId next = cell + DY[dir] * stride + DX[dir];
+
+        if (world.isFree(cell))
+        {
+            step(cell, dir, world.isFree(next) && JumpPointSearch::hasForcedNeighbor(world, next, DX[dir], DY[dir]));
+        }
+    };
+
+    // Phase 1: east / west, parallel over rows
+    parallelFor(h, [&](int begin, int end)
+    {
+        for (int y = begin; y < end; ++y)
+        {
+            for (int x = w - 1; x >= 0; --x)
+            {
+                straight(world.toCell({ x, y }), directionIndex(1, 0));
+            }
+            for (int x = 0; x < w; ++x)
+            {
+                straight(world.toCell({ x, y }), directionIndex(-1, 0));
+            }
+        }
+    });
+
+    // Phase 2: south / north, parallel over columns
+    parallelFor(w, [&](int begin, int end)
+    {
+        for (int x = begin; x < end; ++x)
+        {
+            for (int y = h - 1; y >= 0; --y)
+            {
+                straight(world.toCell({ x, y }), directionIndex(0, 1));
+            }
+            for (int y = 0; y < h; ++y)
+            {
+                straight(world.toCell({ x, y }), directionIndex(0, -1));
+            }
+        }
+    });
+
+    // Phase 3: one sweep per diagonal; a diagonal cell is a jump point if it has a
+    // forced neighbor or a straight jump from it (along either component) finds one
+    parallelFor(4, [&](int begin, int end)
+    {
+        for (int dir = 4 + begin; dir < 4 + end; ++dir)
+        {
+            int dx = DX[dir];
+            int dy = DY[dir];
+            int dirX = directionIndex(dx, 0);
+            int dirY = directionIndex(0, dy);
+
+            for (int i = 0; i < h; ++i)
+            {
+                int y = (dy < 0) ? i : h - 1 - i;
+
+                for (int x = 0; x < w; ++x)
+                {
+                    CellId cell = world.toCell({ x, y });
+                    CellId next = cell + dy * stride + dx;
+
+                    if (!world.isFree(cell))
+                    {
+                        continue;
+                    }
+
+                    step(cell, dir, world.isFree(next) &&
+                        (JumpPointSearch::hasForcedNeighbor(world, next, dx, dy) ||
+                            getDistance(next, dirX) > 0 || getDistance(next, dirY) > 0));
+                }
+            }
+        }
+    });
+
+    width = w;
+    height = h;
+    fingerprint = computeFingerprint(world);
+    sourceWorldId = world.getInstanceId();
+    sourceObstacleVersion = world.getObstacleVersion();
+
+    return true;
+}
+
+
+/********************* SAVE ********************/
+
+bool JumpPointTable::save(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    std::int32_t dims[2] = { width, height };
+
+    if (!out || table.empty())
+    {
+        return false;
+    }
+
+    out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    out.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+    out.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+    out.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+    out.write(reinterpret_cast<const char*>(table.data()),
+        static_cast<std::streamsize>(table.size() * sizeof(std::int16_t)));
+
+    return static_cast<bool>(out);
+}
+
+
+/********************* LOAD ********************/
+
+bool JumpPointTable::load(const std::string& path, const World& world)
+{
+    std::ifstream in(path, std::ios::binary);
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::int32_t dims[2] = {};
+    std::uint64_t fileFingerprint = 0;
+    std::vector<std::int16_t> data;
+
+    if (!in)
+    {
+        return false;
+    }
+
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(dims), sizeof(dims));
+    in.read(reinterpret_cast<char*>(&fileFingerprint), sizeof(fileFingerprint));
+
+    if (!in || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 || version != FILE_VERSION ||
+        dims[0] != world.getWidth() || dims[1] != world.getHeight() ||
+        fileFingerprint != computeFingerprint(world))
+    {
+        return false;
+    }
+
+    data.resize(static_cast<size_t>(world.getCellCount()) * DIRECTION_COUNT);
+    in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(std::int16_t)));
+
+    if (!in)
+    {
+        return false;
+    }
+
+    width = dims[0];
+    height = dims[1];
+    fingerprint = fileFingerprint;
+    table.swap(data);
+    sourceWorldId = world.getInstanceId();
+    sourceObstacleVersion = world.getObstacleVersion();
+
+    return true;
+}
+
+
+/******************* MATCHES *******************/
+
+bool JumpPointTable::matches(const World& world) const
+{
+    if (table.empty() || width != world.getWidth() || height != world.getHeight())
+    {
+        return false;
+    }
+
+    // Weight edits keep the table valid: only blocking or freeing a cell matters
+    if (world.getInstanceId() == sourceWorldId && world.getObstacleVersion() == sourceObstacleVersion)
+    {
+        return true;
+    }
+
+    return computeFingerprint(world) == fingerprint;
+}
+
+
+/*********** HELPER FUNCTIONS ***********/
+
+// Split [0, count) into contiguous ranges and run them on separate threads
+static void runParallel(int count, unsigned int threadCount, const std::function<void(int, int)>& job)
+{
+    std::vector<std::thread> workers;
+    int chunks = static_cast<int>(std::min<unsigned int>(threadCount, static_cast<unsigned int>(std::max(count, 1))));
+    int i = 0;
+
+    if (chunks <= 1)
+    {
+        job(0, count);
+        return;
+    }
+
+    for (i = 0; i < chunks; ++i)
+    {
+        int begin = static_cast<int>(static_cast<long long>(count) * i / chunks);
+        int end = static_cast<int>(static_cast<long long>(count) * (i + 1) / chunks);
+
+        workers.emplace_back(job, begin, end);
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
@@ -0,0 +1,46 @@
+#include "lazy_binary_heap.h"
+#include <algorithm>
+
+/******************** CLEAR ********************/
+
+void LazyBinaryHeap::clear()
+{
+    entries.clear();
+}
+
+
+/******************** EMPTY ********************/
+
+bool LazyBinaryHeap::empty() const
+{
+    return entries.empty();
+}
+
+
+/******************** SIZE *********************/
+
+size_t LazyBinaryHeap::size() const
+{
+    return entries.size();
+}
+
+
+/******************** PUSH *********************/
+
+void LazyBinaryHeap::push(CellId id, double priority)
+{
+    entries.push_back({ priority, id });
+    std::push_heap(entries.begin(), entries.end(), Compare{});
+}
+
+
+/********************* POP *********************/
+
+CellId LazyBinaryHeap::pop()
+{
+    std::pop_heap(entries.begin(), entries.end(), Compare{});
+    CellId top = entries.back().second;
+    entries.pop_back();
+
+    return top;
+}
@@ -0,0 +1,145 @@
+#include "lpa_star.h"
+
+
+/***************** CONSTRUCTOR *****************/
+
+LPAStar::LPAStar(World& world, const Graph& graph)
+    : world(world), search(graph), planner(graph), isChanged(world.getCellCount(), 0)
+{
+    listenerId = world.addWeightListener([this](const State& cell) { onWeightChanged(cell); });
+}
+
+
+/****************** DESTRUCTOR *****************/
+
+LPAStar::~LPAStar()
+{
+    world.removeWeightListener(listenerId);
+}
+
+
+/********************* BIND ********************/
+
+bool LPAStar::bind(const State& newStart, const State& newGoal)
+{
+    for (const State& cell : changed)
+    {
+        isChanged[world.toCell(cell)] = 0;
+    }
+
+    changed.clear();
+    lastRepair = RepairStats();
+    repairCount = 0;
+    bound = search.initialize(newStart, newGoal);
+
+    if (bound)
+    {
+        start = newStart;
+        goal = newGoal;
+    }
+
+    return bound;
+}
+
+
+/******************** REPLAN *******************/
+
+PlanResults LPAStar::replan()
+{
+    PlanResults results{};
+
+    results.success = false;
+    results.totalCost = 0.0;
+
+    if (!bound)
+    {
+        return results;
+    }
+
+    lastRepair = RepairStats();
+    lastRepair.changedCells = static_cast<int>(changed.size());
+
+    search.updateCells(changed);
+
+    for (const State& cell : changed)
+    {
+        isChanged[world.toCell(cell)] = 0;
+    }
+
+    changed.clear();
+
+    results = search.replan();
+    lastRepair.nodesExpanded = results.nodesExpanded;
+    lastRepair.nodesUpdated = search.getLastUpdateCount();
+    lastRepair.executionTime = results.executionTime;
+
+    if (compareWithFresh)
+    {
+        PlanResults fresh = planner.plan(start, goal, SearchType::AStar);
+
+        lastRepair.freshExpanded = fresh.nodesExpanded;
+        lastRepair.freshTime = fresh.executionTime;
+        lastRepair.freshCost = fresh.totalCost;
+    }
+
+    repairCount++;
+
+    return results;
+}
+
+
+/************** GET PENDING CHANGES ************/
+
+size_t LPAStar::getPendingChanges() const
+{
+    return changed.size();
+}
+
+
+/************ SET COMPARE WITH FRESH ***********/
+
+void LPAStar::setCompareWithFresh(bool enabled)
+{
+    compareWithFresh = enabled;
+}
+
+
+/************ GET COMPARE WITH FRESH ***********/
+
+bool LPAStar::getCompareWithFresh() const
+{
+    return compareWithFresh;
+}
+
+
+/**************** GET LAST REPAIR **************/
+
+const RepairStats& LPAStar::getLastRepair() const
+{
+    return lastRepair;
+}
+
+
+/*************** GET REPAIR COUNT **************/
+
+int LPAStar::getRepairCount() const
+{
+    return repairCount;
+}
+
+
+/*************** ON WEIGHT CHANGED *************/
+
+void LPAStar::onWeightChanged(const State& cell)
+{
+    CellId id = world.toCell(cell);
+
+    // Changes before bind() are irrelevant: the first replan() searches from scratch
+    if (!bound || isChanged[id])
+    {
+        return;
+    }
+
+    isChanged[id] = 1;
+    changed.push_back(cell);
+}
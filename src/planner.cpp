@@ -1,132 +1,597 @@
 #include "planner.h"
 #include "graph.h"
+#include "jump_point_search.h"
 #include <unordered_set>
 #include <unordered_map>
-#include <queue>
 #include <algorithm>
 #include <cmath>
 #include <chrono>   
+#include <atomic>
+#include <thread>
+#include <utility>
+
+
+// Static helper function declarations
+static double percentile(const std::vector<double>& sorted, double fraction);
+static void buildGoalField(const World& world, const std::vector<CellId>& goalCells, std::vector<double>& field);
+
+
+namespace
+{
+    /**
+     * @class HashedSearchStore
+     * @brief Per-node search state kept in hash-based containers (SearchEngine::Hashed).
+     *
+     * Exposes the same interface as SearchWorkspace so both can drive the same
+     * search implementation. Nodes are keyed by State, as in the original planner.
+     * The containers allocate from the given resource (the query's arena).
+     */
+    class HashedSearchStore
+    {
+    private:
+        const World& world;
+        std::pmr::unordered_map<State, double> g_cost;
+        std::pmr::unordered_map<State, State> parents;
+        std::pmr::unordered_set<State> closed;
+
+    public:
+        HashedSearchStore(const World& world, std::pmr::memory_resource* resource)
+            : world(world), g_cost(resource), parents(resource), closed(resource) {}
+
+        bool isSeen(CellId id) const
+        {
+            return g_cost.find(world.toState(id)) != g_cost.end();
+        }
+
+        double getCost(CellId id) const
+        {
+            auto it = g_cost.find(world.toState(id));
+            return (it != g_cost.end()) ? it->second : SearchWorkspace::INF;
+        }
+
+        CellId getParent(CellId id) const
+        {
+            auto it = parents.find(world.toState(id));
+            return (it != parents.end()) ? world.toCell(it->second) : SearchWorkspace::NO_PARENT;
+        }
+
+        void update(CellId id, double g, CellId parent)
+        {
+            State s = world.toState(id);
+            g_cost[s] = g;
+            parents[s] = world.toState(parent);
+        }
+
+        bool isClosed(CellId id) const
+        {
+            return closed.find(world.toState(id)) != closed.end();
+        }
+
+        void close(CellId id)
+        {
+            closed.insert(world.toState(id));
+        }
+    };
+
+    /**
+     * @class SingleGoal
+     * @brief Goal of a point-to-point search, with the Chebyshev distance as heuristic.
+     */
+    class SingleGoal
+    {
+    private:
+        const World& world;
+        State state;
+        CellId cell;
+
+    public:
+        SingleGoal(const World& world, const State& goal) : world(world), state(goal), cell(world.toCell(goal)) {}
+
+        int find(CellId id) const
+        {
+            return (id == cell) ? 0 : -1;
+        }
+
+        double estimate(CellId id) const
+        {
+            return Graph::chebyshevDistance(world.toState(id), state);
+        }
+    };
+
+    /**
+     * @class GoalSet
+     * @brief Goals of a nearest-goal search, with the Chebyshev distance to the closest goal.
+     *
+     * Goal cells are looked up in the context's per-cell goal indices. The heuristic is
+     * the minimum over all goals, or a lookup in a precomputed distance field that holds
+     * the same minimum for every cell.
+     */
+    class GoalSet
+    {
+    private:
+        const World& world;
+        const std::pmr::vector<State>& goals;
+        const std::vector<int>& goalIndex;
+        const std::vector<double>* field;
+
+    public:
+        GoalSet(const World& world, const std::pmr::vector<State>& goals, const std::vector<int>& goalIndex,
+            const std::vector<double>* field)
+            : world(world), goals(goals), goalIndex(goalIndex), field(field) {}
+
+        int find(CellId id) const
+        {
+            return goalIndex[id];
+        }
+
+        double estimate(CellId id) const
+        {
+            State s = world.toState(id);
+            double nearest = SearchWorkspace::INF;
+
+            if (field != nullptr)
+            {
+                return (*field)[id];
+            }
+
+            for (const State& goal : goals)
+            {
+                nearest = std::min(nearest, Graph::chebyshevDistance(s, goal));
+            }
+
+            return nearest;
+        }
+    };
+
+    /**
+     * @struct ExactCost
+     * @brief Cost model of the double-precision search: costs are used as they are.
+     */
+    struct ExactCost
+    {
+        static constexpr bool FIXED_POINT = false;
+
+        static double edge(double cost)
+        {
+            return cost;
+        }
+
+        static double scale(double h)
+        {
+            return h;
+        }
+    };
+
+    /**
+     * @struct FixedPointCost
+     * @brief Cost model of the fixed-point search: costs are quantized to integers.
+     *
+     * The Chebyshev heuristic is integral, so scaling it keeps it exact.
+     */
+    struct FixedPointCost
+    {
+        static constexpr bool FIXED_POINT = true;
+
+        static double edge(double cost)
+        {
+            return Graph::toFixedCost(cost);
+        }
+
+        static double scale(double h)
+        {
+            return h * Graph::FIXED_POINT_SCALE;
+        }
+    };
+}
 
 
 /***************** CONSTRUCTOR *****************/
 
-Planner::Planner(const Graph& graph) : graph(graph) {}
+Planner::Planner(const Graph& graph, SearchEngine engine)
+    : graph(graph), engine(engine), openList(OpenListType::BinaryHeap),
+    bidirectionalMode(BidirectionalMode::Sequential), bfsMode(BFSMode::Queue), bfsThreads(0), jumpTable(nullptr), batchThreads(0),
+    goalFieldThreshold(64), batchScheduler(BatchScheduler::SharedQueue)
+{}
+
+
+/****************** SET ENGINE *****************/
+
+void Planner::setEngine(SearchEngine engine)
+{
+    this->engine = engine;
+}
+
+
+/****************** GET ENGINE *****************/
+
+SearchEngine Planner::getEngine() const
+{
+    return engine;
+}
+
+
+/**************** SET OPEN LIST ****************/
+
+void Planner::setOpenList(OpenListType openList)
+{
+    this->openList = openList;
+}
+
+
+/**************** GET OPEN LIST ****************/
+
+OpenListType Planner::getOpenList() const
+{
+    return openList;
+}
+
+
+/*********** SET BIDIRECTIONAL MODE ************/
+
+void Planner::setBidirectionalMode(BidirectionalMode mode)
+{
+    bidirectionalMode = mode;
+}
+
+
+/*********** GET BIDIRECTIONAL MODE ************/
+
+BidirectionalMode Planner::getBidirectionalMode() const
+{
+    return bidirectionalMode;
+}
+
+
+/***************** SET BFS MODE ****************/
+
+void Planner::setBFSMode(BFSMode mode)
+{
+    bfsMode = mode;
+}
+
+
+/***************** GET BFS MODE ****************/
+
+BFSMode Planner::getBFSMode() const
+{
+    return bfsMode;
+}
+
+
+/*************** SET BFS THREADS ***************/
+
+void Planner::setBFSThreads(unsigned int threadCount)
+{
+    std::lock_guard<std::mutex> lock(parallelBfsMutex);
+
+    bfsThreads = threadCount;
+    parallelBfs.reset();
+}
+
+
+/*********** SET GOAL FIELD THRESHOLD **********/
+
+void Planner::setGoalFieldThreshold(size_t goalCount)
+{
+    goalFieldThreshold = goalCount;
+}
+
+
+/************ SET JUMP POINT TABLE *************/
+
+void Planner::setJumpPointTable(const JumpPointTable* table)
+{
+    jumpTable = table;
+}
+
+
+/************** SET BATCH THREADS **************/
+
+void Planner::setBatchThreads(unsigned int threadCount)
+{
+    batchThreads = threadCount;
+}
+
+
+/************* SET BATCH SCHEDULER *************/
+
+void Planner::setBatchScheduler(BatchScheduler scheduler)
+{
+    batchScheduler = scheduler;
+}
+
+
+/************* GET BATCH SCHEDULER *************/
+
+BatchScheduler Planner::getBatchScheduler() const
+{
+    return batchScheduler;
+}
+
+
+/************* SET MEMORY RESOURCE *************/
+
+void Planner::setMemoryResource(std::pmr::memory_resource* resource)
+{
+    context.arena.setUpstream(resource);
+}
 
 
 /****************** HEURISTIC ******************/
 
 double Planner::heuristic(const State& a, const State& b) const
 {
-    double dx = std::abs(a.x - b.x);
-    double dy = std::abs(a.y - b.y);
-
-    return std::max(dx, dy); // Chebyshev distance
+    return Graph::chebyshevDistance(a, b);
 }
 
 
 /******************* RUN BFS *******************/
 
-PlanResults Planner::runBFS(const State& start, const State& goal) const
+PlanResults Planner::runBFS(const State& start, const State& goal, PlannerContext& context) const
+{
+    if (bfsMode == BFSMode::BitParallel)
+    {
+        int reachedCells = 0;
+        int length = context.bitBfs.search(*graph.getWorld(), start, goal, context.path, reachedCells);
+
+        if (length < 0)
+        {
+            return { {}, false, 0.0, 0.0, reachedCells };
+        }
+
+        return { {}, true, static_cast<double>(length), 0.0, reachedCells };
+    }
+
+    if (bfsMode == BFSMode::DirectionOptimizing)
+    {
+        std::lock_guard<std::mutex> lock(parallelBfsMutex);
+        PlanResults result{ {}, false, 0.0, 0.0, 0 };
+        int length = 0;
+
+        if (!parallelBfs)
+        {
+            parallelBfs = std::make_unique<DirectionOptimizingBFS>(graph, bfsThreads);
+        }
+
+        length = parallelBfs->search(start, goal, context.path, result.nodesExpanded, result.bfsLayers);
+        result.success = (length >= 0);
+        result.totalCost = result.success ? static_cast<double>(length) : 0.0;
+
+        return result;
+    }
+
+    if (engine == SearchEngine::Hashed)
+    {
+        HashedSearchStore store(*graph.getWorld(), &context.arena);
+        return searchBFS(start, goal, store, context.frontier, context.path);
+    }
+
+    context.workspace.prepare(graph.getWorld()->getCellCount());
+    return searchBFS(start, goal, context.workspace, context.frontier, context.path);
+}
+
+
+/****************** SEARCH BFS *****************/
+
+template <typename Store>
+PlanResults Planner::searchBFS(const State& start, const State& goal, Store& store, std::vector<CellId>& frontier,
+    std::vector<State>& path) const
 {
-    std::unordered_set<State> visited;
-    std::unordered_map<State, State> parents;
-    std::queue<State> neighbors;
-    State current = { 0,0 };
+    const World& world = *graph.getWorld();
+    size_t head = 0;
+    CellId current = 0;
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
     double totalCost = 0.0;
     int nodesExpanded = 0;
 
     if (start == goal)
     {
-        return { {start}, true, 0.0, 0.0, 1 };
+        path.assign(1, start);
+        return { {}, true, 0.0, 0.0, 1 };
     }
 
-    neighbors.push(start);
-    visited.insert(start);
+    // FIFO queue: cells are appended to the frontier and consumed from 'head'
+    frontier.clear();
+    frontier.push_back(startCell);
+    store.update(startCell, 0.0, startCell);
 
-    while (!neighbors.empty())
+    while (head < frontier.size())
     {
-        current = neighbors.front();
-        neighbors.pop();
+        current = frontier[head++];
         nodesExpanded++;
 
-        if (current == goal)
+        if (current == goalCell)
         {
             break;
         }
 
-        for (const auto& neighbor : graph.getNeighbors(current))
+        graph.forEachNeighbor(current, [&](CellId next, double)
         {
-            if (visited.find(neighbor) == visited.end())
+            if (!store.isSeen(next))
             {
-                parents[neighbor] = current;
-                neighbors.push(neighbor);
-                visited.insert(neighbor);
+                store.update(next, store.getCost(current) + 1.0, current);
+                frontier.push_back(next);
             }
-        }
+        });
     }
 
-    if (parents.find(goal) == parents.end())
+    if (!store.isSeen(goalCell))
     {
         return { {}, false, 0.0, 0.0, nodesExpanded };
     }
 
-    auto path = reconstructPath(start, goal, parents);
+    reconstructPath(start, goal, store, path);
     totalCost = static_cast<double>(path.size() - 1);
 
-    return { path, true, totalCost, 0.0, nodesExpanded };
+    return { {}, true, totalCost, 0.0, nodesExpanded };
 }
 
 
 /************** RUN WEIGHT SEARCH **************/
 
-PlanResults Planner::runWeightedSearch(const State& start, const State& goal, SearchType type) const
+PlanResults Planner::runWeightedSearch(const State& start, const State& goal, SearchType type, PlannerContext& context) const
+{
+    SingleGoal target(*graph.getWorld(), goal);
+
+    if (engine == SearchEngine::Hashed)
+    {
+        HashedSearchStore store(*graph.getWorld(), &context.arena);
+        return runWithOpenList(start, target, type, store, context);
+    }
+
+    context.workspace.prepare(graph.getWorld()->getCellCount());
+    return runWithOpenList(start, target, type, context.workspace, context);
+}
+
+
+/************* RUN NEAREST SEARCH **************/
+
+PlanResults Planner::runNearestSearch(const State& start, const std::vector<State>& goals, SearchType type,
+    PlannerContext& context) const
+{
+    const World& world = *graph.getWorld();
+    const std::vector<double>* field = nullptr;
+    std::pmr::vector<State> scanned(&context.arena);
+    size_t i = 0;
+
+    // Only the cells of the previous query's goals need resetting
+    for (CellId cell : context.goalCells)
+    {
+        context.goalIndex[cell] = -1;
+    }
+
+    context.goalIndex.resize(world.getCellCount(), -1);
+    context.goalCells.clear();
+
+    for (i = 0; i < goals.size(); ++i)
+    {
+        CellId cell = world.findCell(goals[i]);
+
+        // Duplicates keep the index of their first occurrence
+        if (cell != World::INVALID_CELL && world.isFree(cell) && context.goalIndex[cell] < 0)
+        {
+            context.goalIndex[cell] = static_cast<int>(i);
+            context.goalCells.push_back(cell);
+            scanned.push_back(goals[i]);
+        }
+    }
+
+    if (context.goalCells.empty())
+    {
+        return { {}, false, 0.0, 0.0, 0 };
+    }
+
+    if (type == SearchType::AStar && context.goalCells.size() > goalFieldThreshold)
+    {
+        buildGoalField(world, context.goalCells, context.goalField);
+        field = &context.goalField;
+    }
+
+    GoalSet target(world, scanned, context.goalIndex, field);
+
+    if (engine == SearchEngine::Hashed)
+    {
+        HashedSearchStore store(world, &context.arena);
+        return runWithOpenList(start, target, type, store, context);
+    }
+
+    context.workspace.prepare(world.getCellCount());
+    return runWithOpenList(start, target, type, context.workspace, context);
+}
+
+
+/************** RUN WITH OPEN LIST *************/
+
+template <typename Goal, typename Store>
+PlanResults Planner::runWithOpenList(const State& start, const Goal& goal, SearchType type, Store& store,
+    PlannerContext& context) const
 {
-    using PQElement = std::pair<double, State>;
-    std::priority_queue<PQElement, std::vector<PQElement>, PQCompare> pq;
+    if (openList == OpenListType::IndexedHeap)
+    {
+        context.indexedOpen.reserve(graph.getWorld()->getCellCount());
+        return searchWeighted<ExactCost>(start, goal, type, store, context.indexedOpen, context.limits, context.path);
+    }
+
+    if (openList == OpenListType::RadixHeap)
+    {
+        context.radixOpen.clear();
+        return searchWeighted<FixedPointCost>(start, goal, type, store, context.radixOpen, context.limits, context.path);
+    }
+
+    context.binaryOpen.clear();
+    return searchWeighted<ExactCost>(start, goal, type, store, context.binaryOpen, context.limits, context.path);
+}
+
 
-    std::unordered_map<State, double> g_cost;
-    std::unordered_map<State, State> parents;
-    std::unordered_set<State> closed;
+/*************** SEARCH WEIGHTED ***************/
+
+template <typename CostModel, typename Goal, typename Store, typename OpenList>
+PlanResults Planner::searchWeighted(const State& start, const Goal& goal, SearchType type, Store& store, OpenList& open,
+    const SearchLimits& limits, std::vector<State>& path) const
+{
+    const World& world = *graph.getWorld();
+    CellId startCell = world.toCell(start);
+    CellId goalCell = World::INVALID_CELL;
+    CellId endCell = World::INVALID_CELL;
+    int startGoal = goal.find(startCell);
+    SearchBudget budget(limits);
 
     PlanResults result;
 
+    // Expanded node closest to the goal, where a truncated search's partial path ends
+    CellId closestCell = startCell;
+    double closestEstimate = budget.isLimited() ? goal.estimate(startCell) : 0.0;
+
     double new_cost = 0.0;
     double new_priority = 0.0;
     int nodesExpanded = 0;
+    int stalePops = 0;
+    size_t peakOpenSize = 0;
 
     // correctness verification variables 
     double lastExtractedCost = -1.0;
     bool monotonic = true;
     bool heuristicConsistent = true;
 
-    if (start == goal)
+    if (startGoal >= 0)
     {
-        result.path = { start };
+        path.assign(1, start);
         result.success = true;
         result.totalCost = 0.0;
         result.nodesExpanded = 1;
+        result.reachedGoal = startGoal;
         return result;
     }
 
-    g_cost[start] = 0.0;
-    parents[start] = start;
-    pq.push({ 0.0, start });
+    store.update(startCell, 0.0, startCell);
+    open.push(startCell, 0.0);
 
-    while (!pq.empty())
+    while (!open.empty())
     {
-        auto [priority, current] = pq.top();
-        pq.pop();
+        peakOpenSize = std::max(peakOpenSize, open.size());
+
+        CellId currentCell = open.pop();
 
         // Skip if already processed
-        if (closed.find(current) != closed.end())
+        if (store.isClosed(currentCell))
         {
+            stalePops++;
             continue;
         }
 
-        closed.insert(current);
+        result.stopReason = budget.check(nodesExpanded);
+
+        if (result.stopReason != SearchStop::Completed)
+        {
+            result.truncated = true;
+            break;
+        }
+
+        store.close(currentCell);
         nodesExpanded++;
 
-        double currentCost = g_cost[current];
+        double currentCost = store.getCost(currentCell);
 
         // Monotonic extraction check 
         if (lastExtractedCost > currentCost)
@@ -135,21 +600,34 @@ PlanResults Planner::runWeightedSearch(const State& start, const State& goal, Se
         }
         lastExtractedCost = currentCost;
 
-        if (current == goal)
+        // The first goal settled is the nearest one
+        result.reachedGoal = goal.find(currentCell);
+
+        if (result.reachedGoal >= 0)
         {
+            goalCell = currentCell;
             break;
         }
 
-        for (const auto& neighbor : graph.getNeighbors(current))
+        double estimate = (type == SearchType::AStar || budget.isLimited()) ? goal.estimate(currentCell) : 0.0;
+        double hCurrent = (type == SearchType::AStar) ? CostModel::scale(estimate) : 0.0;
+
+        if (budget.isLimited() && estimate < closestEstimate)
+        {
+            closestEstimate = estimate;
+            closestCell = currentCell;
+        }
+
+        graph.forEachNeighbor(currentCell, [&](CellId neighborCell, double edgeCost)
         {
-            new_cost = g_cost[current] + graph.getCost(current, neighbor);
+            double hNeighbor = 0.0;
+            edgeCost = CostModel::edge(edgeCost);
+            new_cost = currentCost + edgeCost;
 
             // A* consistency check 
             if (type == SearchType::AStar)
             {
-                double hCurrent = heuristic(current, goal);
-                double hNeighbor = heuristic(neighbor, goal);
-                double edgeCost = graph.getCost(current, neighbor);
+                hNeighbor = CostModel::scale(goal.estimate(neighborCell));
 
                 if (hCurrent > edgeCost + hNeighbor)
                 {
@@ -157,29 +635,35 @@ PlanResults Planner::runWeightedSearch(const State& start, const State& goal, Se
                 }
             }
 
-            if (g_cost.find(neighbor) == g_cost.end() || new_cost < g_cost[neighbor])
+            if (new_cost < store.getCost(neighborCell))
             {
-                g_cost[neighbor] = new_cost;
-                parents[neighbor] = current;
-
-                new_priority = new_cost;
+                store.update(neighborCell, new_cost, currentCell);
 
-                if (type == SearchType::AStar)
-                {
-                    new_priority += heuristic(neighbor, goal);
-                }
-
-                pq.push({ new_priority, neighbor });
+                new_priority = new_cost + hNeighbor;
+                open.push(neighborCell, new_priority);
             }
-        }
+        });
     }
 
-    // Build result 
-    if (parents.find(goal) != parents.end())
+    // Build result: the path to the goal, or the partial path of a truncated search
+    endCell = result.truncated ? closestCell : goalCell;
+
+    if (endCell != World::INVALID_CELL)
     {
-        result.path = reconstructPath(start, goal, parents);
-        result.totalCost = g_cost[goal];
-        result.success = true;
+        reconstructPath(start, world.toState(endCell), store, path);
+        result.totalCost = store.getCost(endCell);
+        result.success = !result.truncated;
+
+        // Report the exact cost of the path found on quantized costs
+        if (CostModel::FIXED_POINT)
+        {
+            result.totalCost = 0.0;
+
+            for (size_t i = 1; i < path.size(); ++i)
+            {
+                result.totalCost += graph.getCost(path[i - 1], path[i]);
+            }
+        }
     }
     else
     {
@@ -187,6 +671,8 @@ PlanResults Planner::runWeightedSearch(const State& start, const State& goal, Se
     }
 
     result.nodesExpanded = nodesExpanded;
+    result.stalePops = stalePops;
+    result.peakOpenSize = static_cast<int>(peakOpenSize);
 
     // correctness flags
     result.monotonicityVerified = monotonic;
@@ -207,53 +693,548 @@ PlanResults Planner::runWeightedSearch(const State& start, const State& goal, Se
 
 /**************** RUN DIJKSTRA *****************/
 
-PlanResults Planner::runDijkstra(const State& start, const State& goal) const
+PlanResults Planner::runDijkstra(const State& start, const State& goal, PlannerContext& context) const
 {
-    return runWeightedSearch(start, goal, SearchType::Dijkstra);
+    return runWeightedSearch(start, goal, SearchType::Dijkstra, context);
 }
 
 
 /******************* RUN A* ********************/
 
-PlanResults Planner::runAStar(const State& start, const State& goal) const
+PlanResults Planner::runAStar(const State& start, const State& goal, PlannerContext& context) const
 {
-    return runWeightedSearch(start, goal, SearchType::AStar);
+    return runWeightedSearch(start, goal, SearchType::AStar, context);
 }
 
 
-/************** RECONSTRUCT PATH ***************/
+/************** RUN BIDIRECTIONAL **************/
 
-std::vector<State> Planner::reconstructPath(const State& start, const State& goal,
-    const std::unordered_map<State, State>& parents) const
+PlanResults Planner::runBidirectional(const State& start, const State& goal, SearchType type, PlannerContext& context) const
 {
-    std::vector<State> path;
-    State current = goal;
+    const World& world = *graph.getWorld();
+    const bool useHeuristic = (type == SearchType::BidirectionalAStar);
+    const double hStartGoal = useHeuristic ? heuristic(start, goal) : 0.0;
+
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
+    CellId meet = World::INVALID_CELL;
+    double mu = SearchWorkspace::INF;
+
+    PlanResults result;
+    int nodesExpanded = 0;
+    size_t peakOpenSize = 0;
+
+    // correctness verification variables
+    double lastForwardKey = -SearchWorkspace::INF;
+    double lastBackwardKey = -SearchWorkspace::INF;
+    bool monotonic = true;
+    bool heuristicConsistent = true;
 
-    if (parents.find(goal) == parents.end())
+    // Averaged potentials (zero for Dijkstra)
+    auto forwardPotential = [&](CellId cell)
+    {
+        State s = world.toState(cell);
+        return useHeuristic ? (heuristic(s, goal) - heuristic(s, start) + hStartGoal) / 2.0 : 0.0;
+    };
+    auto backwardPotential = [&](CellId cell)
+    {
+        return hStartGoal - forwardPotential(cell);
+    };
+
+    if (start == goal)
     {
-        return {};
+        context.path.assign(1, start);
+        return { {}, true, 0.0, 0.0, 1 };
     }
 
-    while (current != start)
+    if (bidirectionalMode == BidirectionalMode::Parallel && !context.batchWorker)
     {
-        path.push_back(current);
-        current = parents.at(current);
+        return runParallelBidirectional(start, goal, type, context);
     }
 
-    path.push_back(start);
-    std::reverse(path.begin(), path.end());
+    context.workspace.prepare(world.getCellCount());
+    context.backwardWorkspace.prepare(world.getCellCount());
+    context.indexedOpen.reserve(world.getCellCount());
+    context.backwardOpen.reserve(world.getCellCount());
 
-    return path;
-}
+    context.workspace.update(startCell, 0.0, startCell);
+    context.indexedOpen.push(startCell, forwardPotential(startCell));
+    context.backwardWorkspace.update(goalCell, 0.0, goalCell);
+    context.backwardOpen.push(goalCell, backwardPotential(goalCell));
 
+    while (!context.indexedOpen.empty() && !context.backwardOpen.empty())
+    {
+        double topForward = context.indexedOpen.topPriority();
+        double topBackward = context.backwardOpen.topPriority();
+        bool expandForward = (topForward <= topBackward);
 
-/******************** PLAN ********************/
+        peakOpenSize = std::max(peakOpenSize, context.indexedOpen.size() + context.backwardOpen.size());
 
-PlanResults Planner::plan(const State& start, const State& goal, SearchType type) const
-{
-    if (!graph.isValid(start) || !graph.isValid(goal))
-    {
-        return { {}, false, 0.0, 0.0 };
+        // Stopping criterion: no path through unsettled cells can beat mu
+        if (topForward + topBackward >= mu + hStartGoal)
+        {
+            break;
+        }
+
+        SearchWorkspace& side = expandForward ? context.workspace : context.backwardWorkspace;
+        SearchWorkspace& other = expandForward ? context.backwardWorkspace : context.workspace;
+        IndexedHeap& open = expandForward ? context.indexedOpen : context.backwardOpen;
+        double& lastKey = expandForward ? lastForwardKey : lastBackwardKey;
+
+        CellId current = open.pop();
+        double currentCost = side.getCost(current);
+        double pCurrent = expandForward ? forwardPotential(current) : backwardPotential(current);
+
+        side.close(current);
+        nodesExpanded++;
+
+        // Monotonic extraction check (per direction, on reduced keys)
+        if (lastKey > currentCost + pCurrent)
+        {
+            monotonic = false;
+        }
+        lastKey = currentCost + pCurrent;
+
+        auto relax = [&](CellId next, double edgeCost)
+        {
+            double newCost = currentCost + edgeCost;
+            double pNext = expandForward ? forwardPotential(next) : backwardPotential(next);
+
+            if (pCurrent > edgeCost + pNext)
+            {
+                heuristicConsistent = false;
+            }
+
+            if (newCost < side.getCost(next))
+            {
+                side.update(next, newCost, current);
+                open.push(next, newCost + pNext);
+
+                // Meeting check against everything the opposite side has reached
+                if (other.isSeen(next) && newCost + other.getCost(next) < mu)
+                {
+                    mu = newCost + other.getCost(next);
+                    meet = next;
+                }
+            }
+        };
+
+        if (expandForward)
+        {
+            graph.forEachNeighbor(current, relax);
+        }
+        else
+        {
+            graph.forEachPredecessor(current, relax);
+        }
+    }
+
+    result.nodesExpanded = nodesExpanded;
+    result.peakOpenSize = static_cast<int>(peakOpenSize);
+    result.executionTime = 0.0;
+    result.monotonicityVerified = monotonic;
+    result.heuristicConsistent = heuristicConsistent;
+
+    if (meet == World::INVALID_CELL)
+    {
+        result.success = false;
+        result.totalCost = 0.0;
+        result.optimalGoalExtraction = false;
+        return result;
+    }
+
+    reconstructPath(start, meet, meet, goal, context.workspace, context.backwardWorkspace, context.path);
+    result.totalCost = mu;
+    result.success = true;
+    result.optimalGoalExtraction = monotonic && heuristicConsistent;
+
+    return result;
+}
+
+
+/********** RUN PARALLEL BIDIRECTIONAL *********/
+
+PlanResults Planner::runParallelBidirectional(const State& start, const State& goal, SearchType type, PlannerContext& context) const
+{
+    /**
+     * @struct SideResult
+     * @brief What one direction found; read by the calling thread after both have finished.
+     */
+    struct SideResult
+    {
+        double bestMeeting = SearchWorkspace::INF;  // Best path cost through an edge this side detected
+        CellId meetForward = World::INVALID_CELL;   // Forward end of that edge
+        CellId meetBackward = World::INVALID_CELL;  // Backward end of that edge
+        int nodesExpanded = 0;
+        size_t peakOpenSize = 0;
+        bool monotonic = true;
+        bool heuristicConsistent = true;
+    };
+
+    const World& world = *graph.getWorld();
+    const bool useHeuristic = (type == SearchType::BidirectionalAStar);
+    const double hStartGoal = useHeuristic ? heuristic(start, goal) : 0.0;
+
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
+
+    // Shared between the two threads
+    std::atomic<double> mu(SearchWorkspace::INF);
+    std::atomic<double> topKey[2] = { {0.0}, {0.0} };
+    std::atomic<bool> done(false);
+
+    SideResult sides[2];
+    PlanResults result;
+
+    // Averaged potentials (zero for Dijkstra)
+    auto forwardPotential = [&](CellId cell)
+    {
+        State s = world.toState(cell);
+        return useHeuristic ? (heuristic(s, goal) - heuristic(s, start) + hStartGoal) / 2.0 : 0.0;
+    };
+
+    auto offerMeeting = [&](SideResult& side, double cost, CellId forwardCell, CellId backwardCell)
+    {
+        double best = mu.load();
+
+        if (cost < side.bestMeeting)
+        {
+            side.bestMeeting = cost;
+            side.meetForward = forwardCell;
+            side.meetBackward = backwardCell;
+        }
+
+        while (cost < best && !mu.compare_exchange_weak(best, cost)) {}
+    };
+
+    // One direction of the search (0 = forward, 1 = backward)
+    auto searchSide = [&](int index)
+    {
+        const bool forward = (index == 0);
+        SearchWorkspace& ws = forward ? context.workspace : context.backwardWorkspace;
+        IndexedHeap& open = forward ? context.indexedOpen : context.backwardOpen;
+        ConcurrentClosedSet& ownClosed = forward ? context.forwardClosed : context.backwardClosed;
+        const ConcurrentClosedSet& otherClosed = forward ? context.backwardClosed : context.forwardClosed;
+        CellId source = forward ? startCell : goalCell;
+        CellId target = forward ? goalCell : startCell;
+        SideResult& side = sides[index];
+        double lastKey = -SearchWorkspace::INF;
+
+        auto potential = [&](CellId cell)
+        {
+            return forward ? forwardPotential(cell) : hStartGoal - forwardPotential(cell);
+        };
+
+        ws.update(source, 0.0, source);
+        open.push(source, potential(source));
+
+        while (!open.empty() && !done.load(std::memory_order_relaxed))
+        {
+            double top = open.topPriority();
+
+            side.peakOpenSize = std::max(side.peakOpenSize, open.size());
+
+            // Everything with a smaller key is closed; publish it for the other side's stopping test
+            topKey[index].store(top, std::memory_order_release);
+
+            if (top + topKey[1 - index].load(std::memory_order_acquire) >= mu.load() + hStartGoal)
+            {
+                break;
+            }
+
+            CellId current = open.pop();
+            double currentCost = ws.getCost(current);
+            double pCurrent = potential(current);
+
+            ws.close(current);
+            ownClosed.close(current, currentCost);
+            side.nodesExpanded++;
+
+            if (lastKey > top)
+            {
+                side.monotonic = false;
+            }
+            lastKey = top;
+
+            // This side alone found the whole path
+            if (current == target)
+            {
+                offerMeeting(side, currentCost, current, current);
+                break;
+            }
+
+            auto relax = [&](CellId next, double edgeCost)
+            {
+                double newCost = currentCost + edgeCost;
+                double pNext = potential(next);
+                double otherCost = 0.0;
+
+                if (pCurrent > edgeCost + pNext)
+                {
+                    side.heuristicConsistent = false;
+                }
+
+                // Meeting detection against the opposite side's closed set
+                if (otherClosed.tryGetCost(next, otherCost))
+                {
+                    offerMeeting(side, newCost + otherCost, forward ? current : next, forward ? next : current);
+                }
+
+                if (!ws.isClosed(next) && newCost < ws.getCost(next))
+                {
+                    ws.update(next, newCost, current);
+                    open.push(next, newCost + pNext);
+                }
+            };
+
+            if (forward)
+            {
+                graph.forEachNeighbor(current, relax);
+            }
+            else
+            {
+                graph.forEachPredecessor(current, relax);
+            }
+        }
+
+        // Either side finishing decides the result: the stopping rule proved mu optimal,
+        // or an exhausted open list proved the other end unreachable
+        topKey[index].store(SearchWorkspace::INF, std::memory_order_release);
+        done.store(true, std::memory_order_relaxed);
+    };
+
+    context.workspace.prepare(world.getCellCount());
+    context.backwardWorkspace.prepare(world.getCellCount());
+    context.indexedOpen.reserve(world.getCellCount());
+    context.backwardOpen.reserve(world.getCellCount());
+    context.forwardClosed.prepare(world.getCellCount());
+    context.backwardClosed.prepare(world.getCellCount());
+
+    context.backwardHelper.run([&searchSide] { searchSide(1); });
+    searchSide(0);
+    context.backwardHelper.wait();
+
+    const SideResult& best = (sides[0].bestMeeting <= sides[1].bestMeeting) ? sides[0] : sides[1];
+
+    result.nodesExpanded = sides[0].nodesExpanded + sides[1].nodesExpanded;
+    result.peakOpenSize = static_cast<int>(sides[0].peakOpenSize + sides[1].peakOpenSize);
+    result.executionTime = 0.0;
+    result.monotonicityVerified = sides[0].monotonic && sides[1].monotonic;
+    result.heuristicConsistent = sides[0].heuristicConsistent && sides[1].heuristicConsistent;
+
+    if (best.meetForward == World::INVALID_CELL)
+    {
+        result.success = false;
+        result.totalCost = 0.0;
+        result.optimalGoalExtraction = false;
+        return result;
+    }
+
+    reconstructPath(start, best.meetForward, best.meetBackward, goal, context.workspace, context.backwardWorkspace,
+        context.path);
+    result.totalCost = best.bestMeeting;
+    result.success = true;
+    result.optimalGoalExtraction = result.monotonicityVerified && result.heuristicConsistent;
+
+    return result;
+}
+
+
+/******************* RUN JPS ******************/
+
+PlanResults Planner::runJPS(const State& start, const State& goal, PlannerContext& context) const
+{
+    JumpPointSearch jps(*graph.getWorld());
+
+    return jps.search(start, goal, context.workspace, context.indexedOpen, context.path);
+}
+
+
+/**************** RUN JPS PLUS ****************/
+
+PlanResults Planner::runJPSPlus(const State& start, const State& goal, PlannerContext& context) const
+{
+    JumpPointSearch jps(*graph.getWorld());
+
+    if (jumpTable == nullptr || !jumpTable->matches(*graph.getWorld()))
+    {
+        return jps.search(start, goal, context.workspace, context.indexedOpen, context.path);
+    }
+
+    return jps.searchPlus(start, goal, *jumpTable, context.workspace, context.indexedOpen, context.path);
+}
+
+
+/************** RECONSTRUCT PATH ***************/
+
+template <typename Store>
+void Planner::reconstructPath(const State& start, const State& goal, const Store& store, std::vector<State>& path) const
+{
+    const World& world = *graph.getWorld();
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
+    CellId current = goalCell;
+    size_t length = 1;
+
+    path.clear();
+
+    if (!store.isSeen(current))
+    {
+        return;
+    }
+
+    // Count first, so the path is sized once and filled back to front
+    for (current = goalCell; current != startCell; current = store.getParent(current))
+    {
+        length++;
+    }
+
+    path.resize(length);
+
+    for (current = goalCell; current != startCell; current = store.getParent(current))
+    {
+        path[--length] = world.toState(current);
+    }
+    path[0] = start;
+}
+
+
+/********* RECONSTRUCT STITCHED PATH **********/
+
+void Planner::reconstructPath(const State& start, CellId meetForward, CellId meetBackward, const State& goal,
+    const SearchWorkspace& forward, const SearchWorkspace& backward, std::vector<State>& path) const
+{
+    const World& world = *graph.getWorld();
+    CellId startCell = world.toCell(start);
+    CellId goalCell = world.toCell(goal);
+    CellId current = World::INVALID_CELL;
+    size_t forwardLength = 1;
+    size_t backwardLength = 0;
+
+    for (current = meetForward; current != startCell; current = forward.getParent(current))
+    {
+        forwardLength++;
+    }
+    for (current = meetBackward; current != goalCell; current = backward.getParent(current))
+    {
+        backwardLength++;
+    }
+
+    path.clear();
+    path.reserve(forwardLength + (meetBackward != meetForward ? 1 : 0) + backwardLength);
+    path.resize(forwardLength);
+
+    // Forward half, filled back to front
+    for (current = meetForward; current != startCell; current = forward.getParent(current))
+    {
+        path[--forwardLength] = world.toState(current);
+    }
+    path[0] = start;
+
+    // Backward half, following the backward parents towards the goal
+    if (meetBackward != meetForward)
+    {
+        path.push_back(world.toState(meetBackward));
+    }
+
+    for (current = meetBackward; current != goalCell; )
+    {
+        current = backward.getParent(current);
+        path.push_back(world.toState(current));
+    }
+}
+
+
+/******** WITHIN QUANTIZATION TOLERANCE ********/
+
+bool Planner::withinQuantizationTolerance(const PlanResults& fixed, const PlanResults& exact)
+{
+    double edgeError = 0.5 / Graph::FIXED_POINT_SCALE;
+    size_t edges = 0;
+
+    if (fixed.success != exact.success)
+    {
+        return false;
+    }
+
+    if (!fixed.success)
+    {
+        return true;
+    }
+
+    edges = (fixed.path.size() - 1) + (exact.path.size() - 1);
+
+    // Small slack for floating-point summation of the exact costs
+    return std::abs(fixed.totalCost - exact.totalCost) <= edges * edgeError + 1e-9;
+}
+
+
+/******************** PLAN ********************/
+
+PlanResults Planner::plan(const State& start, const State& goal, SearchType type) const
+{
+    return plan(start, goal, type, context);
+}
+
+
+/************** PLAN WITH CONTEXT **************/
+
+PlanResults Planner::plan(const State& start, const State& goal, SearchType type, PlannerContext& context) const
+{
+    PlanResults result = runQuery(start, goal, type, SearchLimits(), context);
+
+    result.path.assign(context.path.begin(), context.path.end());
+
+    return result;
+}
+
+
+/************ PLAN INTO CALLER PATH ************/
+
+PlanResults Planner::plan(const State& start, const State& goal, SearchType type, PlannerContext& context,
+    std::pmr::vector<State>& path) const
+{
+    PlanResults result = runQuery(start, goal, type, SearchLimits(), context);
+
+    path.assign(context.path.begin(), context.path.end());
+
+    return result;
+}
+
+
+/*************** PLAN WITH LIMITS **************/
+
+PlanResults Planner::plan(const State& start, const State& goal, SearchType type, const SearchLimits& limits) const
+{
+    return plan(start, goal, type, limits, context);
+}
+
+
+/********* PLAN WITH LIMITS AND CONTEXT *********/
+
+PlanResults Planner::plan(const State& start, const State& goal, SearchType type, const SearchLimits& limits,
+    PlannerContext& context) const
+{
+    PlanResults result = runQuery(start, goal, type, limits, context);
+
+    result.path.assign(context.path.begin(), context.path.end());
+
+    return result;
+}
+
+
+/****************** RUN QUERY ******************/
+
+PlanResults Planner::runQuery(const State& start, const State& goal, SearchType type, const SearchLimits& limits,
+    PlannerContext& context) const
+{
+    context.path.clear();
+    context.arena.reset();
+    context.limits = limits;
+
+    if (!graph.isValid(start) || !graph.isValid(goal))
+    {
+        return { {}, false, 0.0, 0.0 };
     }
 
     auto startTime = std::chrono::steady_clock::now();
@@ -262,15 +1243,28 @@ PlanResults Planner::plan(const State& start, const State& goal, SearchType type
     switch (type)
     {
     case SearchType::BFS:
-        result = runBFS(start, goal);
+        result = runBFS(start, goal, context);
         break;
 
     case SearchType::Dijkstra:
-        result = runDijkstra(start, goal);
+        result = runDijkstra(start, goal, context);
         break;
 
     case SearchType::AStar:
-        result = runAStar(start, goal);
+        result = runAStar(start, goal, context);
+        break;
+
+    case SearchType::JPS:
+        result = runJPS(start, goal, context);
+        break;
+
+    case SearchType::JPSPlus:
+        result = runJPSPlus(start, goal, context);
+        break;
+
+    case SearchType::BidirectionalDijkstra:
+    case SearchType::BidirectionalAStar:
+        result = runBidirectional(start, goal, type, context);
         break;
 
     default:
@@ -281,4 +1275,203 @@ PlanResults Planner::plan(const State& start, const State& goal, SearchType type
     result.executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
 
     return result;
-}
\ No newline at end of file
+}
+
+
+/***************** PLAN ANYTIME ***************/
+
+AnytimeResults Planner::planAnytime(const State& start, const State& goal, const AnytimeSettings& settings,
+    const SearchLimits& limits) const
+{
+    return planAnytime(start, goal, settings, limits, context);
+}
+
+
+/*********** PLAN ANYTIME WITH CONTEXT *********/
+
+AnytimeResults Planner::planAnytime(const State& start, const State& goal, const AnytimeSettings& settings,
+    const SearchLimits& limits, PlannerContext& context) const
+{
+    if (!graph.isValid(start) || !graph.isValid(goal))
+    {
+        return AnytimeResults();
+    }
+
+    return context.anytime.search(graph, start, goal, settings, limits);
+}
+
+
+/*************** PLAN TO NEAREST **************/
+
+PlanResults Planner::planToNearest(const State& start, const std::vector<State>& goals, SearchType type) const
+{
+    return planToNearest(start, goals, type, context);
+}
+
+
+/********** PLAN TO NEAREST WITH CONTEXT ********/
+
+PlanResults Planner::planToNearest(const State& start, const std::vector<State>& goals, SearchType type,
+    PlannerContext& context) const
+{
+    context.path.clear();
+    context.arena.reset();
+    context.limits = SearchLimits();
+
+    if (!graph.isValid(start) || (type != SearchType::Dijkstra && type != SearchType::AStar))
+    {
+        return { {}, false, 0.0, 0.0 };
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    PlanResults result = runNearestSearch(start, goals, type, context);
+    auto endTime = std::chrono::steady_clock::now();
+
+    result.executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    result.path.assign(context.path.begin(), context.path.end());
+
+    return result;
+}
+
+
+/***************** PLAN BATCH *****************/
+
+BatchResults Planner::planBatch(const std::vector<PlanQuery>& queries)
+{
+    BatchResults batch;
+    std::vector<double> latencies;
+    unsigned int workerCount = (batchThreads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : batchThreads;
+    size_t chunkSize = 0;
+    size_t begin = 0;
+
+    // (Re)create the workers of the selected scheduler
+    if (batchScheduler == BatchScheduler::SharedQueue && (!batchPool || batchPool->size() != workerCount))
+    {
+        batchPool.reset();
+        batchPool = std::make_unique<ThreadPool>(workerCount);
+    }
+    if (batchScheduler == BatchScheduler::WorkStealing && (!batchStealer || batchStealer->size() != workerCount))
+    {
+        batchStealer.reset();
+        batchStealer = std::make_unique<WorkStealingScheduler>(workerCount);
+    }
+
+    batch.results.resize(queries.size());
+
+    // Workers are long-lived threads, so their thread-local contexts stay warm between batches
+    auto runQueries = [this, &queries, &batch](size_t first, size_t last, unsigned int)
+    {
+        PlannerContext& workerContext = PlannerContext::forThisThread();
+
+        workerContext.batchWorker = true;
+
+        for (size_t i = first; i < last; ++i)
+        {
+            batch.results[i] = plan(queries[i].start, queries[i].goal, queries[i].type, workerContext);
+        }
+    };
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    if (batchScheduler == BatchScheduler::WorkStealing)
+    {
+        // Small chunks give idle workers something to steal
+        chunkSize = std::max<size_t>(1, queries.size() / (static_cast<size_t>(workerCount) * 32));
+
+        batchStealer->resetStats();
+        batchStealer->parallelFor(static_cast<int>(queries.size()), static_cast<int>(chunkSize),
+            [&runQueries](int first, int last, unsigned int worker) { runQueries(first, last, worker); });
+        batch.workerStats = batchStealer->getStats();
+    }
+    else
+    {
+        // Several chunks per worker, so uneven queries still spread over all workers
+        chunkSize = std::max<size_t>(1, queries.size() / (static_cast<size_t>(workerCount) * 8));
+
+        for (begin = 0; begin < queries.size(); begin += chunkSize)
+        {
+            size_t end = std::min(queries.size(), begin + chunkSize);
+
+            batchPool->submit([&runQueries, begin, end](unsigned int worker) { runQueries(begin, end, worker); });
+        }
+
+        batchPool->wait();
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    batch.wallTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    batch.throughput = (batch.wallTime > 0.0) ? queries.size() * 1000.0 / batch.wallTime : 0.0;
+
+    for (const auto& result : batch.results)
+    {
+        latencies.push_back(result.executionTime);
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    batch.latencyP50 = percentile(latencies, 0.50);
+    batch.latencyP90 = percentile(latencies, 0.90);
+    batch.latencyP99 = percentile(latencies, 0.99);
+    batch.latencyMax = latencies.empty() ? 0.0 : latencies.back();
+
+    return batch;
+}
+
+
+/*********** HELPER FUNCTIONS ***********/
+
+// Nearest-rank percentile of sorted values (0 for an empty list)
+static double percentile(const std::vector<double>& sorted, double fraction)
+{
+    size_t rank = 0;
+
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+
+    rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+
+    return sorted[rank - 1];
+}
+
+
+// Chebyshev distance to the nearest goal cell for every cell, ignoring obstacles (two-pass chamfer)
+static void buildGoalField(const World& world, const std::vector<CellId>& goalCells, std::vector<double>& field)
+{
+    int stride = world.getWidth() + 2;
+    int x = 0;
+    int y = 0;
+
+    // The sentinel border keeps INF, so the passes need no bounds checks
+    field.assign(world.getCellCount(), SearchWorkspace::INF);
+
+    for (CellId cell : goalCells)
+    {
+        field[cell] = 0.0;
+    }
+
+    // Forward pass: west and the three cells above
+    for (y = 0; y < world.getHeight(); ++y)
+    {
+        CellId cell = world.toCell({ 0, y });
+
+        for (x = 0; x < world.getWidth(); ++x, ++cell)
+        {
+            double above = std::min({ field[cell - stride - 1], field[cell - stride], field[cell - stride + 1] });
+            field[cell] = std::min(field[cell], std::min(field[cell - 1], above) + 1.0);
+        }
+    }
+
+    // Backward pass: east and the three cells below
+    for (y = world.getHeight() - 1; y >= 0; --y)
+    {
+        CellId cell = world.toCell({ world.getWidth() - 1, y });
+
+        for (x = world.getWidth() - 1; x >= 0; --x, --cell)
+        {
+            double below = std::min({ field[cell + stride - 1], field[cell + stride], field[cell + stride + 1] });
+            field[cell] = std::min(field[cell], std::min(field[cell + 1], below) + 1.0);
+        }
+    }
+}
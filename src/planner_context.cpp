@@ -0,0 +1,10 @@
+#include "planner_context.h"
+
+/*************** FOR THIS THREAD ***************/
+
+PlannerContext& PlannerContext::forThisThread()
+{
+    static thread_local PlannerContext context;
+
+    return context;
+}
@@ -0,0 +1,140 @@
+#include "query_arena.h"
+#include <algorithm>
+#include <new>
+
+
+// Static helper function declaration
+static size_t alignUp(size_t offset, size_t alignment);
+
+
+/***************** CONSTRUCTOR *****************/
+
+QueryArena::QueryArena(std::pmr::memory_resource* upstream) : upstream(upstream), overflow(upstream) {}
+
+
+/****************** DESTRUCTOR *****************/
+
+QueryArena::~QueryArena()
+{
+    releaseAll();
+}
+
+
+/******************** RESET ********************/
+
+void QueryArena::reset()
+{
+    size_t needed = used + overflowBytes;
+
+    if (overflowBytes > 0)
+    {
+        releaseAll();
+        capacity = std::max<size_t>(2 * needed, 4096);
+        buffer = static_cast<std::byte*>(upstream->allocate(capacity, alignof(std::max_align_t)));
+    }
+
+    used = 0;
+}
+
+
+/***************** SET UPSTREAM ****************/
+
+void QueryArena::setUpstream(std::pmr::memory_resource* resource)
+{
+    releaseAll();
+    upstream = resource;
+
+    // polymorphic_allocator does not propagate on assignment: rebuild the list on the new resource
+    overflow.~vector();
+    new (&overflow) std::pmr::vector<Block>(resource);
+    used = 0;
+}
+
+
+/***************** GET UPSTREAM ****************/
+
+std::pmr::memory_resource* QueryArena::getUpstream() const
+{
+    return upstream;
+}
+
+
+/***************** GET CAPACITY ****************/
+
+size_t QueryArena::getCapacity() const
+{
+    return capacity;
+}
+
+
+/******************* GET USED ******************/
+
+size_t QueryArena::getUsed() const
+{
+    return used + overflowBytes;
+}
+
+
+/****************** RELEASE ALL ****************/
+
+void QueryArena::releaseAll()
+{
+    for (const auto& block : overflow)
+    {
+        upstream->deallocate(block.memory, block.bytes, block.alignment);
+    }
+
+    if (buffer != nullptr)
+    {
+        upstream->deallocate(buffer, capacity, alignof(std::max_align_t));
+    }
+
+    overflow.clear();
+    overflowBytes = 0;
+    buffer = nullptr;
+    capacity = 0;
+}
+
+
+/****************** DO ALLOCATE ****************/
+
+void* QueryArena::do_allocate(size_t bytes, size_t alignment)
+{
+    size_t offset = alignUp(used, alignment);
+    void* memory = nullptr;
+
+    if (alignment <= alignof(std::max_align_t) && offset + bytes <= capacity)
+    {
+        used = offset + bytes;
+        return buffer + offset;
+    }
+
+    // Buffer full: serve from upstream and remember the size for the next reset
+    memory = upstream->allocate(bytes, alignment);
+    overflow.push_back({ memory, bytes, alignment });
+    overflowBytes += bytes;
+
+    return memory;
+}
+
+
+/***************** DO DEALLOCATE ***************/
+
+void QueryArena::do_deallocate(void*, size_t, size_t) {}
+
+
+/****************** DO IS EQUAL ****************/
+
+bool QueryArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+
+/*********** HELPER FUNCTION ***********/
+
+// Rounds an offset up to a multiple of a power-of-two alignment
+static size_t alignUp(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
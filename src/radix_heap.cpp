@@ -0,0 +1,102 @@
+#include "radix_heap.h"
+#include <algorithm>
+
+/****************** BUCKET OF ******************/
+
+int RadixHeap::bucketOf(std::uint64_t key) const
+{
+    std::uint64_t diff = key ^ last;
+    int bucket = 0;
+    int shift = 0;
+
+    if (diff == 0)
+    {
+        return 0;
+    }
+
+    // Position of the highest set bit (1-based), by binary search over the word
+    for (shift = 32; shift > 0; shift /= 2)
+    {
+        if ((diff >> shift) != 0)
+        {
+            diff >>= shift;
+            bucket += shift;
+        }
+    }
+
+    return bucket + 1;
+}
+
+
+/******************** CLEAR ********************/
+
+void RadixHeap::clear()
+{
+    for (auto& bucket : buckets)
+    {
+        bucket.clear();
+    }
+
+    last = 0;
+    count = 0;
+}
+
+
+/******************** EMPTY ********************/
+
+bool RadixHeap::empty() const
+{
+    return count == 0;
+}
+
+
+/******************** SIZE *********************/
+
+size_t RadixHeap::size() const
+{
+    return count;
+}
+
+
+/******************** PUSH *********************/
+
+void RadixHeap::push(CellId id, double priority)
+{
+    std::uint64_t key = static_cast<std::uint64_t>(priority);
+
+    key = std::max(key, last);
+    buckets[bucketOf(key)].push_back({ key, id });
+    count++;
+}
+
+
+/********************* POP *********************/
+
+CellId RadixHeap::pop()
+{
+    CellId top = 0;
+    int i = 0;
+
+    if (buckets[0].empty())
+    {
+        // Find the first non-empty bucket and redistribute it relative to its minimum
+        for (i = 1; buckets[i].empty(); ++i) {}
+
+        auto& source = buckets[i];
+        last = std::min_element(source.begin(), source.end(),
+            [](const Entry& a, const Entry& b) { return a.key < b.key; })->key;
+
+        for (const auto& entry : source)
+        {
+            buckets[bucketOf(entry.key)].push_back(entry);
+        }
+
+        source.clear();
+    }
+
+    top = buckets[0].back().id;
+    buckets[0].pop_back();
+    count--;
+
+    return top;
+}
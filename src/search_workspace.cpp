@@ -0,0 +1,21 @@
+#include "search_workspace.h"
+#include <algorithm>
+
+/******************* PREPARE *******************/
+
+void SearchWorkspace::prepare(int cellCount)
+{
+    if (nodes.size() < static_cast<size_t>(cellCount))
+    {
+        nodes.resize(cellCount);
+    }
+
+    generation++;
+
+    // On wrap-around old stamps could collide with new generations
+    if (generation == 0)
+    {
+        std::fill(nodes.begin(), nodes.end(), Node{});
+        generation = 1;
+    }
+}
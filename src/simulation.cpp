@@ -112,6 +112,12 @@ void Simulation::verifyCorrectness(const PlanResults& results, SearchType type)
 void Simulation::run(SearchType type)
 {
     generateRandomObstacles(20, type);
+
+    if (type == SearchType::JPSPlus)
+    {
+        jumpTable.build(world);
+        planner.setJumpPointTable(&jumpTable);
+    }
     
     PlanResults results = planner.plan(start, goal, type);
     if (!results.success)
@@ -135,8 +141,34 @@ void Simulation::compareAlgorithms()
     PlanResults bfsRes = planner.plan(start, goal, SearchType::BFS);
     PlanResults dijRes = planner.plan(start, goal, SearchType::Dijkstra);
     PlanResults aStarRes = planner.plan(start, goal, SearchType::AStar);
+    PlanResults biDijRes = planner.plan(start, goal, SearchType::BidirectionalDijkstra);
+    PlanResults biAStarRes = planner.plan(start, goal, SearchType::BidirectionalAStar);
+
+    StatsManager::printComparisonResults(bfsRes, dijRes, aStarRes, biDijRes, biAStarRes);
+
+    // Same weighted searches with the lazy binary heap and the indexed 4-ary heap
+    std::vector<std::pair<std::string, PlanResults>> openListRows;
+    OpenListType previousOpenList = planner.getOpenList();
+
+    planner.setOpenList(OpenListType::BinaryHeap);
+    openListRows.push_back({ "Dijkstra (binary)", planner.plan(start, goal, SearchType::Dijkstra) });
+    openListRows.push_back({ "A* (binary)", planner.plan(start, goal, SearchType::AStar) });
+
+    planner.setOpenList(OpenListType::IndexedHeap);
+    openListRows.push_back({ "Dijkstra (4-ary)", planner.plan(start, goal, SearchType::Dijkstra) });
+    openListRows.push_back({ "A* (4-ary)", planner.plan(start, goal, SearchType::AStar) });
+
+    planner.setOpenList(OpenListType::RadixHeap);
+    openListRows.push_back({ "Dijkstra (radix)", planner.plan(start, goal, SearchType::Dijkstra) });
+    openListRows.push_back({ "A* (radix)", planner.plan(start, goal, SearchType::AStar) });
+
+    planner.setOpenList(previousOpenList);
+    StatsManager::printOpenListComparison(openListRows);
 
-    StatsManager::printComparisonResults(bfsRes, dijRes, aStarRes);
+    std::cout << "Fixed-point (radix) costs within quantization tolerance: "
+        << ((Planner::withinQuantizationTolerance(openListRows[4].second, dijRes) &&
+            Planner::withinQuantizationTolerance(openListRows[5].second, aStarRes)) ? "VERIFIED" : "FAILED")
+        << "\n";
 }
 
 
@@ -144,7 +176,7 @@ void Simulation::compareAlgorithms()
 
 static double generateCellWeight(SearchType type)
 {
-    if (type == SearchType::BFS)
+    if (type == SearchType::BFS || type == SearchType::JPS || type == SearchType::JPSPlus)
     {
         return 1.0;
     }
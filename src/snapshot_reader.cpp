@@ -0,0 +1,118 @@
+#include "snapshot_reader.h"
+#include <algorithm>
+#include <utility>
+
+static void copyTile(World& world, const WorldSnapshot& snapshot, int index);
+
+
+/***************** CONSTRUCTOR *****************/
+
+SnapshotReader::SnapshotReader(const VersionedWorld& source)
+    : source(source), world(source.getWidth(), source.getHeight()), graph(&world), planner(graph)
+{
+    refresh();
+}
+
+
+/******************** REFRESH ******************/
+
+bool SnapshotReader::refresh()
+{
+    std::shared_ptr<const WorldSnapshot> latest = source.pin();
+    int count = 0;
+    int i = 0;
+
+    if (snapshot != nullptr && latest->getVersion() == snapshot->getVersion())
+    {
+        lastCopiedTiles = 0;
+        return false;
+    }
+
+    // Unchanged tiles are shared between versions: a different pointer means a changed tile
+    for (i = 0; i < latest->getTileCount(); ++i)
+    {
+        if (snapshot == nullptr || snapshot->getTile(i) != latest->getTile(i))
+        {
+            copyTile(world, *latest, i);
+            count++;
+        }
+    }
+
+    snapshot = std::move(latest);
+    lastCopiedTiles = count;
+
+    return true;
+}
+
+
+/********************** PLAN *******************/
+
+PlanResults SnapshotReader::plan(const State& start, const State& goal, SearchType type) const
+{
+    return planner.plan(start, goal, type);
+}
+
+
+/******************* GET VERSION ***************/
+
+std::uint64_t SnapshotReader::getVersion() const
+{
+    return snapshot->getVersion();
+}
+
+
+/****************** GET SNAPSHOT ***************/
+
+const std::shared_ptr<const WorldSnapshot>& SnapshotReader::getSnapshot() const
+{
+    return snapshot;
+}
+
+
+/************** GET LAST COPIED TILES **********/
+
+int SnapshotReader::getLastCopiedTiles() const
+{
+    return lastCopiedTiles;
+}
+
+
+/******************** GET WORLD ****************/
+
+const World& SnapshotReader::getWorld() const
+{
+    return world;
+}
+
+
+/******************* GET PLANNER ***************/
+
+const Planner& SnapshotReader::getPlanner() const
+{
+    return planner;
+}
+
+
+/*********** HELPER FUNCTIONS ***********/
+
+// Copy the cells of one snapshot tile into the world (setWeight keeps its journal in step)
+static void copyTile(World& world, const WorldSnapshot& snapshot, int index)
+{
+    const int size = WorldTile::TILE_SIZE;
+    const WorldTile* tile = snapshot.getTile(index);
+    int tilesPerRow = (snapshot.getWidth() + size - 1) / size;
+    int originX = (index % tilesPerRow) * size;
+    int originY = (index / tilesPerRow) * size;
+    int endX = std::min(originX + size, snapshot.getWidth());
+    int endY = std::min(originY + size, snapshot.getHeight());
+    int x = 0;
+    int y = 0;
+
+    for (y = originY; y < endY; ++y)
+    {
+        for (x = originX; x < endX; ++x)
+        {
+            world.setWeight({ x, y }, tile->weights[(y - originY) * size + (x - originX)]);
+        }
+    }
+}
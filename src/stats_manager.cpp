@@ -1,6 +1,8 @@
 #include "stats_manager.h"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 
 
 // Static helper function declaration
@@ -11,7 +13,8 @@ static void printRow(const std::string& name, const PlanResults& r);
 
 /*********** PRINT COMPARISON RESULTS ************/
 
-void StatsManager::printComparisonResults(const PlanResults& bfsRes, const PlanResults& dijRes, const PlanResults& aStarRes) 
+void StatsManager::printComparisonResults(const PlanResults& bfsRes, const PlanResults& dijRes, const PlanResults& aStarRes,
+    const PlanResults& biDijRes, const PlanResults& biAStarRes) 
 {
     const double eps = 0.0001;
 
@@ -43,6 +46,25 @@ void StatsManager::printComparisonResults(const PlanResults& bfsRes, const PlanR
         printRow("A*", aStarRes);
     }
 
+    // Bidirectional searches must match Dijkstra as well
+    if (biDijRes.success && dijRes.success && std::abs(biDijRes.totalCost - dijRes.totalCost) < eps)
+    {
+        printRow("Bi-Dij (opt.)", biDijRes);
+    }
+    else
+    {
+        printRow("Bi-Dijkstra", biDijRes);
+    }
+
+    if (biAStarRes.success && dijRes.success && std::abs(biAStarRes.totalCost - dijRes.totalCost) < eps)
+    {
+        printRow("Bi-A* (opt.)", biAStarRes);
+    }
+    else
+    {
+        printRow("Bi-A*", biAStarRes);
+    }
+
     std::cout << "\n";
     std::cout << "\n==============================================================\n\n";
     std::cout << "Note: Cost = steps for BFS, total weights for Dijkstra/A*\n";
@@ -50,6 +72,261 @@ void StatsManager::printComparisonResults(const PlanResults& bfsRes, const PlanR
 }
 
 
+/*********** PRINT OPEN LIST COMPARISON ************/
+
+void StatsManager::printOpenListComparison(const std::vector<std::pair<std::string, PlanResults>>& rows)
+{
+    std::cout << "\n==============================================================";
+    std::cout << "\n                   OPEN LIST COMPARISON";
+    std::cout << "\n==============================================================\n\n";
+
+    std::cout << std::left
+        << std::setw(22) << "Search"
+        << std::setw(10) << "Cost"
+        << std::setw(10) << "Expanded"
+        << std::setw(8) << "Stale"
+        << std::setw(10) << "Peak open"
+        << std::setw(10) << "Time(ms)"
+        << "\n";
+
+    std::cout << "-------------------------------------------------------------\n";
+
+    for (const auto& [name, r] : rows)
+    {
+        std::cout << std::left
+            << std::setw(22) << name
+            << std::setw(10) << std::fixed << std::setprecision(2) << r.totalCost
+            << std::setw(10) << r.nodesExpanded
+            << std::setw(8) << r.stalePops
+            << std::setw(10) << r.peakOpenSize
+            << std::setw(10) << std::setprecision(3) << r.executionTime
+            << "\n";
+    }
+
+    std::cout << "\nNote: Stale = popped entries of already closed nodes (lazy deletion)\n\n";
+}
+
+
+/*********** PRINT TIMING COMPARISON ************/
+
+void StatsManager::printTimingComparison(const std::vector<std::pair<std::string, double>>& rows)
+{
+    std::cout << "\n" << std::left
+        << std::setw(28) << "Run"
+        << std::setw(14) << "Time(ms)"
+        << std::setw(10) << "Speedup"
+        << "\n";
+
+    std::cout << "-------------------------------------------------------------\n";
+
+    for (const auto& [name, time] : rows)
+    {
+        double speedup = (time > 0.0) ? rows.front().second / time : 0.0;
+
+        std::cout << std::left
+            << std::setw(28) << name
+            << std::setw(14) << std::fixed << std::setprecision(3) << time
+            << std::setprecision(2) << speedup << "x"
+            << "\n";
+    }
+
+    std::cout << "\n";
+}
+
+
+/************* PRINT BATCH RESULTS **************/
+
+void StatsManager::printBatchResults(const std::string& name, const BatchResults& batch)
+{
+    std::cout << "\nBatch: " << name << " (" << batch.results.size() << " queries)\n";
+    std::cout << "-------------------------------------------------------------\n";
+
+    std::cout << std::left << std::fixed << std::setprecision(3)
+        << std::setw(20) << "Wall time (ms):" << batch.wallTime << "\n"
+        << std::setw(20) << "Throughput (q/s):" << std::setprecision(1) << batch.throughput << "\n"
+        << std::setprecision(3)
+        << std::setw(20) << "Latency p50 (ms):" << batch.latencyP50 << "\n"
+        << std::setw(20) << "Latency p90 (ms):" << batch.latencyP90 << "\n"
+        << std::setw(20) << "Latency p99 (ms):" << batch.latencyP99 << "\n"
+        << std::setw(20) << "Latency max (ms):" << batch.latencyMax << "\n\n";
+}
+
+
+/************* PRINT WORKER STATS **************/
+
+void StatsManager::printWorkerStats(const std::vector<WorkStealingScheduler::WorkerStats>& stats, double wallTime)
+{
+    size_t totalSteals = 0;
+    double totalBusy = 0.0;
+    double maxBusy = 0.0;
+    size_t i = 0;
+
+    std::cout << std::left
+        << std::setw(10) << "Worker"
+        << std::setw(10) << "Tasks"
+        << std::setw(10) << "Steals"
+        << std::setw(12) << "Busy(ms)"
+        << std::setw(10) << "Util"
+        << "\n";
+
+    std::cout << "-------------------------------------------------------------\n";
+
+    for (i = 0; i < stats.size(); ++i)
+    {
+        const auto& worker = stats[i];
+        double utilization = (wallTime > 0.0) ? 100.0 * worker.busyTime / wallTime : 0.0;
+
+        std::cout << std::left
+            << std::setw(10) << i
+            << std::setw(10) << worker.tasksExecuted
+            << std::setw(10) << worker.steals
+            << std::setw(12) << std::fixed << std::setprecision(3) << worker.busyTime
+            << std::setprecision(1) << utilization << "%"
+            << "\n";
+
+        totalSteals += worker.steals;
+        totalBusy += worker.busyTime;
+        maxBusy = std::max(maxBusy, worker.busyTime);
+    }
+
+    std::cout << "\nTotal steals: " << totalSteals
+        << ", imbalance (max/mean busy): " << std::setprecision(2)
+        << ((totalBusy > 0.0) ? maxBusy * stats.size() / totalBusy : 1.0) << "\n\n";
+}
+
+
+/*********** PRINT ALLOCATION COUNTS ************/
+
+void StatsManager::printAllocationCounts(const std::vector<std::tuple<std::string, double, double, double>>& rows)
+{
+    std::cout << "\n" << std::left
+        << std::setw(22) << "Search"
+        << std::setw(13) << "1st query"
+        << std::setw(13) << "Warm/query"
+        << std::setw(13) << "Into buffer"
+        << "\n";
+
+    std::cout << "-------------------------------------------------------------\n";
+
+    for (const auto& [name, first, warm, warmBuffered] : rows)
+    {
+        std::cout << std::left << std::fixed << std::setprecision(2)
+            << std::setw(22) << name
+            << std::setw(13) << first
+            << std::setw(13) << warm
+            << std::setw(13) << warmBuffered
+            << "\n";
+    }
+
+    std::cout << "\nNote: Into buffer = path written into a reused caller-provided std::pmr::vector\n\n";
+}
+
+
+/************** PRINT BFS LAYERS ***************/
+
+void StatsManager::printBFSLayers(const std::vector<BFSLayerStats>& layers)
+{
+    size_t begin = 0;
+    size_t end = 0;
+    int bottomUpLayers = 0;
+
+    std::cout << "\n" << std::left
+        << std::setw(14) << "Layers"
+        << std::setw(11) << "Mode"
+        << std::setw(14) << "Max frontier"
+        << std::setw(14) << "Edges"
+        << std::setw(10) << "Time(ms)"
+        << "\n";
+
+    std::cout << "-------------------------------------------------------------\n";
+
+    // One row per run of layers computed in the same direction
+    for (begin = 0; begin < layers.size(); begin = end)
+    {
+        int maxFrontier = 0;
+        size_t edges = 0;
+        double time = 0.0;
+
+        for (end = begin; end < layers.size() && layers[end].bottomUp == layers[begin].bottomUp; ++end)
+        {
+            maxFrontier = std::max(maxFrontier, layers[end].frontierSize);
+            edges += layers[end].edgesChecked;
+            time += layers[end].time;
+        }
+
+        if (layers[begin].bottomUp)
+        {
+            bottomUpLayers += static_cast<int>(end - begin);
+        }
+
+        std::cout << std::left << std::fixed << std::setprecision(3)
+            << std::setw(14) << (std::to_string(begin + 1) + "-" + std::to_string(end))
+            << std::setw(11) << (layers[begin].bottomUp ? "bottom-up" : "top-down")
+            << std::setw(14) << maxFrontier
+            << std::setw(14) << edges
+            << std::setw(10) << time
+            << "\n";
+    }
+
+    std::cout << "\n" << bottomUpLayers << " of " << layers.size() << " layers bottom-up\n\n";
+}
+
+
+/************* PRINT ANYTIME CURVE **************/
+
+void StatsManager::printAnytimeCurve(const AnytimeResults& results)
+{
+    const int barWidth = 30;
+    double first = 0.0;
+    double best = 0.0;
+
+    if (results.solutions.empty())
+    {
+        std::cout << "\nNo solution found\n\n";
+        return;
+    }
+
+    first = results.solutions.front().cost;
+    best = results.solutions.back().cost;
+
+    std::cout << "\n" << std::left
+        << std::setw(11) << "Time(ms)"
+        << std::setw(8) << "Weight"
+        << std::setw(8) << "Bound"
+        << std::setw(12) << "Cost"
+        << std::setw(11) << "Expanded"
+        << "Cost above best"
+        << "\n";
+
+    std::cout << "------------------------------------------------------------------------------\n";
+
+    for (const auto& solution : results.solutions)
+    {
+        double excess = (first > best) ? (solution.cost - best) / (first - best) : 0.0;
+        int bar = static_cast<int>(std::lround(excess * barWidth));
+
+        std::cout << std::left << std::fixed
+            << std::setw(11) << std::setprecision(3) << solution.time
+            << std::setw(8) << std::setprecision(2) << solution.weight
+            << std::setw(8) << std::setprecision(3) << solution.bound
+            << std::setw(12) << std::setprecision(3) << solution.cost
+            << std::setw(11) << solution.nodesExpanded
+            << "|" << std::string(bar, '#')
+            << "\n";
+    }
+
+    std::cout << "\n" << results.iterations << " iterations, " << results.nodesExpanded << " expansions, "
+        << std::setprecision(3) << results.executionTime << " ms";
+
+    if (results.truncated)
+    {
+        std::cout << " (stopped by the budget)";
+    }
+
+    std::cout << "\n\n";
+}
+
+
 /*********** PRINT CORRECTNESS REPORT ************/
 
 void StatsManager::printCorrectnessReport(const PlanResults& r, const std::string& name)
@@ -0,0 +1,106 @@
+#include "thread_pool.h"
+#include <algorithm>
+
+/***************** CONSTRUCTOR *****************/
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+    unsigned int i = 0;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+
+/****************** DESTRUCTOR *****************/
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    taskReady.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+
+/********************* SIZE ********************/
+
+unsigned int ThreadPool::size() const
+{
+    return static_cast<unsigned int>(workers.size());
+}
+
+
+/******************** SUBMIT *******************/
+
+void ThreadPool::submit(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+
+    taskReady.notify_one();
+}
+
+
+/********************* WAIT ********************/
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    allDone.wait(lock, [this] { return tasks.empty() && activeTasks == 0; });
+}
+
+
+/****************** WORKER LOOP ****************/
+
+void ThreadPool::workerLoop(unsigned int index)
+{
+    while (true)
+    {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskReady.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+            // Queued tasks are drained before the pool stops
+            if (tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            activeTasks++;
+        }
+
+        task(index);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeTasks--;
+
+            if (tasks.empty() && activeTasks == 0)
+            {
+                allDone.notify_all();
+            }
+        }
+    }
+}
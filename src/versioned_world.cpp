@@ -0,0 +1,214 @@
+#include "versioned_world.h"
+#include <atomic>
+#include <utility>
+
+
+/************** SNAPSHOT CONSTRUCTOR ***********/
+
+WorldSnapshot::WorldSnapshot(int width, int height, std::uint64_t version, std::vector<std::shared_ptr<const WorldTile>> tiles)
+    : width(width), height(height), tilesPerRow((width + WorldTile::TILE_SIZE - 1) / WorldTile::TILE_SIZE),
+    version(version), tiles(std::move(tiles))
+{
+}
+
+
+/************** SNAPSHOT GET WIDTH *************/
+
+int WorldSnapshot::getWidth() const
+{
+    return width;
+}
+
+
+/************* SNAPSHOT GET HEIGHT *************/
+
+int WorldSnapshot::getHeight() const
+{
+    return height;
+}
+
+
+/************* SNAPSHOT GET VERSION ************/
+
+std::uint64_t WorldSnapshot::getVersion() const
+{
+    return version;
+}
+
+
+/*********** SNAPSHOT GET TILE COUNT ***********/
+
+int WorldSnapshot::getTileCount() const
+{
+    return static_cast<int>(tiles.size());
+}
+
+
+/************** SNAPSHOT GET TILE **************/
+
+const WorldTile* WorldSnapshot::getTile(int index) const
+{
+    return tiles[index].get();
+}
+
+
+/************* SNAPSHOT GET WEIGHT *************/
+
+double WorldSnapshot::getWeight(const State& s) const
+{
+    const int size = WorldTile::TILE_SIZE;
+
+    if (s.x < 0 || s.x >= width || s.y < 0 || s.y >= height)
+    {
+        return World::BLOCK;
+    }
+
+    return tiles[(s.y / size) * tilesPerRow + s.x / size]->weights[(s.y % size) * size + s.x % size];
+}
+
+
+/************** SNAPSHOT IS FREE ***************/
+
+bool WorldSnapshot::isFree(const State& s) const
+{
+    return getWeight(s) != World::BLOCK;
+}
+
+
+/********* VERSIONED WORLD CONSTRUCTOR *********/
+
+VersionedWorld::VersionedWorld(const World& world)
+    : width(world.getWidth()), height(world.getHeight()),
+    tilesPerRow((world.getWidth() + WorldTile::TILE_SIZE - 1) / WorldTile::TILE_SIZE)
+{
+    const int size = WorldTile::TILE_SIZE;
+    int tileRows = (height + size - 1) / size;
+    int x = 0;
+    int y = 0;
+
+    working.resize(static_cast<size_t>(tilesPerRow) * tileRows);
+    copied.assign(working.size(), 1);
+
+    for (auto& tile : working)
+    {
+        tile = std::make_shared<WorldTile>();
+    }
+
+    for (y = 0; y < height; ++y)
+    {
+        for (x = 0; x < width; ++x)
+        {
+            working[(y / size) * tilesPerRow + x / size]->weights[(y % size) * size + x % size] = world.getWeight({ x, y });
+        }
+    }
+
+    // Version 1 contains every tile
+    for (int i = 0; i < static_cast<int>(working.size()); ++i)
+    {
+        touched.push_back(i);
+    }
+
+    publish();
+}
+
+
+/******************* GET WIDTH *****************/
+
+int VersionedWorld::getWidth() const
+{
+    return width;
+}
+
+
+/******************* GET HEIGHT ****************/
+
+int VersionedWorld::getHeight() const
+{
+    return height;
+}
+
+
+/******************* SET WEIGHT ****************/
+
+bool VersionedWorld::setWeight(const State& s, double weight)
+{
+    const int size = WorldTile::TILE_SIZE;
+    int index = 0;
+    int offset = 0;
+
+    if (s.x < 0 || s.x >= width || s.y < 0 || s.y >= height)
+    {
+        return false;
+    }
+
+    if (weight < 0)
+    {
+        weight = World::BLOCK;
+    }
+
+    index = (s.y / size) * tilesPerRow + s.x / size;
+    offset = (s.y % size) * size + s.x % size;
+
+    // Unchanged weight: no copy, and the tile stays shared with the current version
+    if (working[index]->weights[offset] == weight)
+    {
+        return true;
+    }
+
+    // Copy-on-write: published tiles are shared with readers and never modified
+    if (!copied[index])
+    {
+        working[index] = std::make_shared<WorldTile>(*working[index]);
+        copied[index] = 1;
+        touched.push_back(index);
+    }
+
+    working[index]->weights[offset] = weight;
+
+    return true;
+}
+
+
+/********************* PUBLISH *****************/
+
+std::uint64_t VersionedWorld::publish()
+{
+    std::vector<std::shared_ptr<const WorldTile>> tiles;
+
+    if (touched.empty())
+    {
+        return nextVersion - 1;
+    }
+
+    tiles.assign(working.begin(), working.end());
+
+    // From now on the touched tiles belong to the snapshot: the next write copies them again
+    for (int index : touched)
+    {
+        copied[index] = 0;
+    }
+
+    lastCopiedTiles = static_cast<int>(touched.size());
+    touched.clear();
+
+    std::atomic_store(&current, std::shared_ptr<const WorldSnapshot>(
+        std::make_shared<WorldSnapshot>(width, height, nextVersion, std::move(tiles))));
+
+    return nextVersion++;
+}
+
+
+/*********************** PIN *******************/
+
+std::shared_ptr<const WorldSnapshot> VersionedWorld::pin() const
+{
+    return std::atomic_load(&current);
+}
+
+
+/************** GET LAST COPIED TILES **********/
+
+int VersionedWorld::getLastCopiedTiles() const
+{
+    return lastCopiedTiles;
+}
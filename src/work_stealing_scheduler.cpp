@@ -0,0 +1,310 @@
+#include "work_stealing_scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cassert>
+
+
+// Worker index of the current thread and the scheduler it belongs to
+static thread_local const WorkStealingScheduler* currentScheduler = nullptr;
+static thread_local unsigned int currentWorker = 0;
+
+
+/***************** CONSTRUCTOR *****************/
+
+WorkStealingScheduler::WorkStealingScheduler(unsigned int threadCount)
+    : queued(0), pending(0), nextWorker(0)
+{
+    unsigned int i = 0;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (i = 0; i < threadCount; ++i)
+    {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    for (i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(&WorkStealingScheduler::workerLoop, this, i);
+    }
+}
+
+
+/****************** DESTRUCTOR *****************/
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+
+    wakeUp.notify_all();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+
+/********************* SIZE ********************/
+
+unsigned int WorkStealingScheduler::size() const
+{
+    return static_cast<unsigned int>(workers.size());
+}
+
+
+/******************** SUBMIT *******************/
+
+void WorkStealingScheduler::submit(Task task)
+{
+    if (currentScheduler == this)
+    {
+        push(currentWorker, std::move(task), nullptr);
+    }
+    else
+    {
+        push(nextWorker++ % size(), std::move(task), nullptr);
+    }
+}
+
+
+/****************** SUBMIT TO ******************/
+
+void WorkStealingScheduler::submitTo(unsigned int worker, Task task)
+{
+    push(worker % size(), std::move(task), nullptr);
+}
+
+
+/********************* PUSH ********************/
+
+void WorkStealingScheduler::push(unsigned int index, Task task, std::atomic<int>* latch)
+{
+    pending++;
+
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->tasks.push_back({ std::move(task), latch });
+    }
+
+    queued++;
+
+    // Taking the lock orders the increment before a sleeping worker's predicate check
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+
+    wakeUp.notify_one();
+}
+
+
+/********************* WAIT ********************/
+
+void WorkStealingScheduler::wait()
+{
+    assert(currentScheduler != this && "wait() called from inside a task");
+
+    std::unique_lock<std::mutex> lock(sleepMutex);
+
+    allDone.wait(lock, [this] { return pending == 0; });
+}
+
+
+/***************** PARALLEL FOR ****************/
+
+void WorkStealingScheduler::parallelFor(int count, int chunkSize, const std::function<void(int, int, unsigned int)>& job)
+{
+    std::atomic<int> remaining(0);
+    int begin = 0;
+    int chunkCount = 0;
+    int chunk = 0;
+
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if (chunkSize <= 0)
+    {
+        chunkSize = std::max(1, count / static_cast<int>(size() * 8));
+    }
+
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+    remaining = chunkCount;
+
+    // Contiguous blocks of chunks per worker; imbalance is fixed by stealing
+    for (chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        begin = chunk * chunkSize;
+        int end = std::min(count, begin + chunkSize);
+        unsigned int owner = static_cast<unsigned int>(static_cast<long long>(chunk) * size() / chunkCount);
+
+        push(owner, [&job, begin, end](unsigned int worker) { job(begin, end, worker); }, &remaining);
+    }
+
+    if (currentScheduler != this)
+    {
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        allDone.wait(lock, [&remaining] { return remaining == 0; });
+        return;
+    }
+
+    // Nested call: the worker helps with queued tasks instead of blocking its thread
+    while (remaining > 0)
+    {
+        QueuedTask task;
+        bool stolen = false;
+
+        if (popLocal(currentWorker, task) || (stolen = steal(currentWorker, task)))
+        {
+            runTask(currentWorker, task, stolen);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this, &remaining] { return remaining == 0 || queued > 0; });
+    }
+}
+
+
+/****************** GET STATS ******************/
+
+std::vector<WorkStealingScheduler::WorkerStats> WorkStealingScheduler::getStats() const
+{
+    std::vector<WorkerStats> stats;
+
+    for (const auto& worker : workers)
+    {
+        stats.push_back(worker->stats);
+    }
+
+    return stats;
+}
+
+
+/***************** RESET STATS *****************/
+
+void WorkStealingScheduler::resetStats()
+{
+    for (auto& worker : workers)
+    {
+        worker->stats = WorkerStats{};
+    }
+}
+
+
+/****************** POP LOCAL ******************/
+
+bool WorkStealingScheduler::popLocal(unsigned int index, QueuedTask& task)
+{
+    Worker& worker = *workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.tasks.empty())
+    {
+        return false;
+    }
+
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    queued--;
+
+    return true;
+}
+
+
+/******************** STEAL ********************/
+
+bool WorkStealingScheduler::steal(unsigned int index, QueuedTask& task)
+{
+    unsigned int count = size();
+    unsigned int i = 0;
+
+    for (i = 1; i < count; ++i)
+    {
+        Worker& victim = *workers[(index + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued--;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/****************** WORKER LOOP ****************/
+
+void WorkStealingScheduler::workerLoop(unsigned int index)
+{
+    currentScheduler = this;
+    currentWorker = index;
+
+    while (true)
+    {
+        QueuedTask task;
+        bool stolen = false;
+
+        if (!popLocal(index, task))
+        {
+            stolen = steal(index, task);
+
+            if (!stolen)
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wakeUp.wait(lock, [this] { return stopping || queued > 0; });
+
+                // Queued tasks are drained before the scheduler stops
+                if (stopping && queued == 0)
+                {
+                    return;
+                }
+                continue;
+            }
+        }
+
+        runTask(index, task, stolen);
+    }
+}
+
+
+/******************* RUN TASK ******************/
+
+void WorkStealingScheduler::runTask(unsigned int index, QueuedTask& task, bool stolen)
+{
+    WorkerStats& stats = workers[index]->stats;
+
+    auto startTime = std::chrono::steady_clock::now();
+    task.task(index);
+    auto endTime = std::chrono::steady_clock::now();
+
+    stats.tasksExecuted++;
+    stats.steals += stolen ? 1 : 0;
+    stats.busyTime += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    // Last access to the latch: its parallelFor() may return as soon as it reads 0
+    if (task.latch != nullptr && --*task.latch == 0)
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        allDone.notify_all();
+        wakeUp.notify_all();
+    }
+
+    if (--pending == 0)
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        allDone.notify_all();
+    }
+}
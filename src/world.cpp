@@ -1,9 +1,49 @@
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include "world.h"
 
+static std::atomic<std::uint64_t> nextInstanceId{ 1 };   // Instance id of the next constructed or assigned world
+
 /***************** CONSTRUCTOR *****************/
 
-World::World(int w, int h) : width(w), height(h), grid(h, std::vector<double>(w, FREE)) {}
+World::World(int w, int h) : width(w), height(h), stride(w + 2), grid(static_cast<size_t>(w + 2) * (h + 2), BLOCK),
+    instanceId(nextInstanceId++)
+{
+    clearGrid();
+}
+
+
+/*************** COPY CONSTRUCTOR **************/
+
+World::World(const World& other) : width(other.width), height(other.height), stride(other.stride), grid(other.grid),
+    obstacleVersion(other.obstacleVersion), instanceId(nextInstanceId++), epoch(other.epoch),
+    invalidatedEpoch(other.invalidatedEpoch), journalCapacity(other.journalCapacity), journal(other.journal)
+{
+}
+
+
+/*************** COPY ASSIGNMENT ***************/
+
+World& World::operator=(const World& other)
+{
+    if (this != &other)
+    {
+        width = other.width;
+        height = other.height;
+        stride = other.stride;
+        grid = other.grid;
+        obstacleVersion = other.obstacleVersion;
+        instanceId = nextInstanceId++;
+
+        // Every weight may have changed: epochs handed out before are fully invalidated
+        epoch++;
+        invalidatedEpoch = epoch;
+        journal.clear();
+    }
+
+    return *this;
+}
 
 
 /****************** IS BOUNDS ******************/
@@ -30,6 +70,51 @@ int World::getHeight() const
 }
 
 
+/***************** GET STRIDE *****************/
+
+int World::getStride() const
+{
+    return stride;
+}
+
+
+/*************** GET CELL COUNT ***************/
+
+int World::getCellCount() const
+{
+    return static_cast<int>(grid.size());
+}
+
+
+/************ GET OBSTACLE VERSION ************/
+
+std::uint64_t World::getObstacleVersion() const
+{
+    return obstacleVersion;
+}
+
+
+/*************** GET INSTANCE ID **************/
+
+std::uint64_t World::getInstanceId() const
+{
+    return instanceId;
+}
+
+
+/***************** FIND CELL ******************/
+
+CellId World::findCell(const State& s) const
+{
+    if (!inBounds(s.x, s.y))
+    {
+        return INVALID_CELL;
+    }
+
+    return toCell(s);
+}
+
+
 /***************** GET WEIGHT *****************/
 
 double World::getWeight(const State& s) const
@@ -39,7 +124,7 @@ double World::getWeight(const State& s) const
         return BLOCK;
     }
 
-    return grid[s.y][s.x];
+    return grid[toCell(s)];
 }
 
 
@@ -57,7 +142,24 @@ bool World::setWeight(const State& s, double weight)
         weight = BLOCK;
     }
 
-    grid[s.y][s.x] = weight;
+    if (grid[toCell(s)] == weight)
+    {
+        return true;
+    }
+
+    if ((grid[toCell(s)] == BLOCK) != (weight == BLOCK))
+    {
+        ++obstacleVersion;
+    }
+
+    grid[toCell(s)] = weight;
+    recordChange(s.x, s.y, s.x, s.y);
+
+    for (const auto& listener : listeners)
+    {
+        listener.second(s);
+    }
+
     return true;
 }
 
@@ -71,7 +173,7 @@ bool World::isFree(const State& s) const
         return false;
     }
 
-    return grid[s.y][s.x] != BLOCK;
+    return grid[toCell(s)] != BLOCK;
 }
 
 
@@ -79,8 +181,166 @@ bool World::isFree(const State& s) const
 
 void World::clearGrid()
 {
-    for (auto& row : grid)
+    std::vector<State> changed;
+    bool anyChanged = false;
+    int x = 0;
+    int y = 0;
+
+    // Only the interior is reset; the sentinel ring stays blocked
+    for (y = 0; y < height; ++y)
     {
-        std::fill(row.begin(), row.end(), FREE);
+        auto rowBegin = grid.begin() + toCell({ 0, y });
+
+        for (x = 0; x < width; ++x)
+        {
+            if (rowBegin[x] != FREE)
+            {
+                anyChanged = true;
+
+                if (!listeners.empty())
+                {
+                    changed.push_back({ x, y });
+                }
+            }
+        }
+
+        std::fill(rowBegin, rowBegin + width, FREE);
+    }
+
+    ++obstacleVersion;
+
+    if (anyChanged)
+    {
+        recordChange(0, 0, width - 1, height - 1);
     }
-}
\ No newline at end of file
+
+    for (const State& s : changed)
+    {
+        for (const auto& listener : listeners)
+        {
+            listener.second(s);
+        }
+    }
+}
+
+
+/************* ADD WEIGHT LISTENER ***********/
+
+int World::addWeightListener(WeightListener listener)
+{
+    listeners.push_back({ nextListenerId, std::move(listener) });
+
+    return nextListenerId++;
+}
+
+
+/*********** REMOVE WEIGHT LISTENER **********/
+
+void World::removeWeightListener(int id)
+{
+    auto found = std::find_if(listeners.begin(), listeners.end(),
+        [id](const auto& listener) { return listener.first == id; });
+
+    if (found != listeners.end())
+    {
+        listeners.erase(found);
+    }
+}
+
+
+/************* GET CHANGES SINCE *************/
+
+WorldChanges World::getChangesSince(std::uint64_t since) const
+{
+    WorldChanges changes;
+
+    changes.epoch = epoch;
+
+    if (since < invalidatedEpoch || since > epoch)
+    {
+        changes.fullInvalidation = true;
+        return changes;
+    }
+
+    // Epochs in the journal increase strictly: skip the entries up to 'since'
+    auto first = std::upper_bound(journal.begin(), journal.end(), since,
+        [](std::uint64_t value, const DirtyRegion& region) { return value < region.epoch; });
+
+    changes.regions.assign(first, journal.end());
+
+    return changes;
+}
+
+
+/************ SET JOURNAL CAPACITY ***********/
+
+void World::setJournalCapacity(size_t capacity)
+{
+    journalCapacity = capacity;
+
+    if (journal.size() > journalCapacity)
+    {
+        journal.clear();
+        journal.shrink_to_fit();
+        invalidatedEpoch = epoch;
+    }
+}
+
+
+/************ GET JOURNAL CAPACITY ***********/
+
+size_t World::getJournalCapacity() const
+{
+    return journalCapacity;
+}
+
+
+/************** GET JOURNAL SIZE *************/
+
+size_t World::getJournalSize() const
+{
+    return journal.size();
+}
+
+
+/*************** RECORD CHANGE ***************/
+
+void World::recordChange(int minX, int minY, int maxX, int maxY)
+{
+    epoch++;
+
+    // Merge into the last region if the change touches it and the rectangle stays small
+    if (!journal.empty())
+    {
+        DirtyRegion& last = journal.back();
+        int mergedMinX = std::min(last.minX, minX);
+        int mergedMinY = std::min(last.minY, minY);
+        int mergedMaxX = std::max(last.maxX, maxX);
+        int mergedMaxY = std::max(last.maxY, maxY);
+        bool touches = minX <= last.maxX + 1 && maxX >= last.minX - 1 && minY <= last.maxY + 1 && maxY >= last.minY - 1;
+        long long area = static_cast<long long>(mergedMaxX - mergedMinX + 1) * (mergedMaxY - mergedMinY + 1);
+
+        if (touches && area <= JOURNAL_MERGE_AREA)
+        {
+            last = { epoch, mergedMinX, mergedMinY, mergedMaxX, mergedMaxY };
+            return;
+        }
+    }
+
+    if (journalCapacity == 0)
+    {
+        invalidatedEpoch = epoch;
+        return;
+    }
+
+    // Overflow: the older half coalesces into a full invalidation of the epochs it covered
+    if (journal.size() >= journalCapacity)
+    {
+        size_t dropped = std::max<size_t>(1, journal.size() / 2);
+
+        invalidatedEpoch = journal[dropped - 1].epoch;
+        journal.erase(journal.begin(), journal.begin() + dropped);
+    }
+
+    journal.push_back({ epoch, minX, minY, maxX, maxY });
+}
@@ -5,6 +5,22 @@ void runStateTests();
 void runWorldTests();
 void runGraphTests();
 void runPlannerTests();
+void runIndexedHeapTests();
+void runRadixHeapTests();
+void runJumpPointSearchTests();
+void runThreadPoolTests();
+void runWorkStealingSchedulerTests();
+void runQueryArenaTests();
+void runDeltaSteppingTests();
+void runBitParallelBFSTests();
+void runDirectionOptimizingBFSTests();
+void runFlowFieldTests();
+void runDistanceMatrixTests();
+void runAnytimeAStarTests();
+void runIncrementalQueueTests();
+void runDStarLiteTests();
+void runLPAStarTests();
+void runVersionedWorldTests();
 
 
 void runAllTests()
@@ -13,6 +29,22 @@ void runAllTests()
     runWorldTests();
     runGraphTests();
     runPlannerTests();
+    runIndexedHeapTests();
+    runRadixHeapTests();
+    runJumpPointSearchTests();
+    runThreadPoolTests();
+    runWorkStealingSchedulerTests();
+    runQueryArenaTests();
+    runDeltaSteppingTests();
+    runBitParallelBFSTests();
+    runDirectionOptimizingBFSTests();
+    runFlowFieldTests();
+    runDistanceMatrixTests();
+    runAnytimeAStarTests();
+    runIncrementalQueueTests();
+    runDStarLiteTests();
+    runLPAStarTests();
+    runVersionedWorldTests();
 
     printSummary();
 }
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cmath>
+#include <vector>
+
+
+// -------------------------
+// IS CONNECTED - HELPER
+// -------------------------
+static bool isConnected(const World& world, const std::vector<State>& path)
+{
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        if (!world.isFree(path[i]))
+        {
+            return false;
+        }
+
+        if (i > 0 && (std::abs(path[i].x - path[i - 1].x) > 1 || std::abs(path[i].y - path[i - 1].y) > 1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// ----------------------------------
+// SOLUTIONS IMPROVE TO OPTIMAL
+// ----------------------------------
+void testAnytimeImprovesToOptimal()
+{
+    World world(80, 60);
+    Graph graph(&world);
+    Planner planner(graph);
+    AnytimeSettings settings;
+    State start{ 1, 1 };
+    State goal{ 78, 57 };
+    int published = 0;
+    bool improving = true;
+    bool withinBound = true;
+    bool validPaths = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    settings.initialWeight = 3.0;
+    settings.weightStep = 0.5;
+    settings.onSolution = [&published](const AnytimeSolution&) { published++; };
+
+    auto optimal = planner.plan(start, goal, SearchType::Dijkstra);
+    auto anytime = planner.planAnytime(start, goal, settings);
+
+    for (size_t i = 0; i < anytime.solutions.size(); ++i)
+    {
+        const auto& solution = anytime.solutions[i];
+
+        withinBound &= solution.cost <= solution.bound * optimal.totalCost + 1e-9 && solution.bound <= solution.weight;
+        validPaths &= solution.path.front() == start && solution.path.back() == goal && isConnected(world, solution.path);
+
+        if (i > 0)
+        {
+            const auto& previous = anytime.solutions[i - 1];
+            improving &= solution.cost <= previous.cost && solution.bound <= previous.bound && solution.time >= previous.time &&
+                (solution.cost < previous.cost || solution.bound < previous.bound);
+        }
+    }
+
+    check(anytime.success && !anytime.truncated && anytime.iterations > 1, "ARA*: runs several iterations");
+    check(std::abs(anytime.solutions.back().cost - optimal.totalCost) < 1e-9 && anytime.solutions.back().bound == 1.0,
+        "ARA*: last solution is optimal with bound 1");
+    check(improving, "ARA*: every published solution improves cost or bound");
+    check(withinBound, "ARA*: costs stay within the proven bounds");
+    check(validPaths, "ARA*: solution paths are connected and avoid obstacles");
+    check(published == static_cast<int>(anytime.solutions.size()), "ARA*: callback receives every solution");
+}
+
+
+// ----------------------------------
+// REUSES SEARCH EFFORT
+// ----------------------------------
+void testAnytimeReusesEffort()
+{
+    World world(120, 90);
+    Graph graph(&world);
+    Planner planner(graph);
+    AnytimeSettings settings;
+    State start{ 2, 3 };
+    State goal{ 117, 86 };
+    int separateExpansions = 0;
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    settings.initialWeight = 2.5;
+    settings.weightStep = 0.5;
+    auto anytime = planner.planAnytime(start, goal, settings);
+
+    // One fresh weighted A* per weight the anytime search went through
+    for (double weight = 2.5; weight >= 1.0 - 1e-9 && weight >= anytime.solutions.back().weight - 1e-9; weight -= 0.5)
+    {
+        AnytimeSettings single;
+
+        single.initialWeight = weight;
+        single.finalWeight = weight;
+        separateExpansions += planner.planAnytime(start, goal, single).nodesExpanded;
+    }
+
+    check(anytime.success && anytime.nodesExpanded < separateExpansions,
+        "ARA*: fewer expansions than a fresh search per weight");
+}
+
+
+// ----------------------------------
+// LIMITS AND EDGE CASES
+// ----------------------------------
+void testAnytimeLimitsAndEdgeCases()
+{
+    World world(80, 60);
+    Graph graph(&world);
+    Planner planner(graph);
+    AnytimeSettings settings;
+    SearchLimits limits;
+    State start{ 1, 1 };
+    State goal{ 78, 57 };
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    auto full = planner.planAnytime(start, goal, settings);
+
+    // Stop right after the first solution
+    limits.maxExpansions = full.solutions.front().nodesExpanded + 1;
+    auto stopped = planner.planAnytime(start, goal, settings, limits);
+
+    check(stopped.truncated && stopped.stopReason == SearchStop::ExpansionLimit && stopped.success &&
+        stopped.solutions.back().cost == full.solutions.front().cost, "ARA*: budget keeps the solutions found so far");
+
+    limits.maxExpansions = 5;
+    auto early = planner.planAnytime(start, goal, settings, limits);
+    check(early.truncated && !early.success && early.solutions.empty(), "ARA*: budget before the first solution");
+
+    auto same = planner.planAnytime(start, start, settings);
+    check(same.success && same.solutions.size() == 1 && same.solutions[0].path.size() == 1 && same.solutions[0].bound == 1.0,
+        "ARA*: start equals goal");
+
+    for (int y = 0; y < 60; ++y)
+    {
+        world.setWeight({ 40, y }, World::BLOCK);
+    }
+
+    auto unreachable = planner.planAnytime(start, goal, settings);
+    auto invalid = planner.planAnytime({ -1, 0 }, goal, settings);
+
+    check(!unreachable.success && !unreachable.truncated, "ARA*: unreachable goal");
+    check(!invalid.success && invalid.iterations == 0, "ARA*: invalid start");
+}
+
+
+// --------------------
+// RUN ANYTIME A* TESTS
+// --------------------
+void runAnytimeAStarTests()
+{
+    testHeader("ANYTIME A* (ARA*) TESTS");
+
+    testAnytimeImprovesToOptimal();
+    testAnytimeReusesEffort();
+    testAnytimeLimitsAndEdgeCases();
+}
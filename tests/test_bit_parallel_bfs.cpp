@@ -0,0 +1,160 @@
+#include "bit_parallel_bfs.h"
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+
+// -------------------------
+// VALID PATH - HELPER
+// -------------------------
+static bool isValidPath(const World& world, const std::vector<State>& path, const State& start, const State& goal)
+{
+    bool valid = !path.empty() && path.front() == start && path.back() == goal;
+
+    for (size_t i = 0; i < path.size() && valid; ++i)
+    {
+        valid = world.isFree(path[i]);
+
+        if (valid && i > 0)
+        {
+            int dx = std::abs(path[i].x - path[i - 1].x);
+            int dy = std::abs(path[i].y - path[i - 1].y);
+            valid = (dx <= 1 && dy <= 1 && dx + dy > 0);
+        }
+    }
+
+    return valid;
+}
+
+
+// ----------------------------------
+// LAYERS MATCH QUEUE BFS
+// ----------------------------------
+void testBitParallelLayersMatchQueue()
+{
+    World world(130, 47);    // Rows of three words, the last one partly used
+    World wide(4200, 4);     // More than 64 words per row: several summary words
+    Graph graph(&world);
+    Graph wideGraph(&wide);
+    BitParallelBFS bfs;
+    std::vector<int> distance;
+    State source{ 5, 6 };
+    int farthest = 0;
+
+    fillBlockedMaze(world);
+    world.setWeight(source, World::FREE);
+
+    farthest = bfs.computeLayers(world, source, distance);
+    auto expected = queueLayers(graph, source);
+    int expectedFarthest = 0;
+
+    for (int layer : expected)
+    {
+        expectedFarthest = std::max(expectedFarthest, layer);
+    }
+
+    check(distance == expected, "bit-parallel BFS: layers equal queue BFS layers");
+    check(farthest == expectedFarthest, "bit-parallel BFS: returns the largest layer");
+
+    for (int x = 0; x < wide.getWidth(); x += 3)
+    {
+        wide.setWeight({ x, (x / 3) % 4 }, World::BLOCK);
+    }
+    wide.setWeight({ 4199, 0 }, World::FREE);
+
+    bfs.computeLayers(wide, { 4199, 0 }, distance);
+    check(distance == queueLayers(wideGraph, { 4199, 0 }), "bit-parallel BFS: layers cross word and summary boundaries");
+}
+
+
+// ----------------------------------
+// PATHS MATCH QUEUE BFS
+// ----------------------------------
+void testBitParallelPathsMatchQueue()
+{
+    World world(130, 47);
+    Graph graph(&world);
+    Planner queue(graph);
+    Planner bitParallel(graph);
+    State start{ 5, 6 };
+    bool sameOutcome = true;
+    bool validPaths = true;
+
+    fillBlockedMaze(world);
+    world.setWeight(start, World::FREE);
+    bitParallel.setBFSMode(BFSMode::BitParallel);
+
+    // The same planner (and context) answers every query: bitmaps are reused
+    for (int i = 0; i < 60; ++i)
+    {
+        State goal{ (i * 37 + 11) % 130, (i * 13 + 5) % 47 };
+
+        if (!world.isFree(goal))
+        {
+            continue;
+        }
+
+        auto expected = queue.plan(start, goal, SearchType::BFS);
+        auto actual = bitParallel.plan(start, goal, SearchType::BFS);
+
+        sameOutcome &= expected.success == actual.success && expected.totalCost == actual.totalCost;
+        sameOutcome &= actual.path.size() == (actual.success ? static_cast<size_t>(actual.totalCost) + 1 : 0);
+        validPaths &= !actual.success || isValidPath(world, actual.path, start, goal);
+    }
+
+    check(bitParallel.getBFSMode() == BFSMode::BitParallel, "bit-parallel BFS: mode is selectable");
+    check(sameOutcome, "bit-parallel BFS: same success and path length as queue BFS");
+    check(validPaths, "bit-parallel BFS: paths are connected and avoid obstacles");
+}
+
+
+// ----------------------------------
+// EDGE CASES
+// ----------------------------------
+void testBitParallelEdgeCases()
+{
+    World world(70, 10);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<int> distance;
+    BitParallelBFS bfs;
+
+    planner.setBFSMode(BFSMode::BitParallel);
+
+    // Wall across the map with a single gap on the word boundary
+    for (int y = 0; y < 10; ++y)
+    {
+        world.setWeight({ 64, y }, (y == 9) ? World::FREE : World::BLOCK);
+    }
+
+    auto throughGap = planner.plan({ 0, 0 }, { 69, 0 }, SearchType::BFS);
+    auto same = planner.plan({ 3, 3 }, { 3, 3 }, SearchType::BFS);
+
+    check(throughGap.success && throughGap.totalCost == 73.0 && isValidPath(world, throughGap.path, { 0, 0 }, { 69, 0 }),
+        "bit-parallel BFS: path through a gap on a word boundary");
+    check(same.success && same.path.size() == 1 && same.totalCost == 0.0, "bit-parallel BFS: start equals goal");
+
+    world.setWeight({ 64, 9 }, World::BLOCK);
+    auto closed = planner.plan({ 0, 0 }, { 69, 0 }, SearchType::BFS);
+
+    check(!closed.success && closed.path.empty() && closed.nodesExpanded == 640,
+        "bit-parallel BFS: unreachable goal after the obstacles changed");
+    check(bfs.computeLayers(world, { 64, 0 }, distance) == -1 && distance[world.toCell({ 0, 0 })] == -1,
+        "bit-parallel BFS: blocked source reaches nothing");
+}
+
+
+// --------------------
+// RUN BIT-PARALLEL BFS TESTS
+// --------------------
+void runBitParallelBFSTests()
+{
+    testHeader("BIT-PARALLEL BFS TESTS");
+
+    testBitParallelLayersMatchQueue();
+    testBitParallelPathsMatchQueue();
+    testBitParallelEdgeCases();
+}
@@ -0,0 +1,209 @@
+#include "d_star_lite.h"
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cmath>
+#include <vector>
+
+
+// ----------------------------------
+// REPAIRS MATCH FRESH SEARCHES
+// ----------------------------------
+void testDStarLiteMatchesFreshSearch()
+{
+    World world(70, 50);
+    Graph graph(&world);
+    Planner planner(graph);
+    DStarLite dstar(graph);
+    State start{ 1, 1 };
+    State goal{ 68, 47 };
+    bool costsMatch = true;
+    bool pathsValid = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    check(dstar.initialize(start, goal), "D* Lite: initializes with free start and goal");
+
+    auto first = dstar.replan();
+    auto fresh = planner.plan(start, goal, SearchType::Dijkstra);
+
+    check(first.success && std::abs(first.totalCost - fresh.totalCost) < 1e-6, "D* Lite: initial path is optimal");
+
+    // Rounds of blocked, freed and re-weighted cells all over the map
+    for (int round = 0; round < 12; ++round)
+    {
+        std::vector<State> changed;
+
+        for (int k = 0; k < 15; ++k)
+        {
+            State cell{ (round * 37 + k * 53) % 70, (round * 11 + k * 29) % 50 };
+            int hash = (round * 7 + k * 13) % 10;
+
+            if (cell == start || cell == goal)
+            {
+                continue;
+            }
+
+            world.setWeight(cell, (hash < 4) ? World::BLOCK : 1.0 + hash * 0.5);
+            changed.push_back(cell);
+        }
+
+        dstar.updateCells(changed);
+
+        auto repaired = dstar.replan();
+        fresh = planner.plan(start, goal, SearchType::Dijkstra);
+
+        costsMatch &= repaired.success == fresh.success &&
+            (!fresh.success || std::abs(repaired.totalCost - fresh.totalCost) < 1e-6);
+        pathsValid &= !repaired.success || (repaired.path.front() == start && repaired.path.back() == goal &&
+            std::abs(pathCost(graph, repaired.path) - repaired.totalCost) < 1e-6);
+    }
+
+    check(costsMatch, "D* Lite: repaired costs equal fresh Dijkstra after every change");
+    check(pathsValid, "D* Lite: repaired paths are valid and have the reported cost");
+}
+
+
+// ----------------------------------
+// MOVING AGENT
+// ----------------------------------
+void testDStarLiteMovingStart()
+{
+    World world(60, 40);
+    Graph graph(&world);
+    Planner planner(graph);
+    DStarLite dstar(graph);
+    State goal{ 57, 37 };
+    PlanResults current;
+    bool costsMatch = true;
+    bool moved = true;
+    int steps = 0;
+
+    fillWeightedMaze(world);
+    world.setWeight({ 1, 2 }, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    dstar.initialize({ 1, 2 }, goal);
+    current = dstar.replan();
+
+    // Walk along the path; every few steps an obstacle appears a little ahead
+    while (current.success && current.path.size() > 1 && steps < 200)
+    {
+        State next = current.path[1];
+
+        moved &= dstar.moveStart(next);
+        steps++;
+
+        if (steps % 4 == 0 && current.path.size() > 6)
+        {
+            State ahead = current.path[5];
+
+            if (!(ahead == goal))
+            {
+                world.setWeight(ahead, World::BLOCK);
+                dstar.updateCells({ ahead });
+            }
+        }
+
+        current = dstar.replan();
+
+        auto fresh = planner.plan(next, goal, SearchType::Dijkstra);
+        costsMatch &= current.success == fresh.success && (!fresh.success || std::abs(current.totalCost - fresh.totalCost) < 1e-6);
+    }
+
+    check(moved && current.success && dstar.getStart() == goal, "D* Lite: agent reaches the goal around new obstacles");
+    check(costsMatch, "D* Lite: costs from the moving start equal fresh Dijkstra");
+}
+
+
+// ----------------------------------
+// LOCAL CHANGES, LOCAL WORK
+// ----------------------------------
+void testDStarLiteLocalRepair()
+{
+    World world(200, 200);
+    Graph graph(&world);
+    Planner planner(graph);
+    DStarLite dstar(graph);
+    State start{ 2, 3 };
+    State goal{ 197, 196 };
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    dstar.initialize(start, goal);
+    auto first = dstar.replan();
+
+    // A change behind the goal cannot affect the path
+    world.setWeight({ 198, 10 }, World::BLOCK);
+    dstar.updateCells({ { 198, 10 } });
+    auto farAway = dstar.replan();
+
+    check(farAway.success && farAway.nodesExpanded == 0 && dstar.getLastUpdateCount() <= 9,
+        "D* Lite: change off the path needs no expansions");
+
+    // An obstacle appears on the path close to the agent
+    world.setWeight(first.path[20], World::BLOCK);
+    dstar.updateCells({ first.path[20] });
+    auto detour = dstar.replan();
+    auto fresh = planner.plan(start, goal, SearchType::AStar);
+
+    check(detour.success && std::abs(detour.totalCost - fresh.totalCost) < 1e-6 && detour.totalCost > first.totalCost,
+        "D* Lite: detour around a new obstacle");
+    check(detour.nodesExpanded * 10 < fresh.nodesExpanded, "D* Lite: detour repair expands far fewer cells than fresh A*");
+}
+
+
+// ----------------------------------
+// EDGE CASES
+// ----------------------------------
+void testDStarLiteEdgeCases()
+{
+    World world(20, 10);
+    Graph graph(&world);
+    DStarLite dstar(graph);
+    std::vector<State> wall;
+
+    check(!dstar.replan().success, "D* Lite: uninitialized engine has no path");
+    check(!dstar.initialize({ -1, 0 }, { 5, 5 }) && !dstar.moveStart({ 1, 1 }), "D* Lite: invalid start");
+
+    dstar.initialize({ 3, 3 }, { 3, 3 });
+    auto same = dstar.replan();
+    check(same.success && same.path.size() == 1 && same.totalCost == 0.0, "D* Lite: start equals goal");
+
+    dstar.initialize({ 0, 0 }, { 19, 9 });
+    dstar.replan();
+
+    for (int y = 0; y < 10; ++y)
+    {
+        world.setWeight({ 10, y }, World::BLOCK);
+        wall.push_back({ 10, y });
+    }
+
+    dstar.updateCells(wall);
+    auto blocked = dstar.replan();
+    check(!blocked.success && blocked.path.empty(), "D* Lite: goal becomes unreachable");
+
+    world.setWeight({ 10, 5 }, World::FREE);
+    dstar.updateCells({ { 10, 5 } });
+    auto reopened = dstar.replan();
+    check(reopened.success && reopened.path.back() == State{ 19, 9 }, "D* Lite: freed cell reopens the path");
+    check(!dstar.moveStart({ 10, 0 }) && dstar.getStart() == State{ 0, 0 }, "D* Lite: cannot move onto a blocked cell");
+}
+
+
+// --------------------
+// RUN D* LITE TESTS
+// --------------------
+void runDStarLiteTests()
+{
+    testHeader("D* LITE TESTS");
+
+    testDStarLiteMatchesFreshSearch();
+    testDStarLiteMovingStart();
+    testDStarLiteLocalRepair();
+    testDStarLiteEdgeCases();
+}
@@ -0,0 +1,153 @@
+#include "delta_stepping.h"
+#include "planner.h"
+#include "search_workspace.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cmath>
+#include <vector>
+
+
+// -------------------------
+// SAME DISTANCES - HELPER
+// -------------------------
+static bool sameDistances(const ShortestPathTree& a, const ShortestPathTree& b)
+{
+    bool same = a.distance.size() == b.distance.size() && a.reachedCells == b.reachedCells;
+
+    for (size_t i = 0; i < a.distance.size() && same; ++i)
+    {
+        same = (a.distance[i] == SearchWorkspace::INF) ? b.distance[i] == SearchWorkspace::INF
+            : std::abs(a.distance[i] - b.distance[i]) < 1e-9;
+    }
+
+    return same;
+}
+
+
+// ----------------------------------
+// MATCHES SEQUENTIAL DIJKSTRA
+// ----------------------------------
+void testDeltaSteppingMatchesDijkstra()
+{
+    World world(40, 30);
+    Graph graph(&world);
+    DeltaStepping serial(graph, 1);
+    DeltaStepping parallel(graph, 3);
+    State source{ 3, 4 };
+    bool allMatch = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(source, World::FREE);
+
+    auto reference = serial.runSequential(source);
+
+    // Tiny delta (Dijkstra-like), automatic, and huge delta (Bellman-Ford-like)
+    for (double delta : { 0.3, 0.0, 2.0, 1000.0 })
+    {
+        serial.setDelta(delta);
+        parallel.setDelta(delta);
+
+        allMatch &= sameDistances(reference, serial.run(source));
+        allMatch &= sameDistances(reference, parallel.run(source));
+    }
+
+    check(reference.reachedCells > 900, "delta stepping: reference reaches the connected region");
+    check(allMatch, "delta stepping: distances equal sequential Dijkstra for any delta and thread count");
+}
+
+
+// ----------------------------------
+// PARENTS AND PATHS
+// ----------------------------------
+void testDeltaSteppingParentsAndPaths()
+{
+    World world(25, 25);
+    Graph graph(&world);
+    Planner planner(graph);
+    DeltaStepping engine(graph, 2);
+    State source{ 12, 12 };
+    bool parentsConsistent = true;
+    bool pathsMatchPlanner = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(source, World::FREE);
+
+    auto tree = engine.run(source);
+
+    // Every parent realizes the child's distance through one edge
+    for (int y = 0; y < 25; ++y)
+    {
+        for (int x = 0; x < 25; ++x)
+        {
+            CellId cell = world.toCell({ x, y });
+            CellId parent = tree.parent[cell];
+
+            if (tree.distance[cell] == SearchWorkspace::INF || parent == cell)
+            {
+                parentsConsistent &= (tree.distance[cell] == SearchWorkspace::INF) == (parent == SearchWorkspace::NO_PARENT);
+                continue;
+            }
+
+            double edge = graph.getCost(world.toState(parent), { x, y });
+            parentsConsistent &= std::abs(tree.distance[parent] + edge - tree.distance[cell]) < 1e-9;
+        }
+    }
+
+    // Paths and costs agree with goal-directed Dijkstra queries
+    for (int i = 0; i < 25; ++i)
+    {
+        State goal{ (i * 7) % 25, (i * 11 + 3) % 25 };
+        auto path = DeltaStepping::extractPath(world, tree, goal);
+
+        if (!world.isFree(goal))
+        {
+            continue;
+        }
+
+        auto single = planner.plan(source, goal, SearchType::Dijkstra);
+
+        pathsMatchPlanner &= single.success == !path.empty();
+        pathsMatchPlanner &= !single.success ||
+            (path.front() == source && path.back() == goal &&
+                std::abs(single.totalCost - tree.distance[world.toCell(goal)]) < 1e-9);
+    }
+
+    check(tree.parent[world.toCell(source)] == world.toCell(source), "delta stepping: source is its own parent");
+    check(parentsConsistent, "delta stepping: parents realize the distances");
+    check(pathsMatchPlanner, "delta stepping: extracted paths match Planner Dijkstra costs");
+}
+
+
+// ----------------------------------
+// EDGE CASES
+// ----------------------------------
+void testDeltaSteppingEdgeCases()
+{
+    World world(10, 10);
+    Graph graph(&world);
+    DeltaStepping engine(graph, 2);
+
+    world.setWeight({ 0, 0 }, World::BLOCK);
+
+    auto blocked = engine.run({ 0, 0 });
+    auto outside = engine.run({ -1, 5 });
+    auto open = engine.run({ 9, 9 });
+
+    check(blocked.reachedCells == 0 && outside.reachedCells == 0, "delta stepping: blocked or invalid source reaches nothing");
+    check(open.reachedCells == 99 && std::abs(open.distance[world.toCell({ 0, 1 })] - (1.0 + 8 * Graph::DIAGONAL_COST)) < 1e-9,
+        "delta stepping: open grid distances are octile");
+    check(DeltaStepping::extractPath(world, open, { 0, 0 }).empty(), "delta stepping: no path to a blocked cell");
+}
+
+
+// --------------------
+// RUN DELTA STEPPING TESTS
+// --------------------
+void runDeltaSteppingTests()
+{
+    testHeader("DELTA STEPPING TESTS");
+
+    testDeltaSteppingMatchesDijkstra();
+    testDeltaSteppingParentsAndPaths();
+    testDeltaSteppingEdgeCases();
+}
@@ -0,0 +1,162 @@
+#include "direction_optimizing_bfs.h"
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cstdlib>
+#include <vector>
+
+
+// ----------------------------------
+// LAYERS MATCH QUEUE BFS
+// ----------------------------------
+void testDirectionOptimizingLayers()
+{
+    World world(150, 120);
+    Graph graph(&world);
+    DirectionOptimizingBFS bfs(graph, 3);
+    std::vector<int> distance;
+    std::vector<BFSLayerStats> layers;
+    State source{ 75, 60 };
+    bool topDownMatches = false;
+    bool bottomUpMatches = false;
+    bool onlyTopDown = true;
+    bool onlyBottomUp = true;
+
+    fillBlockedMaze(world);
+    world.setWeight(source, World::FREE);
+
+    auto expected = queueLayers(graph, source);
+
+    bfs.computeLayers(source, distance, layers);
+    check(distance == expected, "direction-optimizing BFS: layers equal queue BFS layers");
+
+    // Force each direction for the whole search
+    bfs.setSwitchThresholds(0.0, 0.0);
+    bfs.computeLayers(source, distance, layers);
+    topDownMatches = (distance == expected);
+
+    for (const auto& layer : layers)
+    {
+        onlyTopDown &= !layer.bottomUp;
+    }
+
+    bfs.setSwitchThresholds(1e9, 1e9);
+    bfs.computeLayers(source, distance, layers);
+    bottomUpMatches = (distance == expected);
+
+    for (const auto& layer : layers)
+    {
+        onlyBottomUp &= layer.bottomUp;
+    }
+
+    check(topDownMatches && onlyTopDown, "direction-optimizing BFS: top-down only matches");
+    check(bottomUpMatches && onlyBottomUp, "direction-optimizing BFS: bottom-up only matches");
+}
+
+
+// ----------------------------------
+// PLANNER MODE
+// ----------------------------------
+void testDirectionOptimizingPlanner()
+{
+    World world(150, 120);
+    World corridor(400, 3);
+    Graph graph(&world);
+    Graph corridorGraph(&corridor);
+    Planner queue(graph);
+    Planner parallel(graph);
+    Planner corridorPlanner(corridorGraph);
+    State start{ 75, 60 };
+    bool sameOutcome = true;
+    bool validPaths = true;
+    bool layersReported = true;
+    bool usedBottomUp = false;
+
+    fillBlockedMaze(world);
+    world.setWeight(start, World::FREE);
+    parallel.setBFSMode(BFSMode::DirectionOptimizing);
+    parallel.setBFSThreads(3);
+
+    for (int i = 0; i < 40; ++i)
+    {
+        State goal{ (i * 37 + 11) % 150, (i * 13 + 5) % 120 };
+
+        if (!world.isFree(goal))
+        {
+            continue;
+        }
+
+        auto expected = queue.plan(start, goal, SearchType::BFS);
+        auto actual = parallel.plan(start, goal, SearchType::BFS);
+
+        sameOutcome &= expected.success == actual.success && expected.totalCost == actual.totalCost;
+        layersReported &= !actual.success || static_cast<double>(actual.bfsLayers.size()) == actual.totalCost;
+
+        for (size_t k = 0; k < actual.path.size(); ++k)
+        {
+            validPaths &= world.isFree(actual.path[k]);
+            validPaths &= k == 0 || (std::abs(actual.path[k].x - actual.path[k - 1].x) <= 1 &&
+                std::abs(actual.path[k].y - actual.path[k - 1].y) <= 1);
+        }
+
+        validPaths &= !actual.success || (actual.path.front() == start && actual.path.back() == goal);
+    }
+
+    check(sameOutcome, "direction-optimizing BFS: same success and path length as queue BFS");
+    check(validPaths, "direction-optimizing BFS: paths are connected and avoid obstacles");
+    check(layersReported, "direction-optimizing BFS: one layer statistic per move");
+
+    // A corridor keeps the frontier dense within its bounding box
+    corridorPlanner.setBFSMode(BFSMode::DirectionOptimizing);
+    auto corridorResult = corridorPlanner.plan({ 0, 1 }, { 399, 1 }, SearchType::BFS);
+
+    for (const auto& layer : corridorResult.bfsLayers)
+    {
+        usedBottomUp |= layer.bottomUp;
+    }
+
+    check(corridorResult.success && corridorResult.totalCost == 399.0 && usedBottomUp,
+        "direction-optimizing BFS: dense corridor frontier switches to bottom-up");
+}
+
+
+// ----------------------------------
+// EDGE CASES
+// ----------------------------------
+void testDirectionOptimizingEdgeCases()
+{
+    World world(20, 20);
+    Graph graph(&world);
+    Planner planner(graph);
+    DirectionOptimizingBFS bfs(graph, 2);
+    std::vector<int> distance;
+    std::vector<BFSLayerStats> layers;
+
+    planner.setBFSMode(BFSMode::DirectionOptimizing);
+
+    for (int y = 0; y < 20; ++y)
+    {
+        world.setWeight({ 10, y }, World::BLOCK);
+    }
+
+    auto closed = planner.plan({ 0, 0 }, { 19, 19 }, SearchType::BFS);
+    auto same = planner.plan({ 4, 4 }, { 4, 4 }, SearchType::BFS);
+
+    check(!closed.success && closed.path.empty() && closed.nodesExpanded == 200, "direction-optimizing BFS: unreachable goal");
+    check(same.success && same.path.size() == 1 && same.bfsLayers.empty(), "direction-optimizing BFS: start equals goal");
+    check(bfs.computeLayers({ 10, 3 }, distance, layers) == -1 && layers.empty(),
+        "direction-optimizing BFS: blocked source reaches nothing");
+}
+
+
+// --------------------
+// RUN DIRECTION-OPTIMIZING BFS TESTS
+// --------------------
+void runDirectionOptimizingBFSTests()
+{
+    testHeader("DIRECTION-OPTIMIZING BFS TESTS");
+
+    testDirectionOptimizingLayers();
+    testDirectionOptimizingPlanner();
+    testDirectionOptimizingEdgeCases();
+}
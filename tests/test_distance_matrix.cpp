@@ -0,0 +1,158 @@
+#include "distance_matrix.h"
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cmath>
+#include <vector>
+
+
+// -------------------------
+// SPREAD STATES - HELPER
+// -------------------------
+static std::vector<State> spreadStates(const World& world, int count, int seed)
+{
+    std::vector<State> states;
+
+    for (int i = 0; static_cast<int>(states.size()) < count; ++i)
+    {
+        State s{ (i * 37 + seed * 11) % world.getWidth(), (i * 23 + seed * 5) % world.getHeight() };
+
+        if (world.isFree(s))
+        {
+            states.push_back(s);
+        }
+    }
+
+    return states;
+}
+
+
+// ----------------------------------
+// MATRIX MATCHES PAIRWISE DIJKSTRA
+// ----------------------------------
+void testDistanceMatrixMatchesPairwise()
+{
+    World world(60, 45);
+    Graph graph(&world);
+    Planner planner(graph);
+    DistanceMatrix parallel(graph, 3);
+    DistanceMatrix sequential(graph, 1);
+    std::vector<State> sources;
+    std::vector<State> targets;
+    bool costsMatch = true;
+
+    fillWeightedMaze(world);
+    sources = spreadStates(world, 12, 1);
+    targets = spreadStates(world, 15, 2);
+
+    check(parallel.compute(sources, targets), "distance matrix: computes with free sources and targets");
+    check(parallel.getSourceCount() == 12 && parallel.getTargetCount() == 15 && parallel.getCosts().size() == 180,
+        "distance matrix: dense sources x targets result");
+
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        for (size_t j = 0; j < targets.size(); ++j)
+        {
+            auto single = planner.plan(sources[i], targets[j], SearchType::Dijkstra);
+            double expected = single.success ? single.totalCost : SearchWorkspace::INF;
+
+            costsMatch &= (expected == SearchWorkspace::INF) ? parallel.getCost(i, j) == expected :
+                std::abs(parallel.getCost(i, j) - expected) < 1e-6;
+        }
+    }
+
+    sequential.compute(sources, targets);
+
+    check(costsMatch, "distance matrix: costs equal pairwise Dijkstra queries");
+    check(sequential.getCosts() == parallel.getCosts() && sequential.getSettledCells() == parallel.getSettledCells(),
+        "distance matrix: same result on one and several threads");
+    check(parallel.getSettledCells() < sources.size() * static_cast<size_t>(60 * 45),
+        "distance matrix: searches stop after the last target");
+}
+
+
+// ----------------------------------
+// PATHS ON DEMAND
+// ----------------------------------
+void testDistanceMatrixPaths()
+{
+    World world(40, 30);
+    Graph graph(&world);
+    DistanceMatrix matrix(graph, 2);
+    std::vector<State> sources;
+    std::vector<State> targets;
+    bool pathsMatch = true;
+
+    fillWeightedMaze(world);
+    sources = spreadStates(world, 5, 3);
+    targets = spreadStates(world, 6, 4);
+    matrix.compute(sources, targets);
+
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        for (size_t j = 0; j < targets.size(); ++j)
+        {
+            auto path = matrix.getPath(i, j);
+            double cost = 0.0;
+
+            if (matrix.getCost(i, j) == SearchWorkspace::INF)
+            {
+                pathsMatch &= path.empty();
+                continue;
+            }
+
+            for (size_t k = 1; k < path.size(); ++k)
+            {
+                cost += graph.getCost(path[k - 1], path[k]);
+            }
+
+            pathsMatch &= !path.empty() && path.front() == sources[i] && path.back() == targets[j] &&
+                std::abs(cost - matrix.getCost(i, j)) < 1e-6;
+        }
+    }
+
+    check(pathsMatch, "distance matrix: paths on demand have the matrix cost");
+    check(matrix.getPath(0, 99).empty() && matrix.getCost(99, 0) == SearchWorkspace::INF,
+        "distance matrix: out of range pairs have no path");
+}
+
+
+// ----------------------------------
+// EDGE CASES
+// ----------------------------------
+void testDistanceMatrixEdgeCases()
+{
+    World world(20, 10);
+    Graph graph(&world);
+    DistanceMatrix matrix(graph, 2);
+    const double INF = SearchWorkspace::INF;
+
+    // Wall at x = 10 splits the world
+    for (int y = 0; y < 10; ++y)
+    {
+        world.setWeight({ 10, y }, World::BLOCK);
+    }
+
+    check(matrix.compute({ { 0, 0 }, { 10, 4 }, { 15, 5 } }, { { 3, 0 }, { 30, 0 }, { 3, 0 }, { 15, 5 } }),
+        "distance matrix: computes with some invalid states");
+    check(matrix.getCost(0, 0) == 3.0 && matrix.getCost(0, 2) == 3.0, "distance matrix: duplicate targets share a cost");
+    check(matrix.getCost(0, 1) == INF && matrix.getCost(1, 0) == INF, "distance matrix: invalid and blocked states are unreachable");
+    check(matrix.getCost(0, 3) == INF && matrix.getCost(2, 3) == 0.0, "distance matrix: disconnected pairs and source at target");
+    check(matrix.getPath(2, 3).size() == 1, "distance matrix: source at target has a one-state path");
+
+    check(!matrix.compute({ { 10, 0 } }, { { 0, 0 } }) && matrix.getCost(0, 0) == INF, "distance matrix: no free source");
+    check(!matrix.compute({ { 0, 0 } }, {}) && matrix.getCosts().empty(), "distance matrix: no targets");
+}
+
+
+// --------------------
+// RUN DISTANCE MATRIX TESTS
+// --------------------
+void runDistanceMatrixTests()
+{
+    testHeader("DISTANCE MATRIX TESTS");
+
+    testDistanceMatrixMatchesPairwise();
+    testDistanceMatrixPaths();
+    testDistanceMatrixEdgeCases();
+}
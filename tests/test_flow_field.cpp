@@ -0,0 +1,148 @@
+#include "flow_field.h"
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+// ----------------------------------
+// DISTANCES MATCH DIJKSTRA
+// ----------------------------------
+void testFlowFieldMatchesDijkstra()
+{
+    World world(47, 33);
+    Graph graph(&world);
+    Planner planner(graph);
+    FlowField field(graph);
+    State goal{ 30, 20 };
+    bool distancesMatch = true;
+    bool pathsOptimal = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(goal, World::FREE);
+
+    check(field.compute(goal), "flow field: computes toward a free goal");
+
+    // Every start: the field's distance and walk agree with a forward Dijkstra query
+    for (int y = 0; y < 33; ++y)
+    {
+        for (int x = 0; x < 47; ++x)
+        {
+            State start{ x, y };
+            auto single = planner.plan(start, goal, SearchType::Dijkstra);
+            auto path = field.extractPath(start);
+
+            if (!single.success)
+            {
+                distancesMatch &= field.getDistance(start) == FlowField::UNREACHABLE && path.empty();
+                continue;
+            }
+
+            distancesMatch &= std::abs(field.getDistance(start) - single.totalCost) < 1e-3;
+            pathsOptimal &= !path.empty() && path.front() == start && path.back() == goal &&
+                std::abs(pathCost(graph, path) - single.totalCost) < 1e-6;
+        }
+    }
+
+    check(distancesMatch, "flow field: distances equal Dijkstra costs to the goal");
+    check(pathsOptimal, "flow field: following the moves gives optimal paths");
+    check(field.getMove(goal) == FlowField::NO_MOVE && field.getDistance(goal) == 0.0f, "flow field: goal has no move");
+    check(field.getFieldBytes() < static_cast<size_t>(47 * 33) * (sizeof(float) + 1), "flow field: compact storage");
+}
+
+
+// ----------------------------------
+// SEVERAL GOALS
+// ----------------------------------
+void testFlowFieldSeveralGoals()
+{
+    World world(40, 40);
+    Graph graph(&world);
+    FlowField nearest(graph);
+    FlowField first(graph);
+    FlowField second(graph);
+    std::vector<State> goals = { { 5, 5 }, { 34, 30 } };
+    bool minimum = true;
+    bool endsAtNearest = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(goals[0], World::FREE);
+    world.setWeight(goals[1], World::FREE);
+
+    nearest.compute(goals);
+    first.compute(goals[0]);
+    second.compute(goals[1]);
+
+    for (int y = 0; y < 40; ++y)
+    {
+        for (int x = 0; x < 40; ++x)
+        {
+            float a = first.getDistance({ x, y });
+            float b = second.getDistance({ x, y });
+            auto path = nearest.extractPath({ x, y });
+
+            minimum &= nearest.getDistance({ x, y }) == std::min(a, b);
+            endsAtNearest &= path.empty() || path.back() == ((a <= b) ? goals[0] : goals[1]) ||
+                std::abs(a - b) < 1e-3;
+        }
+    }
+
+    check(nearest.getGoals().size() == 2, "flow field: keeps every valid goal");
+    check(minimum, "flow field: distance is the minimum over the goals");
+    check(endsAtNearest, "flow field: paths end at the nearest goal");
+}
+
+
+// ----------------------------------
+// REFRESH AND EDGE CASES
+// ----------------------------------
+void testFlowFieldRefresh()
+{
+    World world(30, 10);
+    Graph graph(&world);
+    FlowField field(graph);
+    State agent{ 0, 5 };
+    float before = 0.0f;
+
+    // Wall at x = 15 with a gap at the bottom
+    for (int y = 0; y < 9; ++y)
+    {
+        world.setWeight({ 15, y }, World::BLOCK);
+    }
+
+    field.compute({ { 29, 5 }, { -3, 2 }, { 15, 0 } });
+    before = field.getDistance(agent);
+
+    check(field.getGoals().size() == 1, "flow field: invalid and blocked goals are ignored");
+    check(field.getNextState(agent).x == 1 && field.getReachedCells() == 291, "flow field: next state moves toward the gap");
+
+    // Closing the gap only takes effect after refresh()
+    check(field.isUpToDate(), "flow field: up to date after compute");
+    world.setWeight({ 15, 9 }, World::BLOCK);
+    check(field.getDistance(agent) == before && !field.isUpToDate(), "flow field: unchanged until refreshed");
+
+    field.refresh();
+    check(field.isUpToDate(), "flow field: up to date after refresh");
+    check(field.getDistance(agent) == FlowField::UNREACHABLE && field.getMove(agent) == FlowField::NO_MOVE &&
+        field.extractPath(agent).empty(), "flow field: refresh sees the closed wall");
+    check(field.getMove({ 40, 2 }) == FlowField::NO_MOVE && field.getDistance({ 40, 2 }) == FlowField::UNREACHABLE,
+        "flow field: states outside the world have no move");
+
+    world.setWeight({ 29, 5 }, World::BLOCK);
+    check(!field.refresh() && field.getGoals().empty(), "flow field: blocked goal is dropped on refresh");
+}
+
+
+// --------------------
+// RUN FLOW FIELD TESTS
+// --------------------
+void runFlowFieldTests()
+{
+    testHeader("FLOW FIELD TESTS");
+
+    testFlowFieldMatchesDijkstra();
+    testFlowFieldSeveralGoals();
+    testFlowFieldRefresh();
+}
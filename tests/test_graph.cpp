@@ -271,6 +271,52 @@ void testSmallGraph()
 }
 
 
+// ---------------------------
+// FOR EACH NEIGHBOR
+// ---------------------------
+void testGraphForEachNeighbor()
+{
+    World world(4, 4);
+    Graph graph(&world);
+    State from{ 0, 1 };
+    std::vector<State> visited;
+    bool costsMatch = true;
+
+    world.setWeight({ 1, 1 }, 3.0);
+    world.setWeight({ 1, 2 }, 2.0);
+    world.setWeight({ 0, 0 }, World::BLOCK);
+
+    graph.forEachNeighbor(world.toCell(from), [&](CellId next, double cost)
+    {
+        State s = world.toState(next);
+        visited.push_back(s);
+        costsMatch &= std::abs(cost - graph.getCost(from, s)) < 1e-9;
+    });
+
+    checkNeighbors(visited, graph.getNeighbors(from), "forEachNeighbor visits the same cells as getNeighbors");
+    check(costsMatch, "forEachNeighbor edge costs match getCost");
+}
+
+
+// ---------------------------
+// OPPOSITE MOVES
+// ---------------------------
+void testGraphOppositeMoves()
+{
+    bool opposite = true;
+
+    for (int i = 0; i < Graph::MOVE_COUNT; ++i)
+    {
+        const State& move = Graph::getMove(i);
+        const State& back = Graph::getMove(Graph::getOppositeMove(i));
+
+        opposite &= back.x == -move.x && back.y == -move.y && Graph::getOppositeMove(Graph::getOppositeMove(i)) == i;
+    }
+
+    check(opposite, "opposite move table matches the move order");
+}
+
+
 // --------------------
 // GRAPH RUN TESTS
 // --------------------
@@ -287,4 +333,6 @@ void runGraphTests()
     testGraphIsValid();
     testGraphWithObstaclesDiagonal();
     testSmallGraph();
+    testGraphForEachNeighbor();
+    testGraphOppositeMoves();
 }
\ No newline at end of file
@@ -7,4 +7,88 @@
 void checkDouble(double actual, double expected, const char* testName)
 {
     check(std::abs(actual - expected) < 1e-6, testName);
-}
\ No newline at end of file
+}
+
+
+// -------------------------
+// WEIGHTED MAZE HELPER
+// -------------------------
+void fillWeightedMaze(World& world)
+{
+    for (int y = 0; y < world.getHeight(); ++y)
+    {
+        for (int x = 0; x < world.getWidth(); ++x)
+        {
+            int hash = (x * 31 + y * 17 + x * y * 7) % 50;
+            world.setWeight({ x, y }, (hash < 9) ? World::BLOCK : 1.0 + (hash % 7) * 0.75);
+        }
+    }
+}
+
+
+// -------------------------
+// BLOCKED MAZE HELPER
+// -------------------------
+void fillBlockedMaze(World& world)
+{
+    for (int y = 0; y < world.getHeight(); ++y)
+    {
+        for (int x = 0; x < world.getWidth(); ++x)
+        {
+            int hash = (x * 31 + y * 17 + x * y * 7) % 50;
+            world.setWeight({ x, y }, (hash < 14) ? World::BLOCK : World::FREE);
+        }
+    }
+}
+
+
+// -------------------------
+// QUEUE LAYERS HELPER
+// -------------------------
+std::vector<int> queueLayers(const Graph& graph, const State& source)
+{
+    const World& world = *graph.getWorld();
+    std::vector<int> layer(world.getCellCount(), -1);
+    std::vector<CellId> queue{ world.toCell(source) };
+
+    layer[queue[0]] = 0;
+
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        CellId cell = queue[head];
+
+        graph.forEachNeighbor(cell, [&](CellId next, double)
+        {
+            if (layer[next] < 0)
+            {
+                layer[next] = layer[cell] + 1;
+                queue.push_back(next);
+            }
+        });
+    }
+
+    return layer;
+}
+
+
+// -------------------------
+// PATH COST HELPER
+// -------------------------
+double pathCost(const Graph& graph, const std::vector<State>& path)
+{
+    double cost = 0.0;
+
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        double step = graph.getCost(path[i - 1], path[i]);
+
+        if (step < 0.0)
+        {
+            return -1.0;
+        }
+
+        cost += step;
+    }
+
+    return cost;
+}
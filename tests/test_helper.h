@@ -1,4 +1,8 @@
 #pragma once
+#include "world.h"
+#include "graph.h"
+#include "state.h"
+#include <vector>
 #include <string>
 #include <cmath>
 #include <iostream>
@@ -12,4 +16,41 @@
  * @param expected The expected value to compare against
  * @param testName A descriptive name for the test, printed with the result
  */
-void checkDouble(double actual, double expected, const char* testName);
\ No newline at end of file
+void checkDouble(double actual, double expected, const char* testName);
+
+/**
+ * @brief Fills a world with a deterministic maze of obstacles and varied weights.
+ *
+ * About 18% of the cells are blocked; the others get weights between 1 and 5.5.
+ * Shared by the tests that compare searches on weighted worlds.
+ *
+ * @param world The world to fill (every cell is overwritten)
+ */
+void fillWeightedMaze(World& world);
+
+/**
+ * @brief Fills a world with a deterministic maze of obstacles on a uniform grid.
+ *
+ * About 28% of the cells are blocked; the others have weight `World::FREE`.
+ *
+ * @param world The world to fill (every cell is overwritten)
+ */
+void fillBlockedMaze(World& world);
+
+/**
+ * @brief Computes BFS layers with a plain queue, as reference for the parallel BFS variants.
+ *
+ * @param graph The graph to search
+ * @param source Source cell
+ * @return Layer (number of moves from the source) per CellId, -1 for unreached cells
+ */
+std::vector<int> queueLayers(const Graph& graph, const State& source);
+
+/**
+ * @brief Sums the move costs of a path.
+ *
+ * @param graph The graph the path was planned on
+ * @param path Consecutive cells of the path
+ * @return Total cost, or -1 if two consecutive cells are not connected by a valid move
+ */
+double pathCost(const Graph& graph, const std::vector<State>& path);
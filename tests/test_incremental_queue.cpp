@@ -0,0 +1,79 @@
+#include "incremental_queue.h"
+#include "test_framework.h"
+#include <vector>
+
+
+// --------------------
+// LEXICOGRAPHIC ORDER
+// --------------------
+void testIncrementalQueueOrdering()
+{
+    IncrementalQueue queue;
+    std::vector<QueueKey> keys = { { 3.0, 1.0 }, { 1.0, 2.0 }, { 3.0, 0.5 }, { 1.0, 1.0 }, { 2.0, 9.0 }, { 0.5, 0.5 } };
+    std::vector<CellId> popped;
+    bool sorted = true;
+
+    queue.reserve(static_cast<int>(keys.size()));
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        queue.push(static_cast<CellId>(i), keys[i]);
+    }
+
+    while (!queue.empty())
+    {
+        popped.push_back(queue.pop());
+    }
+
+    for (size_t i = 1; i < popped.size(); ++i)
+    {
+        sorted &= !(keys[popped[i]] < keys[popped[i - 1]]);
+    }
+
+    check(popped.size() == keys.size() && sorted, "incremental queue: pops in lexicographic key order");
+    check(popped[1] == 3 && popped[2] == 1, "incremental queue: equal primary keys ordered by secondary key");
+}
+
+
+// --------------------
+// UPDATE AND REMOVE
+// --------------------
+void testIncrementalQueueUpdateAndRemove()
+{
+    IncrementalQueue queue;
+
+    queue.reserve(6);
+
+    for (CellId id = 0; id < 6; ++id)
+    {
+        queue.push(id, { static_cast<double>(id), 0.0 });
+    }
+
+    queue.push(0, { 10.0, 0.0 });  // increase
+    queue.push(5, { -1.0, 0.0 });  // decrease
+    queue.remove(2);
+    queue.remove(2);               // absent: ignored
+
+    check(queue.size() == 5 && !queue.contains(2), "incremental queue: remove takes out one cell");
+    check(queue.top() == 5 && queue.topKey().primary == -1.0, "incremental queue: decreased key moves to the top");
+
+    queue.pop();
+    check(queue.pop() == 1 && queue.pop() == 3 && queue.pop() == 4 && queue.pop() == 0 && queue.empty(),
+        "incremental queue: increased key moves down");
+
+    queue.push(1, { 1.0, 0.0 });
+    queue.reserve(6);
+    check(queue.empty() && !queue.contains(1), "incremental queue: reserve empties the queue");
+}
+
+
+// --------------------
+// RUN INCREMENTAL QUEUE TESTS
+// --------------------
+void runIncrementalQueueTests()
+{
+    testHeader("INCREMENTAL QUEUE TESTS");
+
+    testIncrementalQueueOrdering();
+    testIncrementalQueueUpdateAndRemove();
+}
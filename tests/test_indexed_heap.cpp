@@ -0,0 +1,90 @@
+#include "indexed_heap.h"
+#include "test_framework.h"
+#include <vector>
+
+
+// --------------------
+// HEAP ORDERING
+// --------------------
+void testIndexedHeapOrdering()
+{
+    IndexedHeap heap;
+    std::vector<double> priorities = { 5.0, 1.5, 9.0, 3.0, 7.5, 0.5, 4.0, 8.0, 2.0, 6.0 };
+    std::vector<CellId> popped;
+    bool sorted = true;
+
+    heap.reserve(static_cast<int>(priorities.size()));
+
+    for (size_t i = 0; i < priorities.size(); ++i)
+    {
+        heap.push(static_cast<CellId>(i), priorities[i]);
+    }
+
+    check(heap.size() == priorities.size(), "indexed heap: size after pushes");
+
+    while (!heap.empty())
+    {
+        popped.push_back(heap.pop());
+    }
+
+    for (size_t i = 1; i < popped.size(); ++i)
+    {
+        sorted &= priorities[popped[i - 1]] <= priorities[popped[i]];
+    }
+
+    check(sorted, "indexed heap: pops in non-decreasing priority order");
+}
+
+
+// --------------------
+// DECREASE KEY
+// --------------------
+void testIndexedHeapDecreaseKey()
+{
+    IndexedHeap heap;
+
+    heap.reserve(4);
+    heap.push(0, 4.0);
+    heap.push(1, 3.0);
+    heap.push(2, 2.0);
+
+    heap.push(0, 1.0);   // decrease-key
+    heap.push(2, 10.0);  // higher priority is ignored
+
+    check(heap.size() == 3, "indexed heap: decrease-key does not insert duplicates");
+    check(heap.topPriority() == 1.0 && heap.pop() == 0, "indexed heap: decreased cell moves to the top");
+    check(heap.pop() == 2 && heap.pop() == 1, "indexed heap: ignored increase keeps old priority");
+    check(!heap.contains(0) && !heap.contains(1) && !heap.contains(2), "indexed heap: popped cells are absent");
+}
+
+
+// --------------------
+// CLEAR AND REUSE
+// --------------------
+void testIndexedHeapReuse()
+{
+    IndexedHeap heap;
+
+    heap.reserve(3);
+    heap.push(0, 1.0);
+    heap.push(1, 2.0);
+
+    heap.reserve(3);
+    heap.push(1, 5.0);
+
+    check(heap.size() == 1 && !heap.contains(0), "indexed heap: reserve empties the heap");
+    check(heap.topPriority() == 5.0, "indexed heap: cells can be pushed again after reuse");
+}
+
+
+// --------------------
+// RUN HEAP TESTS
+// --------------------
+void runIndexedHeapTests()
+{
+    testHeader("INDEXED HEAP TESTS");
+
+    testIndexedHeapOrdering();
+    testIndexedHeapDecreaseKey();
+    testIndexedHeapReuse();
+}
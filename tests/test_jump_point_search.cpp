@@ -0,0 +1,317 @@
+#include "planner.h"
+#include "graph.h"
+#include "world.h"
+#include "state.h"
+#include "jump_point_table.h"
+#include "work_stealing_scheduler.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+
+
+// -------------------------------
+// CONTIGUOUS FREE PATH - HELPER
+// -------------------------------
+bool isContiguousFreePath(const std::vector<State>& path, const World& world)
+{
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        if (!world.isFree(path[i]))
+        {
+            return false;
+        }
+
+        if (i > 0 && (std::abs(path[i].x - path[i - 1].x) > 1 || std::abs(path[i].y - path[i - 1].y) > 1 ||
+            path[i] == path[i - 1]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// --------------------------------
+// RANDOM OBSTACLES - HELPER
+// --------------------------------
+void fillRandomObstacles(World& world, int percentage, unsigned int seed)
+{
+    srand(seed);
+
+    for (int y = 0; y < world.getHeight(); ++y)
+    {
+        for (int x = 0; x < world.getWidth(); ++x)
+        {
+            world.setWeight({ x, y }, (rand() % 100 < percentage) ? World::BLOCK : World::FREE);
+        }
+    }
+}
+
+
+// ------------------------------
+// JPS OPEN GRID
+// ------------------------------
+void testJPSOpenGrid()
+{
+    World world(30, 20);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 29, 12 };
+
+    auto jps = planner.plan(start, goal, SearchType::JPS);
+    auto astar = planner.plan(start, goal, SearchType::AStar);
+
+    check(jps.success, "JPS open grid: success");
+    checkDouble(jps.totalCost, astar.totalCost, "JPS open grid: same cost as A*");
+    check(jps.path.front() == start && jps.path.back() == goal, "JPS open grid: path from start to goal");
+    check(isContiguousFreePath(jps.path, world), "JPS open grid: path is expanded cell by cell");
+    check(jps.nodesExpanded < astar.nodesExpanded, "JPS open grid: fewer expansions than A*");
+}
+
+
+// ------------------------------
+// JPS MATCHES DIJKSTRA
+// ------------------------------
+void testJPSMatchesDijkstra()
+{
+    World world(25, 25);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 24, 24 };
+    bool sameCost = true;
+    bool validPaths = true;
+
+    for (unsigned int seed = 1; seed <= 20; ++seed)
+    {
+        fillRandomObstacles(world, 30, seed);
+        world.setWeight(start, World::FREE);
+        world.setWeight(goal, World::FREE);
+
+        auto jps = planner.plan(start, goal, SearchType::JPS);
+        auto dijkstra = planner.plan(start, goal, SearchType::Dijkstra);
+
+        sameCost &= jps.success == dijkstra.success;
+        sameCost &= !jps.success || std::abs(jps.totalCost - dijkstra.totalCost) < 1e-6;
+        validPaths &= !jps.success || (isContiguousFreePath(jps.path, world) &&
+            jps.path.front() == start && jps.path.back() == goal);
+    }
+
+    check(sameCost, "JPS random obstacles: same reachability and cost as Dijkstra");
+    check(validPaths, "JPS random obstacles: valid cell-by-cell paths");
+}
+
+
+// ------------------------------
+// JPS UNREACHABLE / TRIVIAL
+// ------------------------------
+void testJPSEdgeCases()
+{
+    World world(5, 5);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 4, 4 };
+
+    auto same = planner.plan(start, start, SearchType::JPS);
+    check(same.success && same.path.size() == 1, "JPS start==goal: single-cell path");
+
+    for (int i = 0; i < 5; ++i)
+    {
+        world.setWeight({ 2, i }, World::BLOCK);
+    }
+
+    auto blocked = planner.plan(start, goal, SearchType::JPS);
+    check(!blocked.success && blocked.path.empty(), "JPS unreachable: success == false");
+}
+
+
+// ------------------------------
+// JPS+ MATCHES DIJKSTRA
+// ------------------------------
+void testJPSPlusMatchesDijkstra()
+{
+    World world(31, 23);
+    Graph graph(&world);
+    Planner planner(graph);
+    JumpPointTable table;
+    bool sameCost = true;
+    bool validPaths = true;
+
+    planner.setJumpPointTable(&table);
+
+    for (unsigned int seed = 1; seed <= 20; ++seed)
+    {
+        State start{ static_cast<int>(seed % 31), 0 }, goal{ 30 - static_cast<int>(seed % 7), 22 };
+
+        fillRandomObstacles(world, 25, seed);
+        world.setWeight(start, World::FREE);
+        world.setWeight(goal, World::FREE);
+        table.build(world, 3);
+
+        auto plus = planner.plan(start, goal, SearchType::JPSPlus);
+        auto dijkstra = planner.plan(start, goal, SearchType::Dijkstra);
+
+        sameCost &= plus.success == dijkstra.success;
+        sameCost &= !plus.success || std::abs(plus.totalCost - dijkstra.totalCost) < 1e-6;
+        validPaths &= !plus.success || (isContiguousFreePath(plus.path, world) &&
+            plus.path.front() == start && plus.path.back() == goal);
+    }
+
+    check(sameCost, "JPS+ random obstacles: same reachability and cost as Dijkstra");
+    check(validPaths, "JPS+ random obstacles: valid cell-by-cell paths");
+}
+
+
+// ------------------------------
+// JPS+ TABLE BUILD AND STORAGE
+// ------------------------------
+void testJumpPointTableBuildAndStorage()
+{
+    World world(40, 17);
+    World other(40, 17);
+    JumpPointTable serial;
+    JumpPointTable parallel;
+    JumpPointTable scheduled;
+    JumpPointTable loaded;
+    WorkStealingScheduler scheduler(3);
+    const std::string path = "jps_table_test.bin";
+    bool identical = true;
+
+    fillRandomObstacles(world, 20, 7);
+    serial.build(world, 1);
+    parallel.build(world, 4);
+    scheduled.build(world, scheduler);
+
+    for (int y = 0; y < world.getHeight(); ++y)
+    {
+        for (int x = 0; x < world.getWidth(); ++x)
+        {
+            for (int dir = 0; dir < JumpPointTable::DIRECTION_COUNT; ++dir)
+            {
+                CellId cell = world.toCell({ x, y });
+                identical &= serial.getDistance(cell, dir) == parallel.getDistance(cell, dir);
+                identical &= serial.getDistance(cell, dir) == scheduled.getDistance(cell, dir);
+            }
+        }
+    }
+
+    check(identical, "jump table: parallel and scheduler builds equal single-threaded build");
+
+    check(parallel.save(path), "jump table: saved to disk");
+    check(!loaded.load(path, other), "jump table: rejected for a world with different obstacles");
+    check(loaded.load(path, world) && loaded.matches(world), "jump table: loaded for the same world");
+    check(loaded.getDistance(world.toCell({ 3, 5 }), 4) == parallel.getDistance(world.toCell({ 3, 5 }), 4),
+        "jump table: loaded distances match");
+
+    std::remove(path.c_str());
+}
+
+
+// ------------------------------
+// JPS+ TABLE FOLLOWS OBSTACLES
+// ------------------------------
+void testJumpPointTableStaleness()
+{
+    World world(40, 17);
+    World copy(40, 17);
+    Graph graph(&world);
+    Planner planner(graph);
+    JumpPointTable table;
+    State start{ 0, 8 };
+    State goal{ 39, 8 };
+    State free{ 0, 0 };
+
+    fillRandomObstacles(world, 20, 11);
+    fillRandomObstacles(copy, 20, 11);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+    copy.setWeight(start, World::FREE);
+    copy.setWeight(goal, World::FREE);
+    table.build(world, 2);
+    planner.setJumpPointTable(&table);
+
+    while (!world.isFree(free) || free == start)
+    {
+        free.x++;
+    }
+
+    world.setWeight(free, 3.0);
+    check(table.matches(world), "jump table: still valid after a weight change");
+    check(table.matches(copy), "jump table: valid for another world with the same obstacles");
+
+    // A wall across the world: JPS+ must not answer from the old distances
+    for (int y = 0; y < 17; ++y)
+    {
+        world.setWeight({ 20, y }, World::BLOCK);
+    }
+
+    check(!table.matches(world), "jump table: stale after obstacles change");
+    check(!planner.plan(start, goal, SearchType::JPSPlus).success, "jump table: stale table not used by JPS+");
+
+    for (int y = 0; y < 17; ++y)
+    {
+        world.setWeight({ 20, y }, copy.getWeight({ 20, y }));
+    }
+
+    check(table.matches(world), "jump table: valid again once the obstacles are restored");
+}
+
+
+// ------------------------------
+// JPS+ TABLE WORLD IDENTITY
+// ------------------------------
+void testJumpPointTableWorldIdentity()
+{
+    std::vector<World> slot;
+    JumpPointTable table;
+    const World* address = nullptr;
+
+    // Two worlds with the same obstacle version, one after the other at the same address
+    slot.reserve(1);
+    slot.emplace_back(30, 10);
+    address = &slot[0];
+
+    for (int x = 0; x < 10; ++x)
+    {
+        slot[0].setWeight({ x, 4 }, World::BLOCK);
+    }
+
+    table.build(slot[0], 1);
+    slot.clear();
+    slot.emplace_back(30, 10);
+
+    for (int x = 0; x < 10; ++x)
+    {
+        slot[0].setWeight({ x, 5 }, World::BLOCK);
+    }
+
+    check(&slot[0] == address, "jump table: new world reuses the address");
+    check(!table.matches(slot[0]), "jump table: not valid for a new world at the same address");
+
+    World copy(slot[0]);
+    check(copy.getInstanceId() != slot[0].getInstanceId(), "jump table: a copied world gets its own instance id");
+
+    table.build(slot[0], 1);
+    copy = slot[0];
+    check(table.matches(copy), "jump table: valid for an assigned copy with the same obstacles");
+}
+
+
+// --------------------
+// RUN JPS TESTS
+// --------------------
+void runJumpPointSearchTests()
+{
+    testHeader("JUMP POINT SEARCH TESTS");
+
+    testJPSOpenGrid();
+    testJPSMatchesDijkstra();
+    testJPSEdgeCases();
+    testJPSPlusMatchesDijkstra();
+    testJumpPointTableBuildAndStorage();
+    testJumpPointTableStaleness();
+    testJumpPointTableWorldIdentity();
+}
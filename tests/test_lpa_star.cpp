@@ -0,0 +1,153 @@
+#include "lpa_star.h"
+#include "planner.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <cmath>
+#include <vector>
+
+
+// ----------------------------------
+// NOTIFIED REPAIRS MATCH FRESH A*
+// ----------------------------------
+void testLPAStarFollowsWorldChanges()
+{
+    World world(70, 50);
+    Graph graph(&world);
+    Planner planner(graph);
+    LPAStar lpa(world, graph);
+    State start{ 1, 1 };
+    State goal{ 68, 47 };
+    bool costsMatch = true;
+    bool countsMatch = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    check(lpa.bind(start, goal) && lpa.getPendingChanges() == 0, "LPA*: binds a free pair");
+
+    auto first = lpa.replan();
+    check(first.success && std::abs(first.totalCost - planner.plan(start, goal, SearchType::Dijkstra).totalCost) < 1e-6,
+        "LPA*: initial path is optimal");
+
+    lpa.setCompareWithFresh(true);
+
+    // Congestion rises and falls: changes arrive only through World::setWeight
+    for (int round = 0; round < 10; ++round)
+    {
+        int changes = 0;
+
+        for (int k = 0; k < 12; ++k)
+        {
+            State cell{ (round * 41 + k * 19) % 70, (round * 13 + k * 31) % 50 };
+            double weight = (k % 5 == 0) ? World::BLOCK : 1.0 + ((round + k) % 6) * 1.5;
+
+            if (cell == start || cell == goal)
+            {
+                continue;
+            }
+
+            changes += (world.getWeight(cell) != weight) ? 1 : 0;
+            world.setWeight(cell, weight);
+        }
+
+        countsMatch &= lpa.getPendingChanges() <= static_cast<size_t>(changes) &&
+            (changes == 0 || lpa.getPendingChanges() > 0);
+
+        auto repaired = lpa.replan();
+        auto fresh = planner.plan(start, goal, SearchType::Dijkstra);
+
+        costsMatch &= repaired.success == fresh.success && (!fresh.success || std::abs(repaired.totalCost - fresh.totalCost) < 1e-6);
+        countsMatch &= lpa.getPendingChanges() == 0 && lpa.getLastRepair().freshExpanded > 0;
+    }
+
+    check(costsMatch, "LPA*: repaired costs equal fresh Dijkstra after notified changes");
+    check(countsMatch && lpa.getRepairCount() == 11, "LPA*: changed cells collected and repair statistics kept");
+}
+
+
+// ----------------------------------
+// REPAIR STATISTICS
+// ----------------------------------
+void testLPAStarRepairStatistics()
+{
+    World world(150, 150);
+    Graph graph(&world);
+    LPAStar lpa(world, graph);
+    State start{ 2, 3 };
+    State goal{ 146, 145 };
+    PlanResults path;
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+    lpa.bind(start, goal);
+    path = lpa.replan();
+
+    check(lpa.getLastRepair().freshExpanded == -1 && lpa.getLastRepair().nodesExpanded == path.nodesExpanded,
+        "LPA*: no fresh search unless enabled");
+
+    // Congestion on a cell of the path close to the start
+    lpa.setCompareWithFresh(true);
+    world.setWeight(path.path[10], 20.0);
+    path = lpa.replan();
+
+    const RepairStats& repair = lpa.getLastRepair();
+
+    check(path.success && repair.changedCells == 1 && repair.nodesUpdated > 0, "LPA*: repair records the changed cell");
+    check(repair.freshExpanded > 0 && repair.nodesExpanded * 10 < repair.freshExpanded,
+        "LPA*: repair touches far fewer cells than a fresh A*");
+
+    path = lpa.replan();
+    check(path.success && lpa.getLastRepair().changedCells == 0 && lpa.getLastRepair().nodesExpanded == 0,
+        "LPA*: no changes, no expansions");
+}
+
+
+// ----------------------------------
+// EDGE CASES
+// ----------------------------------
+void testLPAStarEdgeCases()
+{
+    World world(20, 10);
+    Graph graph(&world);
+
+    {
+        LPAStar lpa(world, graph);
+
+        check(!lpa.replan().success, "LPA*: unbound planner has no path");
+        check(!lpa.bind({ 0, 0 }, { 20, 0 }), "LPA*: invalid goal");
+
+        lpa.bind({ 0, 0 }, { 19, 9 });
+        lpa.replan();
+
+        for (int y = 0; y < 10; ++y)
+        {
+            world.setWeight({ 10, y }, World::BLOCK);
+        }
+
+        check(!lpa.replan().success, "LPA*: wall makes the goal unreachable");
+
+        world.clearGrid();
+        auto reopened = lpa.replan();
+        check(reopened.success && std::abs(reopened.totalCost - (10.0 + 9.0 * Graph::DIAGONAL_COST)) < 1e-9,
+            "LPA*: clearGrid notifications reopen the path");
+    }
+
+    // The destroyed planner must have unregistered itself
+    world.setWeight({ 5, 5 }, World::BLOCK);
+    check(!world.isFree({ 5, 5 }), "LPA*: world usable after the planner is destroyed");
+}
+
+
+// --------------------
+// RUN LPA* TESTS
+// --------------------
+void runLPAStarTests()
+{
+    testHeader("LPA* TESTS");
+
+    testLPAStarFollowsWorldChanges();
+    testLPAStarRepairStatistics();
+    testLPAStarEdgeCases();
+}
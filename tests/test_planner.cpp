@@ -4,10 +4,14 @@
 #include "state.h"
 #include "test_framework.h"
 #include "test_helper.h"
+#include "planner_context.h"
 #include <cmath>
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <thread>
+#include <chrono>
+#include <memory_resource>
 
 
 // -------------------------
@@ -329,6 +333,657 @@ void testCorrectnessFlags()
 }
 
 
+// ----------------------------------
+// HASHED AND DENSE ENGINES AGREE
+// ----------------------------------
+void testSearchEnginesAgree()
+{
+    World world(8, 8);
+    Graph graph(&world);
+    Planner hashed(graph, SearchEngine::Hashed);
+    Planner dense(graph, SearchEngine::Dense);
+    State start{ 0, 0 }, goal{ 7, 6 };
+    bool sameCost = true;
+    bool sameExpanded = true;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        world.setWeight({ i, (i * 3) % 8 }, 1.0 + i);
+        world.setWeight({ (i * 5) % 8, i }, 2.5);
+    }
+    world.setWeight({ 3, 3 }, World::BLOCK);
+    world.setWeight({ 4, 4 }, World::BLOCK);
+
+    for (SearchType type : { SearchType::BFS, SearchType::Dijkstra, SearchType::AStar })
+    {
+        auto a = hashed.plan(start, goal, type);
+        auto b = dense.plan(start, goal, type);
+
+        sameCost &= a.success && b.success && std::abs(a.totalCost - b.totalCost) < 1e-9;
+        sameExpanded &= a.nodesExpanded == b.nodesExpanded;
+    }
+
+    check(sameCost, "Hashed vs Dense engine: same path costs");
+    check(sameExpanded, "Hashed vs Dense engine: same expanded node counts");
+}
+
+
+// ----------------------------------
+// DENSE ENGINE REUSED ACROSS QUERIES
+// ----------------------------------
+void testDenseEngineReuse()
+{
+    World world(6, 6);
+    Graph graph(&world);
+    Planner planner(graph, SearchEngine::Dense);
+    State start{ 0, 0 }, goal{ 5, 5 };
+
+    auto first = planner.plan(start, goal, SearchType::Dijkstra);
+
+    // Wall off the goal; stale state from the first query must not leak
+    world.setWeight({ 4, 4 }, World::BLOCK);
+    world.setWeight({ 4, 5 }, World::BLOCK);
+    world.setWeight({ 5, 4 }, World::BLOCK);
+    auto second = planner.plan(start, goal, SearchType::Dijkstra);
+
+    world.clearGrid();
+    auto third = planner.plan(start, goal, SearchType::Dijkstra);
+
+    check(first.success && !second.success && second.path.empty(), "Dense engine: no stale state between queries");
+    checkDouble(third.totalCost, first.totalCost, "Dense engine: repeated query gives same cost");
+}
+
+
+// ----------------------------------
+// OPEN LIST TYPES AGREE
+// ----------------------------------
+void testOpenListsAgree()
+{
+    World world(10, 10);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 9, 8 };
+    bool sameCost = true;
+    bool noStalePops = true;
+
+    for (int y = 0; y < 10; ++y)
+    {
+        for (int x = 0; x < 10; ++x)
+        {
+            world.setWeight({ x, y }, 1.0 + ((x * 7 + y * 3) % 8));
+        }
+    }
+
+    for (SearchType type : { SearchType::Dijkstra, SearchType::AStar })
+    {
+        planner.setOpenList(OpenListType::BinaryHeap);
+        auto lazy = planner.plan(start, goal, type);
+
+        planner.setOpenList(OpenListType::IndexedHeap);
+        auto indexed = planner.plan(start, goal, type);
+
+        sameCost &= lazy.success && indexed.success && std::abs(lazy.totalCost - indexed.totalCost) < 1e-9;
+        noStalePops &= indexed.stalePops == 0 && indexed.peakOpenSize <= lazy.peakOpenSize;
+    }
+
+    check(sameCost, "BinaryHeap vs IndexedHeap: same path costs");
+    check(noStalePops, "IndexedHeap: no stale pops and smaller open list");
+}
+
+
+// ----------------------------------------
+// FIXED-POINT RADIX HEAP WITHIN TOLERANCE
+// ----------------------------------------
+void testRadixHeapWithinTolerance()
+{
+    World world(12, 12);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 11, 9 };
+    bool withinTolerance = true;
+
+    for (int y = 0; y < 12; ++y)
+    {
+        for (int x = 0; x < 12; ++x)
+        {
+            world.setWeight({ x, y }, 1.0 + ((x * 37 + y * 11) % 70) / 10.0);
+        }
+    }
+    world.setWeight({ 5, 5 }, World::BLOCK);
+    world.setWeight({ 6, 5 }, World::BLOCK);
+
+    for (SearchType type : { SearchType::Dijkstra, SearchType::AStar })
+    {
+        planner.setOpenList(OpenListType::BinaryHeap);
+        auto exact = planner.plan(start, goal, type);
+
+        planner.setOpenList(OpenListType::RadixHeap);
+        auto fixed = planner.plan(start, goal, type);
+
+        withinTolerance &= fixed.success && isValidPath(fixed.path, graph);
+        withinTolerance &= Planner::withinQuantizationTolerance(fixed, exact);
+    }
+
+    check(withinTolerance, "RadixHeap: fixed-point paths within quantization tolerance");
+}
+
+
+// ---------------------------------------
+// BIDIRECTIONAL SEARCHES MATCH DIJKSTRA
+// ---------------------------------------
+void testBidirectionalMatchesDijkstra()
+{
+    World world(15, 15);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 14, 12 };
+    bool sameCost = true;
+    bool validPaths = true;
+
+    for (int seed = 0; seed < 20; ++seed)
+    {
+        for (int y = 0; y < 15; ++y)
+        {
+            for (int x = 0; x < 15; ++x)
+            {
+                int hash = (x * 73 + y * 151 + seed * 37) % 97;
+                world.setWeight({ x, y }, (hash < 22) ? World::BLOCK : 1.0 + (hash % 8));
+            }
+        }
+        world.setWeight(start, World::FREE);
+        world.setWeight(goal, World::FREE);
+
+        auto dij = planner.plan(start, goal, SearchType::Dijkstra);
+
+        for (SearchType type : { SearchType::BidirectionalDijkstra, SearchType::BidirectionalAStar })
+        {
+            auto bi = planner.plan(start, goal, type);
+            double pathCost = 0.0;
+
+            sameCost &= (bi.success == dij.success);
+
+            if (!bi.success || !dij.success)
+            {
+                continue;
+            }
+
+            for (size_t i = 1; i < bi.path.size(); ++i)
+            {
+                pathCost += graph.getCost(bi.path[i - 1], bi.path[i]);
+            }
+
+            sameCost &= std::abs(bi.totalCost - dij.totalCost) < 1e-9;
+            validPaths &= isValidPath(bi.path, graph) && bi.path.front() == start && bi.path.back() == goal;
+            validPaths &= std::abs(pathCost - bi.totalCost) < 1e-9;
+        }
+    }
+
+    check(sameCost, "bidirectional: same cost as Dijkstra");
+    check(validPaths, "bidirectional: stitched path is valid and matches its cost");
+}
+
+
+// ----------------------------------
+// BIDIRECTIONAL SEARCHES EDGE CASES
+// ----------------------------------
+void testBidirectionalEdgeCases()
+{
+    World world(5, 5);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 0, 0 }, goal{ 4, 4 };
+
+    auto same = planner.plan(start, start, SearchType::BidirectionalAStar);
+
+    check(same.success && same.path.size() == 1, "bidirectional start==goal: path size 1");
+
+    for (int y = 0; y < 5; ++y)
+    {
+        world.setWeight({ 2, y }, World::BLOCK);
+    }
+
+    auto dij = planner.plan(start, goal, SearchType::BidirectionalDijkstra);
+    auto aStar = planner.plan(start, goal, SearchType::BidirectionalAStar);
+
+    check(!dij.success && dij.path.empty(), "bidirectional Dijkstra unreachable: no path");
+    check(!aStar.success && aStar.path.empty(), "bidirectional A* unreachable: no path");
+}
+
+
+// ----------------------------------------
+// BIDIRECTIONAL DIJKSTRA EXPANDS LESS
+// ----------------------------------------
+void testBidirectionalExpandsFewerNodes()
+{
+    World world(40, 40);
+    Graph graph(&world);
+    Planner planner(graph);
+    State start{ 5, 20 }, goal{ 34, 20 };
+
+    auto dij = planner.plan(start, goal, SearchType::Dijkstra);
+    auto biDij = planner.plan(start, goal, SearchType::BidirectionalDijkstra);
+
+    check(biDij.success && biDij.nodesExpanded < dij.nodesExpanded,
+        "bidirectional Dijkstra: fewer expansions on an open map");
+}
+
+
+// -------------------------------------------
+// PARALLEL BIDIRECTIONAL MATCHES SEQUENTIAL
+// -------------------------------------------
+void testParallelBidirectionalMatchesSequential()
+{
+    World world(30, 30);
+    Graph graph(&world);
+    Planner planner(graph);
+    bool sameResult = true;
+    bool validPaths = true;
+
+    for (int y = 0; y < 30; ++y)
+    {
+        for (int x = 0; x < 30; ++x)
+        {
+            int hash = (x * 31 + y * 17 + x * y) % 50;
+            world.setWeight({ x, y }, (hash < 12) ? World::BLOCK : 1.0 + (hash % 6));
+        }
+    }
+
+    for (int i = 0; i < 25; ++i)
+    {
+        State start{ (i * 7) % 30, (i * 11) % 30 };
+        State goal{ 29 - (i * 5) % 30, 29 - (i * 3) % 30 };
+
+        world.setWeight(start, World::FREE);
+        world.setWeight(goal, World::FREE);
+
+        for (SearchType type : { SearchType::BidirectionalDijkstra, SearchType::BidirectionalAStar })
+        {
+            planner.setBidirectionalMode(BidirectionalMode::Sequential);
+            auto sequential = planner.plan(start, goal, type);
+
+            planner.setBidirectionalMode(BidirectionalMode::Parallel);
+            auto parallel = planner.plan(start, goal, type);
+
+            sameResult &= (sequential.success == parallel.success);
+            sameResult &= std::abs(sequential.totalCost - parallel.totalCost) < 1e-9;
+
+            if (parallel.success)
+            {
+                validPaths &= isValidPath(parallel.path, graph) && parallel.path.front() == start &&
+                    parallel.path.back() == goal;
+            }
+        }
+    }
+
+    check(sameResult, "parallel bidirectional: same results as sequential");
+    check(validPaths, "parallel bidirectional: stitched paths are valid");
+}
+
+
+// ----------------------------------
+// PLAN BATCH MATCHES SINGLE QUERIES
+// ----------------------------------
+void testPlanBatchMatchesPlan()
+{
+    World world(20, 20);
+    Graph graph(&world);
+    Planner planner(graph);
+    std::vector<PlanQuery> queries;
+    bool sameResults = true;
+
+    for (int y = 0; y < 20; ++y)
+    {
+        for (int x = 0; x < 20; ++x)
+        {
+            int hash = (x * 13 + y * 29 + x * y) % 40;
+            world.setWeight({ x, y }, (hash < 8) ? World::BLOCK : 1.0 + (hash % 5));
+        }
+    }
+
+    for (int i = 0; i < 60; ++i)
+    {
+        State start{ (i * 3) % 20, (i * 7) % 20 };
+        State goal{ (i * 11 + 5) % 20, (i * 17 + 2) % 20 };
+        SearchType type = (i % 3 == 0) ? SearchType::Dijkstra : (i % 3 == 1) ? SearchType::AStar : SearchType::BFS;
+
+        world.setWeight(start, World::FREE);
+        world.setWeight(goal, World::FREE);
+        queries.push_back({ start, goal, type });
+    }
+
+    planner.setBatchThreads(3);
+    auto batch = planner.planBatch(queries);
+
+    planner.setBatchScheduler(BatchScheduler::WorkStealing);
+    auto stolen = planner.planBatch(queries);
+
+    sameResults &= batch.results.size() == queries.size() && stolen.results.size() == queries.size();
+
+    for (size_t i = 0; i < queries.size() && sameResults; ++i)
+    {
+        auto single = planner.plan(queries[i].start, queries[i].goal, queries[i].type);
+
+        sameResults &= single.success == batch.results[i].success && single.success == stolen.results[i].success;
+        sameResults &= std::abs(single.totalCost - batch.results[i].totalCost) < 1e-9;
+        sameResults &= single.path == batch.results[i].path && single.path == stolen.results[i].path;
+    }
+
+    check(sameResults, "planBatch: results in input order, equal to single queries (both schedulers)");
+    check(stolen.workerStats.size() == 3, "planBatch: work stealing reports stats for every worker");
+    check(batch.latencyP50 <= batch.latencyP90 && batch.latencyP90 <= batch.latencyP99 &&
+        batch.latencyP99 <= batch.latencyMax, "planBatch: latency percentiles ordered");
+}
+
+
+// ----------------------------------
+// PLANNER CONTEXT REUSE
+// ----------------------------------
+void testPlannerContextReuse()
+{
+    World world(12, 12);
+    Graph graph(&world);
+    Planner planner(graph);
+    PlannerContext context;
+    PlannerContext* mainContext = &PlannerContext::forThisThread();
+    PlannerContext* otherContext = nullptr;
+    const SearchType types[] = { SearchType::BFS, SearchType::Dijkstra, SearchType::AStar,
+        SearchType::BidirectionalAStar, SearchType::JPS };
+    bool sameResults = true;
+
+    for (int y = 2; y < 10; ++y)
+    {
+        world.setWeight({ 6, y }, World::BLOCK);
+    }
+
+    // One context shared by different search types and queries, including a failed one
+    for (int i = 0; i < 20; ++i)
+    {
+        State start{ i % 12, (i * 5) % 12 };
+        State goal{ (i * 7 + 3) % 12, (i * 3 + 1) % 12 };
+        SearchType type = types[i % 5];
+
+        if (!world.isFree(start) || !world.isFree(goal))
+        {
+            continue;
+        }
+
+        auto reference = planner.plan(start, goal, type);
+        auto reused = planner.plan(start, goal, type, context);
+
+        sameResults &= reference.success == reused.success && reference.path == reused.path;
+        sameResults &= std::abs(reference.totalCost - reused.totalCost) < 1e-9;
+    }
+
+    std::thread([&otherContext]() { otherContext = &PlannerContext::forThisThread(); }).join();
+
+    check(sameResults, "PlannerContext: explicit context gives the same results as plan()");
+    check(mainContext == &PlannerContext::forThisThread() && otherContext != mainContext,
+        "PlannerContext: one pooled context per thread");
+}
+
+
+// ----------------------------------
+// PLAN INTO CALLER PATH
+// ----------------------------------
+void testPlanIntoCallerPath()
+{
+    World world(15, 15);
+    Graph graph(&world);
+    Planner planner(graph, SearchEngine::Hashed);
+    PlannerContext context;
+    std::pmr::monotonic_buffer_resource callerArena;
+    std::pmr::vector<State> path(&callerArena);
+    const SearchType types[] = { SearchType::BFS, SearchType::AStar, SearchType::BidirectionalDijkstra, SearchType::JPS };
+    bool samePaths = true;
+    bool resultPathEmpty = true;
+
+    for (int x = 0; x < 12; ++x)
+    {
+        world.setWeight({ x, 7 }, World::BLOCK);
+    }
+
+    for (int i = 0; i < 12; ++i)
+    {
+        State start{ i, 0 };
+        State goal{ 14 - i, 14 };
+        SearchType type = types[i % 4];
+
+        auto reference = planner.plan(start, goal, type);
+        auto buffered = planner.plan(start, goal, type, context, path);
+
+        samePaths &= reference.success == buffered.success && std::abs(reference.totalCost - buffered.totalCost) < 1e-9;
+        samePaths &= std::equal(reference.path.begin(), reference.path.end(), path.begin(), path.end());
+        resultPathEmpty &= buffered.path.empty();
+    }
+
+    world.setWeight({ 12, 7 }, World::BLOCK);
+    world.setWeight({ 13, 7 }, World::BLOCK);
+    world.setWeight({ 14, 7 }, World::BLOCK);
+    auto blocked = planner.plan({ 0, 0 }, { 0, 14 }, SearchType::AStar, context, path);
+
+    check(samePaths, "plan into caller path: same path and cost as plan() (Hashed engine on the arena)");
+    check(resultPathEmpty, "plan into caller path: PlanResults::path stays empty");
+    check(!blocked.success && path.empty(), "plan into caller path: buffer cleared when no path exists");
+}
+
+
+// ----------------------------------
+// PLAN TO NEAREST MATCHES MINIMUM
+// ----------------------------------
+void testPlanToNearestMatchesMinimum()
+{
+    World world(40, 30);
+    Graph graph(&world);
+    Planner planner(graph);
+    Planner hashed(graph, SearchEngine::Hashed);
+    std::vector<State> chargers;
+    bool nearestFound = true;
+    bool sameAsScan = true;
+    bool enginesAgree = true;
+    bool fewerExpansions = true;
+
+    for (int y = 0; y < 30; ++y)
+    {
+        for (int x = 0; x < 40; ++x)
+        {
+            int hash = (x * 31 + y * 17 + x * y * 7) % 50;
+            world.setWeight({ x, y }, (hash < 9) ? World::BLOCK : 1.0 + (hash % 7) * 0.75);
+        }
+    }
+
+    for (int i = 0; static_cast<int>(chargers.size()) < 24; ++i)
+    {
+        State charger{ (i * 13 + 3) % 40, (i * 7 + 2) % 30 };
+
+        if (world.isFree(charger))
+        {
+            chargers.push_back(charger);
+        }
+    }
+
+    for (int i = 0; i < 25; ++i)
+    {
+        State start{ (i * 11 + 5) % 40, (i * 17 + 9) % 30 };
+        double best = -1.0;
+
+        if (!world.isFree(start))
+        {
+            continue;
+        }
+
+        // Reference: one query per charger
+        for (const State& charger : chargers)
+        {
+            auto single = planner.plan(start, charger, SearchType::Dijkstra);
+
+            if (single.success && (best < 0.0 || single.totalCost < best))
+            {
+                best = single.totalCost;
+            }
+        }
+
+        planner.setGoalFieldThreshold(1000);
+        auto scan = planner.planToNearest(start, chargers, SearchType::AStar);
+        planner.setGoalFieldThreshold(0);
+        auto field = planner.planToNearest(start, chargers, SearchType::AStar);
+        auto dijkstra = planner.planToNearest(start, chargers, SearchType::Dijkstra);
+        auto viaHash = hashed.planToNearest(start, chargers, SearchType::AStar);
+
+        nearestFound &= field.success && std::abs(field.totalCost - best) < 1e-9 && field.reachedGoal >= 0 &&
+            field.path.front() == start && field.path.back() == chargers[field.reachedGoal] && isValidPath(field.path, graph);
+        nearestFound &= dijkstra.success && std::abs(dijkstra.totalCost - best) < 1e-9;
+        sameAsScan &= scan.path == field.path && scan.nodesExpanded == field.nodesExpanded;
+        enginesAgree &= viaHash.path == field.path && viaHash.reachedGoal == field.reachedGoal;
+        fewerExpansions &= field.nodesExpanded <= dijkstra.nodesExpanded;
+    }
+
+    check(nearestFound, "planToNearest: reaches the nearest goal at the minimum pairwise cost");
+    check(sameAsScan, "planToNearest: goal distance field and goal scan give the same search");
+    check(enginesAgree, "planToNearest: Dense and Hashed engines agree");
+    check(fewerExpansions, "planToNearest: A* expands no more nodes than Dijkstra");
+}
+
+
+// ----------------------------------
+// PLAN TO NEAREST EDGE CASES
+// ----------------------------------
+void testPlanToNearestEdgeCases()
+{
+    World world(20, 10);
+    Graph graph(&world);
+    Planner planner(graph);
+
+    // Wall at x = 10 splits the world
+    for (int y = 0; y < 10; ++y)
+    {
+        world.setWeight({ 10, y }, World::BLOCK);
+    }
+
+    auto onGoal = planner.planToNearest({ 2, 2 }, { { 15, 5 }, { 2, 2 } });
+    auto skipInvalid = planner.planToNearest({ 0, 0 }, { { -1, 3 }, { 10, 0 }, { 15, 0 }, { 5, 0 }, { 5, 0 } });
+    auto unreachable = planner.planToNearest({ 0, 0 }, { { 15, 5 }, { 19, 9 } });
+    auto noGoal = planner.planToNearest({ 0, 0 }, { { 10, 3 }, { 25, 3 } });
+    auto wrongType = planner.planToNearest({ 0, 0 }, { { 5, 0 } }, SearchType::BFS);
+
+    check(onGoal.success && onGoal.reachedGoal == 1 && onGoal.path.size() == 1, "planToNearest: start on a goal");
+    check(skipInvalid.success && skipInvalid.reachedGoal == 3 && skipInvalid.totalCost == 5.0,
+        "planToNearest: invalid, blocked and unreachable goals are skipped");
+    check(!unreachable.success && unreachable.reachedGoal == -1 && unreachable.path.empty(), "planToNearest: no reachable goal");
+    check(!noGoal.success && !wrongType.success, "planToNearest: no free goal and unsupported search type fail");
+    check(planner.plan({ 0, 0 }, { 5, 0 }, SearchType::AStar).reachedGoal == 0, "plan: single goal reports goal index 0");
+}
+
+
+// ----------------------------------
+// PLAN WITHIN LIMITS
+// ----------------------------------
+void testPlanWithinLimits()
+{
+    World world(120, 120);
+    Graph graph(&world);
+    Planner planner(graph);
+    Planner radix(graph);
+    State start{ 5, 60 };
+    State goal{ 115, 60 };
+    SearchLimits expansions;
+    SearchLimits generous;
+    double partialCost = 0.0;
+
+    radix.setOpenList(OpenListType::RadixHeap);
+
+    // Closed box around the goal: without limits the search exhausts everything else
+    for (int i = 100; i <= 119; ++i)
+    {
+        world.setWeight({ i, 40 }, World::BLOCK);
+        world.setWeight({ i, 80 }, World::BLOCK);
+    }
+    for (int y = 40; y <= 80; ++y)
+    {
+        world.setWeight({ 100, y }, World::BLOCK);
+    }
+
+    auto unlimited = planner.plan(start, goal, SearchType::AStar);
+
+    expansions.maxExpansions = 500;
+    auto limited = planner.plan(start, goal, SearchType::AStar, expansions);
+    auto limitedRadix = radix.plan(start, goal, SearchType::Dijkstra, expansions);
+
+    for (size_t i = 1; i < limited.path.size(); ++i)
+    {
+        partialCost += graph.getCost(limited.path[i - 1], limited.path[i]);
+    }
+
+    check(!unlimited.success && !unlimited.truncated && unlimited.stopReason == SearchStop::Completed && unlimited.path.empty(),
+        "limits: unlimited search exhausts the reachable cells");
+    check(!limited.success && limited.truncated && limited.stopReason == SearchStop::ExpansionLimit &&
+        limited.nodesExpanded == 500, "limits: expansion limit stops the search");
+    check(limited.path.size() > 1 && limited.path.front() == start && isValidPath(limited.path, graph) &&
+        std::abs(limited.path.back().x - goal.x) < std::abs(start.x - goal.x) && std::abs(partialCost - limited.totalCost) < 1e-9,
+        "limits: partial path leads toward the goal and reports its cost");
+    check(limitedRadix.truncated && limitedRadix.nodesExpanded == 500 && isValidPath(limitedRadix.path, graph),
+        "limits: RadixHeap Dijkstra is truncated as well");
+
+    // Limits that are not hit leave the result unchanged
+    generous.maxExpansions = 1000000;
+    generous.timeBudget = 60000.0;
+    world.setWeight({ 100, 60 }, World::FREE);
+
+    auto reference = planner.plan(start, goal, SearchType::AStar);
+    auto withinBudget = planner.plan(start, goal, SearchType::AStar, generous);
+
+    check(withinBudget.success && !withinBudget.truncated && withinBudget.path == reference.path &&
+        withinBudget.nodesExpanded == reference.nodesExpanded, "limits: search within budget equals the unlimited search");
+}
+
+
+// ----------------------------------
+// PLAN DEADLINE AND CANCELLATION
+// ----------------------------------
+void testPlanDeadlineAndCancellation()
+{
+    World world(600, 600);
+    Graph graph(&world);
+    Planner planner(graph);
+    CancellationToken token;
+    SearchLimits deadline;
+    SearchLimits cancellable;
+    State start{ 0, 0 };
+    State goal{ 599, 599 };
+
+    // The goal is walled in, so every search would expand the whole world
+    world.setWeight({ 598, 599 }, World::BLOCK);
+    world.setWeight({ 598, 598 }, World::BLOCK);
+    world.setWeight({ 599, 598 }, World::BLOCK);
+
+    deadline.timeBudget = 1.0;
+    auto late = planner.plan(start, goal, SearchType::Dijkstra, deadline);
+
+    check(late.truncated && late.stopReason == SearchStop::Deadline && late.nodesExpanded < 600 * 600 &&
+        late.path.front() == start, "limits: deadline stops the search");
+
+    cancellable.cancel = &token;
+    token.cancel();
+    auto cancelled = planner.plan(start, goal, SearchType::AStar, cancellable);
+
+    check(cancelled.truncated && cancelled.stopReason == SearchStop::Cancelled && cancelled.nodesExpanded == 0 &&
+        cancelled.path.size() == 1, "limits: cancelled token stops the search before the first expansion");
+
+    // Cancel from another thread while the search runs
+    token.reset();
+    std::thread canceller([&token]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        token.cancel();
+    });
+
+    auto interrupted = planner.plan(start, goal, SearchType::Dijkstra, cancellable);
+    canceller.join();
+
+    check(interrupted.truncated && interrupted.stopReason == SearchStop::Cancelled && interrupted.nodesExpanded < 600 * 600,
+        "limits: cancellation from another thread stops the search");
+}
+
+
 // --------------------
 // PLANNER RUN TESTS
 // --------------------
@@ -349,4 +1004,19 @@ void runPlannerTests()
     testNodesExpanded();
     testPlannerFullyBlockedWorld();
     testCorrectnessFlags();
+    testSearchEnginesAgree();
+    testDenseEngineReuse();
+    testOpenListsAgree();
+    testRadixHeapWithinTolerance();
+    testBidirectionalMatchesDijkstra();
+    testBidirectionalEdgeCases();
+    testBidirectionalExpandsFewerNodes();
+    testParallelBidirectionalMatchesSequential();
+    testPlanBatchMatchesPlan();
+    testPlannerContextReuse();
+    testPlanIntoCallerPath();
+    testPlanToNearestMatchesMinimum();
+    testPlanToNearestEdgeCases();
+    testPlanWithinLimits();
+    testPlanDeadlineAndCancellation();
 }
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include "query_arena.h"
+#include "test_framework.h"
+#include <memory_resource>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+
+// -------------------------
+// COUNTING RESOURCE - HELPER
+// -------------------------
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    int allocations = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* memory, size_t bytes, size_t alignment) override
+    {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+
+// --------------------
+// GROWS AFTER OVERFLOW
+// --------------------
+void testQueryArenaGrowsAfterOverflow()
+{
+    CountingResource upstream;
+    int afterFirstQuery = 0;
+    bool allocated = true;
+
+    {
+        QueryArena arena(&upstream);
+
+        // First query: the empty arena takes everything from upstream
+        for (int i = 0; i < 10; ++i)
+        {
+            allocated &= arena.allocate(100, 8) != nullptr;
+        }
+
+        check(arena.getUsed() == 1000 && upstream.allocations > 0, "query arena: overflow is served by upstream");
+
+        arena.reset();
+        afterFirstQuery = upstream.allocations;
+
+        check(arena.getCapacity() >= 1000 && arena.getUsed() == 0, "query arena: reset grows the buffer to the last query");
+
+        // Same query again: served from the buffer only
+        for (int i = 0; i < 10; ++i)
+        {
+            allocated &= arena.allocate(100, 8) != nullptr;
+        }
+        arena.reset();
+
+        check(allocated && upstream.allocations == afterFirstQuery, "query arena: warm query does not use upstream");
+    }
+
+    check(upstream.allocations == upstream.deallocations, "query arena: all upstream memory returned on destruction");
+}
+
+
+// --------------------
+// CHANGE OF UPSTREAM
+// --------------------
+void testQueryArenaSetUpstream()
+{
+    CountingResource first;
+    CountingResource second;
+    bool allocated = true;
+
+    {
+        QueryArena arena(&first);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            allocated &= arena.allocate(100, 8) != nullptr;
+        }
+
+        arena.setUpstream(&second);
+        check(first.allocations > 0 && first.allocations == first.deallocations,
+            "query arena: setUpstream returns all memory to the old upstream");
+
+        first.allocations = 0;
+
+        // Overflow bookkeeping must come from the new resource, too
+        for (int i = 0; i < 40; ++i)
+        {
+            allocated &= arena.allocate(100, 8) != nullptr;
+        }
+
+        arena.reset();
+        check(allocated && arena.getUpstream() == &second && first.allocations == 0 && second.allocations > 0,
+            "query arena: after setUpstream all memory comes from the new upstream");
+    }
+
+    check(second.allocations == second.deallocations, "query arena: new upstream fully released on destruction");
+}
+
+
+// --------------------
+// ALIGNMENT
+// --------------------
+void testQueryArenaAlignment()
+{
+    QueryArena arena;
+    void* memory = arena.allocate(4096, 8);
+    bool aligned = memory != nullptr;
+
+    arena.reset();
+
+    for (size_t alignment = 1; alignment <= alignof(std::max_align_t); alignment *= 2)
+    {
+        aligned &= arena.allocate(3, 1) != nullptr;
+        memory = arena.allocate(8, alignment);
+        aligned &= reinterpret_cast<std::uintptr_t>(memory) % alignment == 0;
+    }
+
+    check(aligned, "query arena: allocations respect the requested alignment");
+}
+
+
+// --------------------
+// PMR CONTAINERS
+// --------------------
+void testQueryArenaWithContainers()
+{
+    CountingResource upstream;
+    QueryArena arena(&upstream);
+    bool sameContents = true;
+    int warmAllocations = 0;
+
+    for (int query = 0; query < 3; ++query)
+    {
+        arena.reset();
+
+        std::pmr::unordered_map<int, int> map(&arena);
+
+        for (int i = 0; i < 500; ++i)
+        {
+            map[i] = i * i;
+        }
+
+        for (int i = 0; i < 500; ++i)
+        {
+            sameContents &= map[i] == i * i;
+        }
+
+        if (query == 1)
+        {
+            warmAllocations = upstream.allocations;
+        }
+    }
+
+    check(sameContents, "query arena: backs std::pmr containers");
+    check(upstream.allocations == warmAllocations, "query arena: repeated container workload stays in the buffer");
+}
+
+
+// --------------------
+// RUN QUERY ARENA TESTS
+// --------------------
+void runQueryArenaTests()
+{
+    testHeader("QUERY ARENA TESTS");
+
+    testQueryArenaGrowsAfterOverflow();
+    testQueryArenaSetUpstream();
+    testQueryArenaAlignment();
+    testQueryArenaWithContainers();
+}
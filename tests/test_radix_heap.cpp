@@ -0,0 +1,75 @@
+#include "radix_heap.h"
+#include "test_framework.h"
+#include <vector>
+
+
+// --------------------
+// RADIX HEAP ORDERING
+// --------------------
+void testRadixHeapOrdering()
+{
+    RadixHeap heap;
+    std::vector<double> keys = { 5000, 1414, 9000, 3000, 7071, 0, 4000, 8000, 2828, 6000 };
+    std::vector<CellId> popped;
+    bool sorted = true;
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        heap.push(static_cast<CellId>(i), keys[i]);
+    }
+
+    check(heap.size() == keys.size(), "radix heap: size after pushes");
+
+    while (!heap.empty())
+    {
+        popped.push_back(heap.pop());
+    }
+
+    for (size_t i = 1; i < popped.size(); ++i)
+    {
+        sorted &= keys[popped[i - 1]] <= keys[popped[i]];
+    }
+
+    check(sorted, "radix heap: pops in non-decreasing key order");
+}
+
+
+// -----------------------------
+// MONOTONE PUSHES BETWEEN POPS
+// -----------------------------
+void testRadixHeapMonotonePushes()
+{
+    RadixHeap heap;
+    bool ordered = true;
+
+    heap.push(0, 10);
+    heap.push(1, 40);
+    ordered &= heap.pop() == 0;
+
+    // New keys are >= the last popped key (10)
+    heap.push(2, 25);
+    heap.push(3, 10);
+    ordered &= heap.pop() == 3;
+    ordered &= heap.pop() == 2;
+    ordered &= heap.pop() == 1;
+
+    check(ordered && heap.empty(), "radix heap: interleaved monotone pushes and pops");
+
+    heap.push(4, 50);
+    heap.clear();
+    heap.push(5, 1);
+
+    check(heap.size() == 1 && heap.pop() == 5, "radix heap: clear resets the lower bound");
+}
+
+
+// --------------------
+// RUN RADIX HEAP TESTS
+// --------------------
+void runRadixHeapTests()
+{
+    testHeader("RADIX HEAP TESTS");
+
+    testRadixHeapOrdering();
+    testRadixHeapMonotonePushes();
+}
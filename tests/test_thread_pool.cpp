@@ -0,0 +1,74 @@
+#include "thread_pool.h"
+#include "test_framework.h"
+#include <atomic>
+#include <vector>
+
+
+// --------------------------
+// THREAD POOL RUNS ALL TASKS
+// --------------------------
+void testThreadPoolRunsAllTasks()
+{
+    ThreadPool pool(4);
+    std::vector<int> done(1000, 0);
+    std::atomic<bool> validWorker(true);
+    bool allDone = true;
+
+    for (size_t i = 0; i < done.size(); ++i)
+    {
+        pool.submit([&, i](unsigned int worker)
+        {
+            if (worker >= pool.size())
+            {
+                validWorker = false;
+            }
+            done[i]++;
+        });
+    }
+
+    pool.wait();
+
+    for (int count : done)
+    {
+        allDone &= (count == 1);
+    }
+
+    check(pool.size() == 4, "thread pool: requested worker count");
+    check(allDone, "thread pool: every task ran exactly once before wait() returned");
+    check(validWorker, "thread pool: worker index within pool size");
+}
+
+
+// ------------------------
+// THREAD POOL REUSE
+// ------------------------
+void testThreadPoolReuse()
+{
+    ThreadPool pool(2);
+    std::atomic<int> counter(0);
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            pool.submit([&](unsigned int) { counter++; });
+        }
+        pool.wait();
+    }
+
+    pool.wait();
+
+    check(counter == 150, "thread pool: reusable across several wait() rounds");
+}
+
+
+// ----------------------
+// THREAD POOL RUN TESTS
+// ----------------------
+void runThreadPoolTests()
+{
+    testHeader("THREAD POOL TESTS");
+
+    testThreadPoolRunsAllTasks();
+    testThreadPoolReuse();
+}
@@ -0,0 +1,213 @@
+#include "versioned_world.h"
+#include "snapshot_reader.h"
+#include "test_framework.h"
+#include "test_helper.h"
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+
+// ----------------------------------
+// COPY-ON-WRITE TILES AND VERSIONS
+// ----------------------------------
+void testVersionedWorldCopyOnWrite()
+{
+    World world(150, 100);   // 3 x 2 tiles, the last column and row partial
+    fillWeightedMaze(world);
+
+    VersionedWorld versioned(world);
+    auto first = versioned.pin();
+    bool sameWeights = true;
+
+    for (int y = 0; y < 100; ++y)
+    {
+        for (int x = 0; x < 150; ++x)
+        {
+            sameWeights &= first->getWeight({ x, y }) == world.getWeight({ x, y });
+        }
+    }
+
+    check(first->getVersion() == 1 && first->getTileCount() == 6, "versioned world: version 1 split into tiles");
+    check(sameWeights && first->getWeight({ 150, 0 }) == World::BLOCK, "versioned world: snapshot holds the world's weights");
+    check(versioned.publish() == 1, "versioned world: publish without changes keeps the version");
+
+    // Two changes in tile 0, one in tile 5
+    versioned.setWeight({ 3, 4 }, 9.0);
+    versioned.setWeight({ 60, 60 }, World::BLOCK);
+    versioned.setWeight({ 149, 99 }, -5.0);
+    check(!versioned.setWeight({ 150, 0 }, 2.0), "versioned world: out-of-bounds write rejected");
+    check(versioned.pin() == first, "versioned world: changes invisible before publish");
+
+    check(versioned.publish() == 2 && versioned.getLastCopiedTiles() == 2, "versioned world: only touched tiles copied");
+
+    auto second = versioned.pin();
+    bool sharing = true;
+
+    for (int i = 1; i < 5; ++i)
+    {
+        sharing &= second->getTile(i) == first->getTile(i);
+    }
+
+    check(sharing && second->getTile(0) != first->getTile(0) && second->getTile(5) != first->getTile(5),
+        "versioned world: untouched tiles shared between versions");
+    check(second->getWeight({ 3, 4 }) == 9.0 && !second->isFree({ 60, 60 }) && second->getWeight({ 149, 99 }) == World::BLOCK,
+        "versioned world: new version holds the changes");
+    check(first->getWeight({ 3, 4 }) == world.getWeight({ 3, 4 }) && first->getWeight({ 60, 60 }) == world.getWeight({ 60, 60 }),
+        "versioned world: pinned version unchanged by later writes");
+
+    // Writing unchanged weights copies nothing and publishes no version
+    versioned.setWeight({ 3, 4 }, 9.0);
+    versioned.setWeight({ 60, 60 }, -2.0);
+    check(versioned.publish() == 2 && versioned.pin() == second, "versioned world: unchanged weights copy no tile");
+
+    // A published tile is copied again by the next write
+    versioned.setWeight({ 5, 5 }, 2.0);
+    versioned.publish();
+    check(versioned.pin()->getTile(0) != second->getTile(0) && second->getWeight({ 5, 5 }) != 2.0,
+        "versioned world: published tiles never written in place");
+}
+
+
+// ----------------------------------
+// READER COPIES ONLY CHANGED TILES
+// ----------------------------------
+void testSnapshotReaderRefresh()
+{
+    World world(200, 130);
+    State start{ 1, 1 };
+    State goal{ 197, 127 };
+    bool costsMatch = true;
+
+    fillWeightedMaze(world);
+    world.setWeight(start, World::FREE);
+    world.setWeight(goal, World::FREE);
+
+    VersionedWorld versioned(world);
+    SnapshotReader reader(versioned);
+    Graph graph(&world);
+    Planner fresh(graph);
+
+    check(reader.getVersion() == 1 && reader.getLastCopiedTiles() == 12, "snapshot reader: first load copies every tile");
+    check(!reader.refresh() && reader.getLastCopiedTiles() == 0, "snapshot reader: nothing to copy without a new version");
+
+    for (int round = 0; round < 6; ++round)
+    {
+        // Changes in tiles 0 and 6 only
+        for (int k = 0; k < 10; ++k)
+        {
+            State near{ 10 + (round * 7 + k * 3) % 50, 5 + k * 5 };
+            State far{ 130 + (round * 11 + k * 5) % 60, 70 + k * 5 };
+            double weight = (k % 4 == 0) ? World::BLOCK : 1.0 + ((round + k) % 5) * 1.5;
+
+            versioned.setWeight(near, weight);
+            versioned.setWeight(far, weight);
+            world.setWeight(near, weight);
+            world.setWeight(far, weight);
+        }
+
+        auto before = reader.plan(start, goal, SearchType::Dijkstra);
+        versioned.publish();
+        costsMatch &= reader.plan(start, goal, SearchType::Dijkstra).totalCost == before.totalCost;
+
+        reader.refresh();
+        auto after = reader.plan(start, goal, SearchType::Dijkstra);
+        auto expected = fresh.plan(start, goal, SearchType::Dijkstra);
+
+        costsMatch &= reader.getLastCopiedTiles() == 2 && after.success == expected.success &&
+            (!expected.success || std::abs(after.totalCost - expected.totalCost) < 1e-9);
+    }
+
+    check(costsMatch, "snapshot reader: refresh copies the 2 changed tiles and plans like the world");
+    check(reader.getVersion() == 7 && reader.getWorld().getEpoch() > 0, "snapshot reader: private world follows versions");
+}
+
+
+// ----------------------------------
+// CONCURRENT WRITER AND READERS
+// ----------------------------------
+void testVersionedWorldConcurrentReaders()
+{
+    const int ROW = 65;          // Row crossing four tiles
+    const int VERSIONS = 60;
+    World world(200, 130);
+    VersionedWorld versioned(world);
+    std::atomic<bool> writing{ true };
+    std::atomic<int> torn{ 0 };
+    std::atomic<int> failed{ 0 };
+    std::atomic<int> queries{ 0 };
+    std::vector<std::thread> readers;
+
+    // Version v gives the whole row weight v: a reader must never see two values in it
+    for (int r = 0; r < 2; ++r)
+    {
+        readers.emplace_back([&]()
+        {
+            SnapshotReader reader(versioned);
+            bool last = false;
+
+            while (!last)
+            {
+                last = !writing.load();
+                reader.refresh();
+
+                double expected = static_cast<double>(reader.getVersion());
+
+                for (int x = 0; x < 200; ++x)
+                {
+                    if (reader.getWorld().getWeight({ x, ROW }) != expected)
+                    {
+                        torn++;
+                        break;
+                    }
+                }
+
+                if (!reader.plan({ 0, 0 }, { 199, 129 }, SearchType::AStar).success)
+                {
+                    failed++;
+                }
+
+                queries++;
+            }
+
+            if (reader.getVersion() != static_cast<std::uint64_t>(VERSIONS))
+            {
+                failed++;
+            }
+        });
+    }
+
+    for (int v = 2; v <= VERSIONS; ++v)
+    {
+        for (int x = 0; x < 200; ++x)
+        {
+            versioned.setWeight({ x, ROW }, static_cast<double>(v));
+        }
+
+        versioned.publish();
+        std::this_thread::yield();
+    }
+
+    writing = false;
+
+    for (auto& thread : readers)
+    {
+        thread.join();
+    }
+
+    check(torn == 0, "versioned world: readers never see a partly published version");
+    check(failed == 0 && queries >= 2, "versioned world: queries succeed during writes and readers reach the last version");
+}
+
+
+// -------------------------------
+// RUN VERSIONED WORLD TESTS
+// -------------------------------
+void runVersionedWorldTests()
+{
+    testHeader("VERSIONED WORLD TESTS");
+
+    testVersionedWorldCopyOnWrite();
+    testSnapshotReaderRefresh();
+    testVersionedWorldConcurrentReaders();
+}
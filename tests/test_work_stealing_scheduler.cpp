@@ -0,0 +1,240 @@
+#include "work_stealing_scheduler.h"
+#include "test_framework.h"
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <functional>
+
+
+// -------------------------------
+// SCHEDULER RUNS ALL TASKS ONCE
+// -------------------------------
+void testSchedulerRunsAllTasks()
+{
+    WorkStealingScheduler scheduler(4);
+    std::vector<int> done(1000, 0);
+    size_t executed = 0;
+    bool allDone = true;
+
+    for (size_t i = 0; i < done.size(); ++i)
+    {
+        scheduler.submit([&, i](unsigned int) { done[i]++; });
+    }
+
+    scheduler.wait();
+
+    for (int count : done)
+    {
+        allDone &= (count == 1);
+    }
+
+    for (const auto& stats : scheduler.getStats())
+    {
+        executed += stats.tasksExecuted;
+    }
+
+    check(allDone, "scheduler: every task ran exactly once before wait() returned");
+    check(executed == done.size(), "scheduler: executed task counts add up");
+}
+
+
+// ----------------------------
+// SCHEDULER NESTED SUBMIT
+// ----------------------------
+void testSchedulerNestedSubmit()
+{
+    WorkStealingScheduler scheduler(3);
+    std::atomic<int> leaves(0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        scheduler.submit([&](unsigned int)
+        {
+            for (int j = 0; j < 10; ++j)
+            {
+                scheduler.submit([&](unsigned int) { leaves++; });
+            }
+        });
+    }
+
+    scheduler.wait();
+
+    check(leaves == 100, "scheduler: tasks submitted from tasks finish before wait() returns");
+}
+
+
+// ----------------------------
+// SCHEDULER STEALS WORK
+// ----------------------------
+void testSchedulerStealsWork()
+{
+    WorkStealingScheduler scheduler(4);
+    size_t steals = 0;
+    size_t busyWorkers = 0;
+
+    // Everything lands on worker 0; the other workers can only get work by stealing
+    for (int i = 0; i < 40; ++i)
+    {
+        scheduler.submitTo(0, [](unsigned int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    }
+
+    scheduler.wait();
+
+    for (const auto& stats : scheduler.getStats())
+    {
+        steals += stats.steals;
+        busyWorkers += (stats.tasksExecuted > 0) ? 1 : 0;
+    }
+
+    check(steals > 0 && busyWorkers > 1, "scheduler: idle workers steal from a loaded worker");
+
+    scheduler.resetStats();
+    check(scheduler.getStats()[0].tasksExecuted == 0, "scheduler: resetStats clears counters");
+}
+
+
+// ---------------------------
+// SCHEDULER PARALLEL FOR
+// ---------------------------
+void testSchedulerParallelFor()
+{
+    WorkStealingScheduler scheduler(4);
+    std::vector<int> visits(997, 0);
+    bool exactlyOnce = true;
+
+    scheduler.parallelFor(static_cast<int>(visits.size()), 0, [&](int begin, int end, unsigned int)
+    {
+        for (int i = begin; i < end; ++i)
+        {
+            visits[i]++;
+        }
+    });
+
+    for (int count : visits)
+    {
+        exactlyOnce &= (count == 1);
+    }
+
+    check(exactlyOnce, "scheduler: parallelFor visits every index exactly once");
+}
+
+
+// -------------------------------------
+// SCHEDULER STATS COMPLETE PER BATCH
+// -------------------------------------
+void testSchedulerStatsCompletePerBatch()
+{
+    WorkStealingScheduler scheduler(4);
+    std::atomic<int> sink(0);
+    bool complete = true;
+
+    // parallelFor must not return before the workers have counted its chunks
+    for (int batch = 0; batch < 300; ++batch)
+    {
+        int count = 50 + batch % 37;
+        int chunkSize = 1 + batch % 4;
+        size_t executed = 0;
+
+        scheduler.resetStats();
+        scheduler.parallelFor(count, chunkSize, [&sink](int begin, int end, unsigned int)
+        {
+            sink += end - begin;
+        });
+
+        for (const auto& stats : scheduler.getStats())
+        {
+            executed += stats.tasksExecuted;
+        }
+
+        complete &= executed == static_cast<size_t>((count + chunkSize - 1) / chunkSize);
+    }
+
+    check(complete, "scheduler: stats count every chunk when parallelFor returns");
+}
+
+
+// ---------------------------------
+// SCHEDULER NESTED PARALLEL FOR
+// ---------------------------------
+void testSchedulerNestedParallelFor()
+{
+    WorkStealingScheduler scheduler(3);
+    std::vector<std::atomic<int>> visits(40 * 50);
+    std::atomic<int> outerDone{ 0 };
+    std::atomic<int> innerTotal{ 0 };
+    bool exactlyOnce = true;
+
+    // Every outer chunk runs an inner parallelFor and waits for it from inside a task
+    scheduler.parallelFor(40, 1, [&](int row, int, unsigned int)
+    {
+        scheduler.parallelFor(50, 7, [&](int begin, int end, unsigned int)
+        {
+            for (int i = begin; i < end; ++i)
+            {
+                visits[row * 50 + i]++;
+            }
+        });
+
+        int sum = 0;
+
+        for (int i = 0; i < 50; ++i)
+        {
+            sum += visits[row * 50 + i];
+        }
+
+        innerTotal += sum;
+        outerDone++;
+    });
+
+    for (auto& count : visits)
+    {
+        exactlyOnce &= (count == 1);
+    }
+
+    check(outerDone == 40 && exactlyOnce, "scheduler: nested parallelFor completes without deadlock");
+    check(innerTotal == 40 * 50, "scheduler: nested parallelFor returns only after its own chunks");
+
+    // Two external callers at once: each returns when its own range is done
+    std::vector<int> first(500, 0);
+    std::vector<int> second(500, 0);
+    auto fill = [&scheduler](std::vector<int>& values)
+    {
+        scheduler.parallelFor(static_cast<int>(values.size()), 5, [&values](int begin, int end, unsigned int)
+        {
+            for (int i = begin; i < end; ++i)
+            {
+                values[i] = i;
+            }
+        });
+    };
+    std::thread other(fill, std::ref(second));
+
+    fill(first);
+    other.join();
+
+    exactlyOnce = true;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        exactlyOnce &= first[i] == i && second[i] == i;
+    }
+
+    check(exactlyOnce, "scheduler: concurrent parallelFor callers each finish their range");
+}
+
+
+// ------------------------
+// SCHEDULER RUN TESTS
+// ------------------------
+void runWorkStealingSchedulerTests()
+{
+    testHeader("WORK STEALING SCHEDULER TESTS");
+
+    testSchedulerRunsAllTasks();
+    testSchedulerNestedSubmit();
+    testSchedulerStealsWork();
+    testSchedulerParallelFor();
+    testSchedulerStatsCompletePerBatch();
+    testSchedulerNestedParallelFor();
+}
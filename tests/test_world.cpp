@@ -2,6 +2,7 @@
 #include "state.h"
 #include "test_framework.h"
 #include <cmath>
+#include <vector>
 
 
 // ---------------------------------------
@@ -149,6 +150,220 @@ void testWorldNegativeWeightProtection()
 }
 
 
+// ---------------------------
+// CELL ID ROUND TRIP
+// ---------------------------
+void testWorldCellIds()
+{
+    World world(4, 3);
+    State s{ 2, 1 };
+    CellId id = world.toCell(s);
+    bool passed = true;
+
+    passed &= world.toState(id) == s;
+    passed &= world.findCell(s) == id;
+    passed &= world.toCell({ 3, 1 }) == id + 1;
+    passed &= world.toCell({ 2, 2 }) == id + world.getStride();
+    passed &= world.getCellCount() == (4 + 2) * (3 + 2);
+
+    world.setWeight(s, 6.5);
+    passed &= almostEqual(world.getWeight(id), 6.5);
+
+    world.setWeight(s, World::BLOCK);
+    passed &= !world.isFree(id);
+
+    check(passed, "cell id conversion and lookups match State API");
+}
+
+
+// ---------------------------
+// SENTINEL BORDER
+// ---------------------------
+void testWorldSentinelBorder()
+{
+    World world(3, 3);
+    bool passed = true;
+
+    passed &= world.findCell({ -1, 0 }) == World::INVALID_CELL;
+    passed &= world.findCell({ 0, 3 }) == World::INVALID_CELL;
+
+    // The ring around the grid is blocked, also after clearGrid
+    world.clearGrid();
+    for (int i = -1; i <= 3; ++i)
+    {
+        passed &= !world.isFree(world.toCell({ i, -1 }));
+        passed &= !world.isFree(world.toCell({ i, 3 }));
+        passed &= !world.isFree(world.toCell({ -1, i }));
+        passed &= !world.isFree(world.toCell({ 3, i }));
+    }
+
+    check(passed, "sentinel border cells are blocked and out of bounds");
+}
+
+
+// --------------------
+// WEIGHT LISTENERS
+// --------------------
+void testWorldWeightListeners()
+{
+    World world(6, 4);
+    std::vector<State> seen;
+    int otherCalls = 0;
+    int id = world.addWeightListener([&seen](const State& s) { seen.push_back(s); });
+    int other = world.addWeightListener([&otherCalls](const State&) { otherCalls++; });
+
+    world.setWeight({ 1, 1 }, 3.0);
+    world.setWeight({ 1, 1 }, 3.0);      // unchanged: no notification
+    world.setWeight({ 9, 9 }, 3.0);      // out of bounds: no notification
+    world.setWeight({ 2, 3 }, World::BLOCK);
+
+    check(seen.size() == 2 && seen[0] == State{ 1, 1 } && seen[1] == State{ 2, 3 } && otherCalls == 2,
+        "world: listeners see every changed cell once");
+
+    world.removeWeightListener(other);
+    seen.clear();
+    world.clearGrid();
+
+    check(seen.size() == 2 && otherCalls == 2, "world: clearGrid reports reset cells, removed listener is silent");
+
+    world.removeWeightListener(id);
+    world.setWeight({ 0, 0 }, 2.0);
+    check(seen.size() == 2, "world: no notifications after removing all listeners");
+}
+
+
+// --------------------
+// COPIES AND LISTENERS
+// --------------------
+void testWorldCopiesSkipListeners()
+{
+    World world(6, 4);
+    World assigned(3, 3);
+    int originalCalls = 0;
+    int assignedCalls = 0;
+
+    world.addWeightListener([&originalCalls](const State&) { originalCalls++; });
+    int kept = assigned.addWeightListener([&assignedCalls](const State&) { assignedCalls++; });
+
+    World copy(world);
+    assigned = world;
+
+    copy.setWeight({ 1, 1 }, 3.0);
+    copy.clearGrid();
+    assigned.setWeight({ 2, 2 }, World::BLOCK);
+
+    check(originalCalls == 0 && assignedCalls == 1, "world: copies do not notify the original's listeners");
+
+    // Ids handed out by the copy do not collide with the ids it kept
+    assigned.removeWeightListener(assigned.addWeightListener([](const State&) {}));
+    assigned.setWeight({ 2, 2 }, 2.0);
+    check(assignedCalls == 2, "world: assignment keeps the target's own listeners");
+
+    assigned.removeWeightListener(kept);
+    world.setWeight({ 0, 0 }, 2.0);
+    check(originalCalls == 1 && assignedCalls == 2, "world: the original still notifies its own listeners");
+}
+
+
+// --------------------
+// CHANGE JOURNAL
+// --------------------
+void testWorldChangeJournal()
+{
+    World world(40, 30);
+    std::uint64_t start = world.getEpoch();
+    std::uint64_t middle = 0;
+    WorldChanges changes;
+
+    world.setWeight({ 5, 5 }, 2.0);
+    world.setWeight({ 5, 5 }, 2.0);          // unchanged: same epoch
+    world.setWeight({ 50, 5 }, 2.0);         // out of bounds: same epoch
+
+    check(world.getEpoch() == start + 1 && world.hasChangedSince(start), "world: epoch counts real changes only");
+
+    // A wall drawn cell by cell merges into one rectangle
+    for (int x = 10; x < 20; ++x)
+    {
+        world.setWeight({ x, 12 }, World::BLOCK);
+    }
+
+    middle = world.getEpoch();
+    world.setWeight({ 35, 25 }, 4.0);
+    changes = world.getChangesSince(start);
+
+    check(!changes.fullInvalidation && changes.epoch == world.getEpoch() && changes.regions.size() == 3,
+        "world: changes since an epoch, nearby cells merged");
+    check(changes.regions[1].minX == 10 && changes.regions[1].maxX == 19 && changes.regions[1].minY == 12 &&
+        changes.regions[1].maxY == 12 && changes.regions[1].epoch == middle, "world: merged region covers the wall");
+
+    changes = world.getChangesSince(middle);
+    check(changes.regions.size() == 1 && changes.regions[0].minX == 35 && changes.regions[0].minY == 25,
+        "world: only later regions are returned");
+    check(world.getChangesSince(world.getEpoch()).regions.empty() && !world.hasChangedSince(world.getEpoch()),
+        "world: nothing changed since the current epoch");
+
+    world.clearGrid();
+    changes = world.getChangesSince(middle);
+    check(changes.regions.size() == 2 && changes.regions[1].maxX == 39 && changes.regions[1].maxY == 29,
+        "world: clearGrid records the whole grid");
+    check(world.getChangesSince(world.getEpoch() + 5).fullInvalidation, "world: unknown epoch is a full invalidation");
+
+    // A copy shares the history; an assignment invalidates the target's earlier epochs
+    World copy(world);
+    World assigned(40, 30);
+    std::uint64_t before = assigned.getEpoch();
+
+    assigned = world;
+
+    check(copy.getEpoch() == world.getEpoch() && copy.getChangesSince(middle).regions.size() == 2,
+        "world: copies keep the epoch and journal");
+    check(assigned.hasChangedSince(before) && assigned.getChangesSince(before).fullInvalidation,
+        "world: assignment invalidates earlier epochs");
+}
+
+
+// --------------------
+// JOURNAL OVERFLOW
+// --------------------
+void testWorldJournalOverflow()
+{
+    World world(100, 100);
+    std::uint64_t start = world.getEpoch();
+    std::uint64_t recent = 0;
+
+    world.setJournalCapacity(4);
+
+    // Scattered cells cannot be merged: the fifth region overflows the journal
+    for (int i = 0; i < 5; ++i)
+    {
+        world.setWeight({ i * 10, i * 10 }, 3.0);
+    }
+
+    recent = world.getEpoch();
+    world.setWeight({ 90, 5 }, 3.0);
+
+    check(world.getJournalSize() <= 4 && world.getChangesSince(start).fullInvalidation,
+        "world: overflow invalidates earlier epochs");
+    check(!world.getChangesSince(recent).fullInvalidation && world.getChangesSince(recent).regions.size() == 1,
+        "world: changes after the overflow are recorded again");
+
+    // Recent epochs survive further overflows, only the oldest regions are dropped
+    for (int i = 0; i < 20; ++i)
+    {
+        recent = world.getEpoch();
+        world.setWeight({ (i * 7) % 100, 50 + (i * 13) % 50 }, 6.0);
+    }
+
+    check(world.getChangesSince(recent).regions.size() == 1 && world.getJournalSize() <= 4,
+        "world: overflow keeps the newest regions");
+
+    world.setJournalCapacity(0);
+    world.setWeight({ 1, 1 }, 5.0);
+    check(world.getJournalSize() == 0 && world.getChangesSince(recent).fullInvalidation,
+        "world: no journal with capacity 0");
+}
+
+
 // --------------------
 // RUN WORLD TESTS
 // --------------------
@@ -162,4 +377,10 @@ void runWorldTests()
     testWorldMultipleBlockedCells();
     testWorldClearGrid();
     testWorldNegativeWeightProtection();
+    testWorldCellIds();
+    testWorldSentinelBorder();
+    testWorldWeightListeners();
+    testWorldCopiesSkipListeners();
+    testWorldChangeJournal();
+    testWorldJournalOverflow();
 }
\ No newline at end of file